@@ -109,7 +109,25 @@ public:
 			 components
 	*/
 	/******************************************************************************/
-	void DeSerializeClone(std::stringstream& data) override;
+	void DeSerializeClone(CloneReader& data) override;
+
+	/******************************************************************************/
+	/*!
+	  \fn SerializeSnapshot(CloneWriter& data)
+
+	  \brief Writes the current values of the component into a save game snapshot
+	*/
+	/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+	/******************************************************************************/
+	/*!
+	  \fn DeSerializeSnapshot(CloneReader& data)
+
+	  \brief Restores the values saved by SerializeSnapshot
+	*/
+	/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
 
 	/******************************************************************************/
 	/*!
@@ -118,9 +136,17 @@ public:
 	  \brief Clones the existing component
 	*/
 	/******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
+
+	/******************************************************************************/
+	/*!
+	  \fn SetTree(AIType type)
 
-	void SetRoot(AIType type);
+	  \brief Binds the component to the shared behaviour tree of its type and
+			 level, and resolves the components used by its blackboard
+	*/
+	/******************************************************************************/
+	void SetTree(AIType type);
 
 	AIType GetType(std::string type);
 
@@ -340,13 +366,39 @@ public:
 	/******************************************************************************/
 	void SetLife(bool life) { alive_ = life; }
 
-	Behaviour::Root* GetRoot() { return root_; };
+	/******************************************************************************/
+	/*!
+	  \fn GetTree()
+
+	  \brief Returns the shared behaviour tree of the AI, nullptr if it has none
+	*/
+	/******************************************************************************/
+	const Behaviour::Tree* GetTree() { return tree_; }
+
+	/******************************************************************************/
+	/*!
+	  \fn GetAgent()
+
+	  \brief Returns the behaviour tree agent of the AI
+	*/
+	/******************************************************************************/
+	Behaviour::Agent& GetAgent() { return agent_; }
+
+	/******************************************************************************/
+	/*!
+	  \fn CollisionResponse(EntityID obj)
+
+	  \brief Runs the collision response of the AI's behaviour tree
+	*/
+	/******************************************************************************/
+	void CollisionResponse(EntityID obj);
 
 	int GetLevel() { return level_; }
 
 private:
 
-	Behaviour::Root* root_;
+	const Behaviour::Tree* tree_;
+	Behaviour::Agent agent_;
 	AIType type_;
 	
 	int level_;
@@ -96,7 +96,25 @@ public:
 		 components
 */
 /******************************************************************************/
-	void DeSerializeClone(std::stringstream& data) override;
+	void DeSerializeClone(CloneReader& data) override;
+
+/******************************************************************************/
+/*!
+  \fn SerializeSnapshot(CloneWriter& data)
+
+  \brief Writes the current values of the component into a save game snapshot
+*/
+/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+/******************************************************************************/
+/*!
+  \fn DeSerializeSnapshot(CloneReader& data)
+
+  \brief Restores the values saved by SerializeSnapshot
+*/
+/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
 
 /******************************************************************************/
 /*!
@@ -105,7 +123,7 @@ public:
   \brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 /******************************************************************************/
 /*!
@@ -82,12 +82,30 @@ public:
 
 /******************************************************************************/
 /*!
-	\fn DeSerializeClone(std::stringstream& data)
+	\fn DeSerializeClone(CloneReader& data)
 
 	\brief Serializes data members within the Component
 */
 /******************************************************************************/
-	void DeSerializeClone(std::stringstream& data);
+	void DeSerializeClone(CloneReader& data);
+
+/******************************************************************************/
+/*!
+	\fn SerializeSnapshot(CloneWriter& data)
+
+	\brief Writes the current values of the component into a save game snapshot
+*/
+/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+/******************************************************************************/
+/*!
+	\fn DeSerializeSnapshot(CloneReader& data)
+
+	\brief Restores the values saved by SerializeSnapshot
+*/
+/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
 
 /******************************************************************************/
 /*!
@@ -96,7 +114,7 @@ public:
 	\brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 /******************************************************************************/
 /*!
@@ -99,7 +99,7 @@ public:
 	  \brief Clones the existing component
 	*/
 	/******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 	/******************************************************************************/
 	/*!
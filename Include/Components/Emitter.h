@@ -21,12 +21,32 @@
 #include "Manager/ForcesManager.h"
 #include <sstream>
 #include <memory>
+#include <vector>
 
 class Transform;
 class Particle;
 class TextureRenderer;
 class ForcesManager;
 class GraphicsSystem;
+class RandomGenerator;
+
+// Random values sampled in bulk for every particle of a single burst
+struct ParticleSamples
+{
+	std::vector<float> lifetime_;
+	std::vector<float> position_x_, position_y_;
+	std::vector<float> force_, direction_;
+	std::vector<float> rotation_speed_, rotation_min_, rotation_max_;
+
+/******************************************************************************/
+/*!
+  \fn Resize()
+
+  \brief Resizes all sample arrays to hold count particles
+*/
+/******************************************************************************/
+	void Resize(size_t count);
+};
 
 // Particle customizations
 struct GenerateLifetime
@@ -34,6 +54,15 @@ struct GenerateLifetime
 	// Range for lifetime of particles
 	Vector2D lifetime_range_;
 
+/******************************************************************************/
+/*!
+  \fn Sample()
+
+  \brief Samples the lifespan of count particles in a single batch
+*/
+/******************************************************************************/
+	void Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count);
+
 /******************************************************************************/
 /*!
   \fn Generate()
@@ -41,7 +70,7 @@ struct GenerateLifetime
   \brief Generates a particle's lifespan
 */
 /******************************************************************************/
-	void Generate(Particle* particle);
+	void Generate(Particle* particle, const ParticleSamples& samples, size_t index);
 };
 
 struct GeneratePosition
@@ -49,6 +78,15 @@ struct GeneratePosition
 	// Range for spawning 
 	Vector2D min_pos_, max_pos_;
 
+/******************************************************************************/
+/*!
+  \fn Sample()
+
+  \brief Samples the spawn offset of count particles in a single batch
+*/
+/******************************************************************************/
+	void Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count);
+
 /******************************************************************************/
 /*!
   \fn Generate()
@@ -56,7 +94,7 @@ struct GeneratePosition
   \brief Generates a particle's position
 */
 /******************************************************************************/
-	void Generate(Transform* particle_transform, Transform* emitter_transform);
+	void Generate(Transform* particle_transform, Transform* emitter_transform, const ParticleSamples& samples, size_t index);
 };
 
 struct GenerateForce
@@ -66,6 +104,15 @@ struct GenerateForce
 	// Range for direction of vector (-1 to 1)
 	Vector2D direction_range_;
 
+/******************************************************************************/
+/*!
+  \fn Sample()
+
+  \brief Samples the force and direction of count particles in a single batch
+*/
+/******************************************************************************/
+	void Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count);
+
 /******************************************************************************/
 /*!
   \fn Generate()
@@ -73,7 +120,7 @@ struct GenerateForce
   \brief Generates a particle's force and direction
 */
 /******************************************************************************/
-	void Generate(std::shared_ptr<ForcesManager> force_manager, Particle* particle, EntityID particle_id);
+	void Generate(ForcesManager* force_manager, Particle* particle, EntityID particle_id, const ParticleSamples& samples, size_t index);
 };
 
 struct GenerateRotation
@@ -83,6 +130,15 @@ struct GenerateRotation
 	// Range for rotation of texture
 	Vector2D min_rotation_range_, max_rotation_range_;
 
+/******************************************************************************/
+/*!
+  \fn Sample()
+
+  \brief Samples the rotation of count particles in a single batch
+*/
+/******************************************************************************/
+	void Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count);
+
 /******************************************************************************/
 /*!
   \fn Generate()
@@ -90,7 +146,7 @@ struct GenerateRotation
   \brief Generates a particle's rotation
 */
 /******************************************************************************/
-	void Generate(Transform* transform);
+	void Generate(Transform* transform, const ParticleSamples& samples, size_t index);
 
 };
 
@@ -107,7 +163,7 @@ struct GenerateTexture
   \brief Generates a particle's texture
 */
 /******************************************************************************/
-	void Generate(std::shared_ptr<GraphicsSystem> graphics_system, TextureRenderer* texture);
+	void Generate(GraphicsSystem* graphics_system, TextureRenderer* texture, RandomGenerator& rng);
 };
 
 struct GenerateDestination
@@ -158,16 +214,18 @@ class Emitter : public Component {
 	GenerateTexture particle_texture_;
 	GenerateDestination particle_destination_;
 
+	ParticleSamples samples_;			// Scratch storage for the current burst
+
 
 /******************************************************************************/
 /*!
   \fn SetParticle()
 
   \brief Helper function to set a particle based on preset parameters defined
-		 by the emitter
+		 by the emitter, using the values sampled at index of the burst
 */
 /******************************************************************************/
-	void SetParticle(const EntityID& id);
+	void SetParticle(const EntityID& id, size_t index);
 
 public:
 	
@@ -235,7 +293,25 @@ public:
   \brief Reads data from a stringstream and stores them into the data members
 */
 /******************************************************************************/
-	void DeSerializeClone(std::stringstream& data) override;
+	void DeSerializeClone(CloneReader& data) override;
+
+/******************************************************************************/
+/*!
+  \fn SerializeSnapshot(CloneWriter& data)
+
+  \brief Writes the current values of the component into a save game snapshot
+*/
+/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+/******************************************************************************/
+/*!
+  \fn DeSerializeSnapshot(CloneReader& data)
+
+  \brief Restores the values saved by SerializeSnapshot
+*/
+/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
 
 /******************************************************************************/
 /*!
@@ -244,7 +320,7 @@ public:
   \brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 /******************************************************************************/
 /*!
@@ -12,6 +12,8 @@
 
 
 #include "Entity/ComponentTypes.h"
+#include "Entity/CloneReader.h"
+#include "Entity/ComponentPool.h"
 #include "../rapidjson/filereadstream.h"
 #include "../rapidjson/document.h"
 #include "prettywriter.h"
@@ -29,9 +31,13 @@ class Component {
 	// Pointer to the entity that owns the component
 	Entity* owner_;
 	ComponentTypes type_id_;
+	// Pool the component was created from and is returned to
+	IComponentPool* pool_;
 
 public:
 	friend class Entity;
+	template <typename T>
+	friend class ComponentPool;
 
 /******************************************************************************/
 /*!
@@ -71,13 +77,33 @@ public:
 
 /******************************************************************************/
 /*!
-  \fn SerializeClone()
+  \fn DeSerializeClone()
 
   \brief Retrieves data that will initialise data that can be unique from other
-		 components
+		 components, read from either a JSON entry or a cooked level
+*/
+/******************************************************************************/
+	virtual void DeSerializeClone(CloneReader& data) { (void)data; };
+
+/******************************************************************************/
+/*!
+  \fn SerializeSnapshot()
+
+  \brief Writes the current values of a component into a save game snapshot,
+		 in the order DeSerializeSnapshot reads them
 */
 /******************************************************************************/
-	virtual void DeSerializeClone(std::stringstream& data) { (void)data; };
+	virtual void SerializeSnapshot(CloneWriter& data) { (void)data; };
+
+/******************************************************************************/
+/*!
+  \fn DeSerializeSnapshot()
+
+  \brief Restores the values written by SerializeSnapshot onto a component
+		 freshly cloned from its archetype
+*/
+/******************************************************************************/
+	virtual void DeSerializeSnapshot(CloneReader& data) { (void)data; };
 
 /******************************************************************************/
 /*!
@@ -97,6 +123,15 @@ public:
 /******************************************************************************/
 	ComponentTypes GetComponentTypeID() { return type_id_; }
 
+/******************************************************************************/
+/*!
+  \fn GetPool()
+
+  \brief Returns the pool the component was created from
+*/
+/******************************************************************************/
+	IComponentPool* GetPool() const { return pool_; }
+
 /******************************************************************************/
 /*!
   \fn Clone()
@@ -104,7 +139,7 @@ public:
   \brief Clones the existing component
 */
 /******************************************************************************/
-	virtual std::shared_ptr<Component> Clone() { return nullptr; };
+	virtual Component* Clone() { return nullptr; };
 
 protected:
 /******************************************************************************/
@@ -17,8 +17,25 @@
 #define _LOGIC_COMPONENT_H_
 
 #include <map>
+#include <array>
 #include "Entity/Entity.h"
 #include "Components/IComponent.h"
+#include "Manager/LogicManager.h"
+
+// Hooks that engine systems dispatch to, each bound to a fixed slot
+enum class LogicHook : size_t
+{
+	UpdateTexture = 0,
+	UpdateChildOffset,
+	UpdateInput,
+	UpdateAnimation,
+	ButtonUpdateTexture,
+	Collectible,
+	Interactable,
+	Title,
+
+	Count
+};
 
 
 class LogicComponent : public Component
@@ -30,6 +47,7 @@ public:
 
 	// Test
 	using LogicMap = std::map<std::string, std::string>;
+	using HookTable = std::array<LogicHandle, static_cast<size_t>(LogicHook::Count)>;
 
 
 /******************************************************************************/
@@ -70,13 +88,31 @@ public:
 
 /******************************************************************************/
 /*!
-  \fn SerializeClone()
+  \fn DeSerializeClone()
 
   \brief Retrieves data that will initialise data that can be unique from other
 		 components
 */
 /******************************************************************************/
-	void DeSerializeClone(std::stringstream& data);
+	void DeSerializeClone(CloneReader& data);
+
+/******************************************************************************/
+/*!
+  \fn SerializeSnapshot(CloneWriter& data)
+
+  \brief Writes the current values of the component into a save game snapshot
+*/
+/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+/******************************************************************************/
+/*!
+  \fn DeSerializeSnapshot(CloneReader& data)
+
+  \brief Restores the values saved by SerializeSnapshot
+*/
+/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
 
 /******************************************************************************/
 /*!
@@ -87,6 +123,25 @@ public:
 /******************************************************************************/
 	const std::string GetLogic(const std::string& fn);
 
+/******************************************************************************/
+/*!
+  \fn GetHook()
+
+  \brief Retrieves the function bound to a hook, the returned handle is empty
+		 if the entity does not implement the hook
+*/
+/******************************************************************************/
+	const LogicHandle& GetHook(LogicHook hook) const;
+
+/******************************************************************************/
+/*!
+  \fn BindHooks()
+
+  \brief Resolves the script names of every known hook into function handles
+*/
+/******************************************************************************/
+	void BindHooks();
+
 /******************************************************************************/
 /*!
   \fn Clone()
@@ -94,7 +149,7 @@ public:
   \brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone();
+	Component* Clone();
 
 /***************************************************************************/
 /*!
@@ -110,8 +165,7 @@ private:
 	size_t size_;
 	//std::string entity_;
 	LogicMap my_logic_;
-
-	friend class Physics; //temp
+	HookTable hooks_;
 };
 
 #endif // !_LOGIC_COMPONENT_H_
\ No newline at end of file
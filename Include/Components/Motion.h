@@ -28,9 +28,11 @@ class Motion : public Component {
 	bool is_left_;
 	bool is_top_;
 	bool alive_;
+	size_t force_slot_;		// Accumulator slot within the ForcesManager
 
 public:
 	friend class Physics;
+	friend class ForcesManager;
 	friend class Collision;
 	friend class PlayState;
 	friend class Emitter;
@@ -83,6 +85,24 @@ public:
 /******************************************************************************/
 	void DeSerialize(std::stringstream& data) override;
 
+/******************************************************************************/
+/*!
+  \fn SerializeSnapshot(CloneWriter& data)
+
+  \brief Writes the current values of the component into a save game snapshot
+*/
+/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+/******************************************************************************/
+/*!
+  \fn DeSerializeSnapshot(CloneReader& data)
+
+  \brief Restores the values saved by SerializeSnapshot
+*/
+/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
+
 /******************************************************************************/
 /*!
   \fn Clone()
@@ -90,7 +110,7 @@ public:
   \brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 /******************************************************************************/
 /*!
@@ -17,12 +17,13 @@
 
 #include "Entity/Entity.h"
 #include "Components/IComponent.h"
+#include "Entity/NameTable.h"
 #include <sstream>
 #include <memory>
 
 class Name : public Component {
 
-	std::string name_;
+	NameID name_;
 public:
 
 /******************************************************************************/
@@ -77,7 +78,16 @@ public:
   \brief Returns the type of the entity
 */
 /******************************************************************************/
-	std::string GetEntityName() const;
+	const std::string& GetEntityName() const;
+
+/******************************************************************************/
+/*!
+  \fn GetNameID()
+
+  \brief Returns the interned id of the entity's name
+*/
+/******************************************************************************/
+	NameID GetNameID() const { return name_; }
 
 /******************************************************************************/
 /*!
@@ -86,7 +96,7 @@ public:
   \brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 /******************************************************************************/
 /*!
@@ -95,6 +105,6 @@ public:
   \brief Retrieve the name of the Entity
 */
 /******************************************************************************/	
-	std::string GetName();
+	const std::string& GetName() const;
 };
 #endif
\ No newline at end of file
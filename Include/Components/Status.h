@@ -67,13 +67,31 @@ public:
 
 /******************************************************************************/
 /*!
-  \fn Serialize
+  \fn DeSerialize()
 
   \brief Retrieves the data from the stringstream to initialize data members
 */
 /******************************************************************************/
 	void DeSerialize(std::stringstream& data) override;
 
+/******************************************************************************/
+/*!
+  \fn SerializeSnapshot(CloneWriter& data)
+
+  \brief Writes the current values of the component into a save game snapshot
+*/
+/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+/******************************************************************************/
+/*!
+  \fn DeSerializeSnapshot(CloneReader& data)
+
+  \brief Restores the values saved by SerializeSnapshot
+*/
+/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
+
 /******************************************************************************/
 /*!
   \fn Clone()
@@ -81,7 +99,7 @@ public:
   \brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 /******************************************************************************/
 /*!
@@ -32,6 +32,13 @@ class TextRenderer : public IRenderer {
 	glm::vec3 color_;
 	float scale_;
 
+	// Glyph quads in screen space, rebuilt only when the layout changes
+	std::vector<GlyphVertex> mesh_;
+	glm::vec2 mesh_position_;
+	glm::vec3 mesh_color_;
+	float mesh_scale_;
+	bool mesh_dirty_;
+
 public:
 
 	friend class GraphicsSystem;
@@ -86,12 +93,30 @@ public:
 
 /******************************************************************************/
 /*!
-	\fn DeSerializeClone(std::stringstream& data)
+	\fn DeSerializeClone(CloneReader& data)
 
 	\brief Serializes data members within the Component
 */
 /******************************************************************************/
-	void DeSerializeClone(std::stringstream& data) override;
+	void DeSerializeClone(CloneReader& data) override;
+
+/******************************************************************************/
+/*!
+	\fn SerializeSnapshot(CloneWriter& data)
+
+	\brief Writes the current values of the component into a save game snapshot
+*/
+/******************************************************************************/
+	void SerializeSnapshot(CloneWriter& data) override;
+
+/******************************************************************************/
+/*!
+	\fn DeSerializeSnapshot(CloneReader& data)
+
+	\brief Restores the values saved by SerializeSnapshot
+*/
+/******************************************************************************/
+	void DeSerializeSnapshot(CloneReader& data) override;
 
 /******************************************************************************/
 /*!
@@ -100,7 +125,7 @@ public:
 	\brief Clones the existing component
 */
 /******************************************************************************/
-	std::shared_ptr<Component> Clone() override;
+	Component* Clone() override;
 
 /******************************************************************************/
 /*!
@@ -0,0 +1,227 @@
+/**********************************************************************************
+*\file         CloneReader.h
+*\brief        Contains definition of functions and variables used for
+*			   reading the values of cloned components from either a JSON
+*			   entity file, a cooked level or a save game snapshot
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _CLONE_READER_H_
+#define _CLONE_READER_H_
+
+#include "Entity/ComponentTypes.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/******************************************************************************/
+/*!
+	\class CloneReader
+
+	\brief Reads the values a component is cloned with. Text readers parse the
+		   values of a JSON entry and can record each one into a binary block
+		   as it is read. Binary readers read those blocks back with no text
+		   parsing, so a component only describes its values once
+*/
+/******************************************************************************/
+class CloneReader {
+
+	std::stringstream* text_;
+	std::vector<unsigned char>* record_;
+	const unsigned char* data_;
+	const unsigned char* end_;
+
+public:
+
+	// Bumped whenever a component changes the values it is cloned with, so
+	// binary blocks recorded with the old values are not read back
+	static constexpr uint32_t format_ = 1;
+
+	// Stored with every file of recorded blocks, which are keyed by component
+	// type and only readable by a build with the same types and format
+	static constexpr uint32_t layout_ = (format_ << 16) | static_cast<uint32_t>(ComponentTypes::MAX);
+
+/******************************************************************************/
+/*!
+	\fn CloneReader(std::stringstream& text, std::vector<unsigned char>* record)
+
+	\brief Reads values from text, appending each one to record if given
+*/
+/******************************************************************************/
+	explicit CloneReader(std::stringstream& text, std::vector<unsigned char>* record = nullptr) :
+		text_{ &text }, record_{ record }, data_{ nullptr }, end_{ nullptr }
+	{}
+
+/******************************************************************************/
+/*!
+	\fn CloneReader(const unsigned char* data, size_t size)
+
+	\brief Reads values from a recorded binary block
+*/
+/******************************************************************************/
+	CloneReader(const unsigned char* data, size_t size) :
+		text_{ nullptr }, record_{ nullptr }, data_{ data }, end_{ data + size }
+	{}
+
+/******************************************************************************/
+/*!
+	\fn operator>>(T& value)
+
+	\brief Reads a number or bool. A value past the end of a binary block is
+		   left unchanged, as a failed text read would be
+*/
+/******************************************************************************/
+	template <typename T>
+	CloneReader& operator>>(T& value) {
+
+		static_assert(std::is_arithmetic_v<T>, "Only numbers, bools and strings can be cloned");
+
+		if (text_) {
+
+			*text_ >> value;
+
+			if (record_) {
+
+				Append(*record_, value);
+			}
+		}
+		else if (static_cast<size_t>(end_ - data_) >= sizeof(T)) {
+
+			std::memcpy(&value, data_, sizeof(T));
+			data_ += sizeof(T);
+		}
+
+		return *this;
+	}
+
+/******************************************************************************/
+/*!
+	\fn operator>>(std::string& value)
+
+	\brief Reads a single word
+*/
+/******************************************************************************/
+	CloneReader& operator>>(std::string& value) {
+
+		if (text_) {
+
+			*text_ >> value;
+
+			if (record_) {
+
+				Append(*record_, value);
+			}
+
+			return *this;
+		}
+
+		uint32_t length = 0;
+		*this >> length;
+
+		if (static_cast<size_t>(end_ - data_) >= length) {
+
+			value.assign(reinterpret_cast<const char*>(data_), length);
+			data_ += length;
+		}
+
+		return *this;
+	}
+
+/******************************************************************************/
+/*!
+	\fn Split(size_t size)
+
+	\brief Returns a reader over the next size bytes of a binary block and
+		   skips past them
+*/
+/******************************************************************************/
+	CloneReader Split(size_t size) {
+
+		size = (std::min)(size, static_cast<size_t>(end_ - data_));
+		CloneReader block{ data_, size };
+		data_ += size;
+		return block;
+	}
+
+/******************************************************************************/
+/*!
+	\fn Append(std::vector<unsigned char>& block, const T& value)
+
+	\brief Appends a number or bool to a binary block
+*/
+/******************************************************************************/
+	template <typename T>
+	static void Append(std::vector<unsigned char>& block, const T& value) {
+
+		static_assert(std::is_arithmetic_v<T>, "Only numbers, bools and strings can be cloned");
+
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+		block.insert(block.end(), bytes, bytes + sizeof(T));
+	}
+
+/******************************************************************************/
+/*!
+	\fn Append(std::vector<unsigned char>& block, const std::string& value)
+
+	\brief Appends a string to a binary block, prefixed by its length
+*/
+/******************************************************************************/
+	static void Append(std::vector<unsigned char>& block, const std::string& value) {
+
+		Append(block, static_cast<uint32_t>(value.size()));
+		block.insert(block.end(), value.begin(), value.end());
+	}
+};
+
+/******************************************************************************/
+/*!
+	\class CloneWriter
+
+	\brief Writes values into a binary block in the format binary CloneReaders
+		   read them back in
+*/
+/******************************************************************************/
+class CloneWriter {
+
+	std::vector<unsigned char>* block_;
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn CloneWriter(std::vector<unsigned char>& block)
+
+	\brief Appends values to the end of block
+*/
+/******************************************************************************/
+	explicit CloneWriter(std::vector<unsigned char>& block) :
+		block_{ &block }
+	{}
+
+/******************************************************************************/
+/*!
+	\fn operator<<(const T& value)
+
+	\brief Writes a number, bool or string
+*/
+/******************************************************************************/
+	template <typename T>
+	CloneWriter& operator<<(const T& value) {
+
+		CloneReader::Append(*block_, value);
+		return *this;
+	}
+};
+
+#endif
@@ -14,6 +14,7 @@
 
 #pragma once
 #include "Entity/ComponentTypes.h"
+#include "Entity/ComponentPool.h"
 
 class Component;
 
@@ -48,7 +49,16 @@ public:
   \brief Creates and returns a new instance of the component
 */
 /******************************************************************************/
-	virtual std::shared_ptr<Component> Create() = 0;
+	virtual Component* Create() = 0;
+
+/******************************************************************************/
+/*!
+  \fn GetPool()
+
+  \brief Returns the pool the components are created from
+*/
+/******************************************************************************/
+	virtual IComponentPool* GetPool() = 0;
 
 	virtual ~IComponentCreator() = default;
 };
@@ -76,7 +86,18 @@ public:
 		 is templated for
 */
 /******************************************************************************/
-	virtual std::shared_ptr<Component> Create() override {
-		return std::make_shared<type>();
+	virtual Component* Create() override {
+		return MakeComponent<type>();
+	}
+
+/******************************************************************************/
+/*!
+  \fn GetPool()
+
+  \brief Returns the pool of the type the creator is templated for
+*/
+/******************************************************************************/
+	virtual IComponentPool* GetPool() override {
+		return &ComponentPool<type>::Get();
 	}
 };
\ No newline at end of file
@@ -0,0 +1,301 @@
+/**********************************************************************************
+*\file         ComponentPool.h
+*\brief        Contains declaration of functions and variables used for
+*			   allocating components from per type pools
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _COMPONENT_POOL_H_
+#define _COMPONENT_POOL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class Component;
+
+/******************************************************************************/
+/*!
+	\class IComponentPool
+
+	\brief Type independent part of a component pool, used to release a
+		   component without knowing its type and to report memory usage
+*/
+/******************************************************************************/
+class IComponentPool {
+
+	std::string name_;
+
+protected:
+
+	size_t slot_size_;
+	size_t slots_per_chunk_;
+	size_t chunk_count_;
+	size_t live_count_;
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn IComponentPool(const std::string& name, size_t slot_size,
+					   size_t slots_per_chunk)
+
+	\brief Constructs an empty pool and adds it to the list of pools
+*/
+/******************************************************************************/
+	IComponentPool(const std::string& name, size_t slot_size, size_t slots_per_chunk);
+
+/******************************************************************************/
+/*!
+	\fn ~IComponentPool()
+
+	\brief Removes the pool from the list of pools
+*/
+/******************************************************************************/
+	virtual ~IComponentPool();
+
+	IComponentPool(const IComponentPool&) = delete;
+	IComponentPool& operator=(const IComponentPool&) = delete;
+
+/******************************************************************************/
+/*!
+	\fn Destroy(Component* component)
+
+	\brief Destroys a component from this pool and frees its slot
+*/
+/******************************************************************************/
+	virtual void Destroy(Component* component) = 0;
+
+/******************************************************************************/
+/*!
+	\fn Reserve(size_t count)
+
+	\brief Makes sure count components can be created without adding chunks
+*/
+/******************************************************************************/
+	virtual void Reserve(size_t count) = 0;
+
+/******************************************************************************/
+/*!
+	\fn SetName(const std::string& name)
+
+	\brief Sets the name the pool is reported with
+*/
+/******************************************************************************/
+	void SetName(const std::string& name) { name_ = name; }
+
+/******************************************************************************/
+/*!
+	\fn GetName()
+
+	\brief Gets the name the pool is reported with
+*/
+/******************************************************************************/
+	const std::string& GetName() const { return name_; }
+
+/******************************************************************************/
+/*!
+	\fn GetLiveCount()
+
+	\brief Gets the number of components alive in the pool
+*/
+/******************************************************************************/
+	size_t GetLiveCount() const { return live_count_; }
+
+/******************************************************************************/
+/*!
+	\fn GetCapacity()
+
+	\brief Gets the number of components the pool's chunks can hold
+*/
+/******************************************************************************/
+	size_t GetCapacity() const { return chunk_count_ * slots_per_chunk_; }
+
+/******************************************************************************/
+/*!
+	\fn GetLiveBytes()
+
+	\brief Gets the bytes used by components alive in the pool
+*/
+/******************************************************************************/
+	size_t GetLiveBytes() const { return live_count_ * slot_size_; }
+
+/******************************************************************************/
+/*!
+	\fn GetReservedBytes()
+
+	\brief Gets the bytes allocated for the pool's chunks
+*/
+/******************************************************************************/
+	size_t GetReservedBytes() const { return GetCapacity() * slot_size_; }
+
+/******************************************************************************/
+/*!
+	\fn GetPools()
+
+	\brief Gets every pool that has been created
+*/
+/******************************************************************************/
+	static std::vector<IComponentPool*>& GetPools();
+};
+
+/******************************************************************************/
+/*!
+	\class ComponentPool
+
+	\brief Allocates components of one type from fixed size chunks. Chunks are
+		   never moved or freed while the game runs, so a component keeps its
+		   address and slots freed by one level are reused by the next
+*/
+/******************************************************************************/
+template <typename T>
+class ComponentPool : public IComponentPool {
+
+	union Slot {
+
+		Slot* next_;
+		alignas(T) unsigned char storage_[sizeof(T)];
+	};
+
+	static constexpr size_t chunk_bytes_ = 16 * 1024;
+
+	std::vector<std::unique_ptr<Slot[]>> chunks_;
+	Slot* free_;
+	size_t free_count_;
+
+/******************************************************************************/
+/*!
+	\fn ComponentPool()
+
+	\brief Constructs an empty pool
+*/
+/******************************************************************************/
+	ComponentPool() :
+		IComponentPool{ typeid(T).name(), sizeof(Slot), (std::max)(size_t{ 16 }, chunk_bytes_ / sizeof(Slot)) },
+		free_{ nullptr },
+		free_count_{ 0 }
+	{}
+
+/******************************************************************************/
+/*!
+	\fn AddChunk()
+
+	\brief Adds a chunk whose slots are handed out in address order
+*/
+/******************************************************************************/
+	void AddChunk() {
+
+		chunks_.push_back(std::make_unique<Slot[]>(slots_per_chunk_));
+		Slot* chunk = chunks_.back().get();
+
+		for (size_t i = slots_per_chunk_; i > 0; --i) {
+
+			chunk[i - 1].next_ = free_;
+			free_ = &chunk[i - 1];
+		}
+
+		free_count_ += slots_per_chunk_;
+		++chunk_count_;
+	}
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn Get()
+
+	\brief Gets the pool of T
+*/
+/******************************************************************************/
+	static ComponentPool& Get() {
+
+		static ComponentPool pool;
+		return pool;
+	}
+
+/******************************************************************************/
+/*!
+	\fn Create()
+
+	\brief Constructs a component in a free slot
+*/
+/******************************************************************************/
+	T* Create() {
+
+		if (!free_) {
+
+			AddChunk();
+		}
+
+		Slot* slot = free_;
+		free_ = slot->next_;
+		--free_count_;
+
+		T* component = new (slot->storage_) T();
+		component->pool_ = this;
+		++live_count_;
+
+		return component;
+	}
+
+/******************************************************************************/
+/*!
+	\fn Destroy(Component* component)
+
+	\brief Destroys a component from this pool and frees its slot
+*/
+/******************************************************************************/
+	void Destroy(Component* component) override {
+
+		T* derived = static_cast<T*>(component);
+		derived->~T();
+
+		Slot* slot = reinterpret_cast<Slot*>(derived);
+		slot->next_ = free_;
+		free_ = slot;
+
+		++free_count_;
+		--live_count_;
+	}
+
+/******************************************************************************/
+/*!
+	\fn Reserve(size_t count)
+
+	\brief Makes sure count components can be created without adding chunks
+*/
+/******************************************************************************/
+	void Reserve(size_t count) override {
+
+		while (free_count_ < count) {
+
+			AddChunk();
+		}
+	}
+};
+
+/******************************************************************************/
+/*!
+	\fn MakeComponent()
+
+	\brief Creates a component of type T from its pool
+*/
+/******************************************************************************/
+template <typename T>
+T* MakeComponent() {
+
+	return ComponentPool<T>::Get().Create();
+}
+
+#endif
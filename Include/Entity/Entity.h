@@ -17,7 +17,11 @@
 
 #include "Components/IComponent.h"
 #include "Components/Name.h"
+#include "Entity/NameTable.h"
 #include "prettywriter.h"
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <string>
@@ -26,19 +30,35 @@
 
 
 using EntityID = size_t;
-using ComponentArr = std::vector<std::shared_ptr<Component>>;
-using ComponentArrIt = std::vector<std::shared_ptr<Component>>::iterator;
+using ComponentArr = std::vector<Component*>;
+using ComponentArrIt = std::vector<Component*>::iterator;
 
 // defines a single entity that owns components
 // aka gameobject in Unity terms
 class Entity {
-	using EntityIt = std::vector<std::shared_ptr<Component>>::iterator;
+	using EntityIt = std::vector<Component*>::iterator;
 
-	// Vector of components attached to the entity
+	// Components attached to the entity, owned by the entity and returned to
+	// their pools when it is destroyed
 	ComponentArr components_;
 	// Bitset to determine which components an entity owns
+	std::bitset<static_cast<size_t>(ComponentTypes::MAX)> component_mask_;
+	// Index into components_ of each owned component, by ComponentTypes
+	std::array<uint8_t, static_cast<size_t>(ComponentTypes::MAX)> component_index_;
 	// Unique ID of an entity (Begins at 1)
 	EntityID object_id_;
+	// Name of the archetype the entity was cloned from
+	NameID archetype_id_;
+
+/******************************************************************************/
+/*!
+  \fn IndexComponents()
+
+  \brief Rebuilds the component bitset and index table after components_
+		 changes
+*/
+/******************************************************************************/
+	void IndexComponents();
 
 /******************************************************************************/
 /*!
@@ -64,6 +84,10 @@ public:
 	friend class EntityFactory;
 	friend class EntityManager;
 
+	// Copies would return the same components to their pools twice
+	Entity(const Entity&) = delete;
+	Entity& operator=(const Entity&) = delete;
+
 /******************************************************************************/
 /*!
   \fn GetComponentArr()
@@ -81,17 +105,18 @@ public:
 		 otherwise a nullptr will be returned
 */
 /******************************************************************************/
-	std::shared_ptr<Component> GetComponent(ComponentTypes type_id);
+	Component* GetComponent(ComponentTypes type_id);
 
 /******************************************************************************/
 /*!
   \fn GetComponentType()
 
-  \brief A version of GetComponent that returns a dynamic_cast component
+  \brief A version of GetComponent that returns the component as its type.
+		 id must be the type id of return_type, it is not checked at runtime
 */
 /******************************************************************************/
 	template <typename return_type>
-	std::shared_ptr<return_type> GetComponentType(ComponentTypes id);
+	return_type* GetComponentType(ComponentTypes id) { return static_cast<return_type*>(GetComponent(id)); }
 
 /******************************************************************************/
 /*!
@@ -129,7 +154,7 @@ public:
   \brief Adds a component to the current entity
 */
 /******************************************************************************/
-	void AddComponent(ComponentTypes typeId, std::shared_ptr<Component> component);
+	void AddComponent(ComponentTypes typeId, Component* component);
 
 /******************************************************************************/
 /*!
@@ -167,6 +192,16 @@ public:
 /******************************************************************************/
 	EntityID GetID() { return object_id_; };
 
+/******************************************************************************/
+/*!
+  \fn GetArchetypeID()
+
+  \brief Returns the name of the archetype the entity was cloned from, or
+		 NameTable::invalid_ if it was not cloned from one
+*/
+/******************************************************************************/
+	NameID GetArchetypeID() const { return archetype_id_; }
+
 /******************************************************************************/
 /*!
   \fn GetType()
@@ -186,7 +221,14 @@ public:
 /******************************************************************************/
 	Entity* Clone();
 
-	void RemoveComponent(std::shared_ptr<Component> component);
+/******************************************************************************/
+/*!
+  \fn RemoveComponent()
+
+  \brief Detaches a component from the entity and destroys it
+*/
+/******************************************************************************/
+	void RemoveComponent(Component* component);
 
 };
 
@@ -202,6 +244,6 @@ ComponentTypes StringToComponentType(const std::string str);
 
 
 //Assumes that name component is a guaranteed component for every entity
-#define ENTITYNAME(ref) std::dynamic_pointer_cast<Name>(ref->GetComponent(ComponentTypes::NAME))->GetEntityName()
+#define ENTITYNAME(ref) ref->GetComponentType<Name>(ComponentTypes::NAME)->GetEntityName()
 
 #endif
\ No newline at end of file
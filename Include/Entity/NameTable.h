@@ -0,0 +1,66 @@
+/**********************************************************************************
+*\file         NameTable.h
+*\brief        Contains declaration of functions and variables used for
+*			   interning entity and archetype names
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _NAME_TABLE_H_
+#define _NAME_TABLE_H_
+
+#include <cstdint>
+#include <string>
+
+using NameID = uint32_t;
+
+/******************************************************************************/
+/*!
+	\class NameTable
+
+	\brief Gives every distinct name a small integer id, so names can be
+		   compared and used as keys without comparing strings. Ids are
+		   never reused while the game runs
+*/
+/******************************************************************************/
+class NameTable {
+
+public:
+
+	static constexpr NameID invalid_ = UINT32_MAX;
+
+/******************************************************************************/
+/*!
+	\fn Intern(const std::string& name)
+
+	\brief Returns the id of name, adding it if it has none yet
+*/
+/******************************************************************************/
+	static NameID Intern(const std::string& name);
+
+/******************************************************************************/
+/*!
+	\fn Find(const std::string& name)
+
+	\brief Returns the id of name, or invalid_ if it was never interned
+*/
+/******************************************************************************/
+	static NameID Find(const std::string& name);
+
+/******************************************************************************/
+/*!
+	\fn GetString(NameID id)
+
+	\brief Returns the name of an id
+*/
+/******************************************************************************/
+	static const std::string& GetString(NameID id);
+};
+
+#endif
@@ -78,6 +78,16 @@ public:
 /******************************************************************************/
 	void SetStatus(std::string entity_name, StatusType status_type, float status_length, Game* game);
 
+/******************************************************************************/
+/*!
+  \fn RestoreSnapshot()
+
+  \brief Replaces the world with the snapshot saved in a slot and rebuilds
+		 the data the systems keep about it, like after a level load
+*/
+/******************************************************************************/
+	void RestoreSnapshot(const std::string& slot);
+
 /******************************************************************************/
 /*!
   \fn StateInputHandler()
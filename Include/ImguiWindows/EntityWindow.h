@@ -174,12 +174,12 @@ public:
 /******************************************************************************/
 /*!
 	\fn RemoveComponent(const char* windowName, std::string objName, Entity* entity, 
-		std::shared_ptr<Component> component)
+		Component* component)
 
 	\brief Remove the chosen component from the specific archetype
 */
 /******************************************************************************/
-	void RemoveComponent(const char* windowName, std::string objName, Entity* entity, std::shared_ptr<Component> component);
+	void RemoveComponent(const char* windowName, std::string objName, Entity* entity, Component* component);
 
 /******************************************************************************/
 /*!
@@ -28,17 +28,29 @@ class AMap : public IManager
 	struct node
 	{
 		Vector2D nodepos_;
-		float F, G, H;
 
-		bool start_;
-		bool des_;
 		bool obstacle_;
-		bool visited_;
-		bool path_;
-		node* parent_;
 		std::vector<node*> neighbour_;
 	};
 
+	// Per search costs of a node, kept outside the map so searches do not
+	// write to the shared nodes
+	struct search_node
+	{
+		float F = 0.0f, G = 0.0f, H = 0.0f;
+
+		bool open_ = false;
+		bool closed_ = false;
+		const node* parent_ = nullptr;
+	};
+
+	// Entry of the open list, holds the costs the node had when it was opened
+	struct open_node
+	{
+		const node* node_;
+		float F, H;
+	};
+
 public:
 
 	using AMapTypeX = std::vector<node>;
@@ -84,39 +96,22 @@ public:
 
 	/******************************************************************************/
 	/*!
-	  \fn DrawMap()
-
-	  \brief Draw AMap in the console
-	*/
-	/******************************************************************************/
-	void DrawMap();
-	
-	/******************************************************************************/
-	/*!
-	  \fn InitializeNodes()
-
-	  \brief Initialize nodes
-	*/
-	/******************************************************************************/
-	void InitializeNodes();
-
-	/******************************************************************************/
-	/*!
-	  \fn inlist()
+	  \fn DrawMap(const std::vector<Vector2D>& path)
 
-	  \brief Return if in list
+	  \brief Draw AMap in the console, marking the nodes of path
 	*/
 	/******************************************************************************/
-	bool inlist(std::list<node> L, node N);
+	void DrawMap(const std::vector<Vector2D>& path = {}) const;
 
 	/******************************************************************************/
 	/*!
 	  \fn Pathing(std::vector<Vector2D>& path, Vector2D start, Vector2D des)
 
-	  \brief Finds viable paths from start to destination
+	  \brief Finds viable paths from start to destination. Does not modify the
+			 map, so several threads may search it at the same time
 	*/
 	/******************************************************************************/
-	bool Pathing(std::vector<Vector2D>& path, Vector2D start, Vector2D des);
+	bool Pathing(std::vector<Vector2D>& path, Vector2D start, Vector2D des) const;
 
 	/******************************************************************************/
 	/*!
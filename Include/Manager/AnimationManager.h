@@ -20,6 +20,9 @@
 
 class Animation {
 
+	// Frames are rewritten when the animation set is packed into an atlas
+	friend class AnimationManager;
+
 	int num_frames_;
 	GLuint animation_frames_;
 	GLfloat frame_duration_;
@@ -113,8 +116,10 @@ public:
 
 class AnimationSet {
 
+	friend class AnimationManager;
+
 	GLuint animation_frames_;
-	std::vector<std::pair<std::string, int>>* animation_names_frames_;
+	std::vector<std::pair<std::string, int>> animation_names_frames_;
 
 public:
 
@@ -130,14 +135,23 @@ public:
 /******************************************************************************/
 /*!
 	\fn AnimationSet(GLuint animation_frames,
-					 std::vector<std::pair<std::string, int>>* animation_names)
+					 std::vector<std::pair<std::string, int>> animation_names)
 
 	\brief Constructor for AnimationSet that initializes all its data members
 		   according to the respective values
 */
 /******************************************************************************/
 	AnimationSet(GLuint animation_frames,
-				 std::vector<std::pair<std::string, int>>* animation_names);
+				 std::vector<std::pair<std::string, int>> animation_names);
+
+/******************************************************************************/
+/*!
+	\fn GetAnimationFramesHandle()
+
+	\brief Gets the handle of the texture holding every frame of the set
+*/
+/******************************************************************************/
+	GLuint GetAnimationFramesHandle();
 
 /******************************************************************************/
 /*!
@@ -178,6 +192,15 @@ public:
 /******************************************************************************/
 void AnimationBatchLoad(std::string level_name);
 
+/******************************************************************************/
+/*!
+	\fn LoadAnimationSet(std::string path_name)
+
+	\brief Loads the animation set described by a file and returns its name
+*/
+/******************************************************************************/
+	std::string LoadAnimationSet(std::string path_name);
+
 /******************************************************************************/
 /*!
 	\fn CreateAnimation(const char* filename,
@@ -200,13 +223,13 @@ void AnimationBatchLoad(std::string level_name);
 
 /******************************************************************************/
 /*!
-	\fn UnloadAnimationSet(std::vector<std::pair<std::string, int>>* animation_name)
+	\fn UnloadAnimationSet(std::string animation_set_name)
 
 	\brief Unloads an image file, deletes and removes all the animations that the
 		   file contains from the Animation Manager's map.
 */
 /******************************************************************************/
-	bool UnloadAnimationSet(std::vector<std::pair<std::string, int>>* animation_name);
+	bool UnloadAnimationSet(std::string animation_set_name);
 
 /******************************************************************************/
 /*!
@@ -227,6 +250,16 @@ void AnimationBatchLoad(std::string level_name);
 /******************************************************************************/
 	Animation GetAnimation(std::string animation_name);
 
+/******************************************************************************/
+/*!
+	\fn GetAnimationSet(std::string animation_set_name)
+
+	\brief Gets an animation set from the Animation Manager's map, or nullptr
+		   if it is not loaded
+*/
+/******************************************************************************/
+	AnimationSet* GetAnimationSet(std::string animation_set_name);
+
 /******************************************************************************/
 /*!
 	\fn ChangeAnimationFrameDuration(std::string animation_name,
@@ -0,0 +1,228 @@
+/**********************************************************************************
+*\file         AssetRegistry.h
+*\brief        Contains declaration of functions and variables used for
+*			   the Asset Registry
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _ASSET_REGISTRY_H_
+#define _ASSET_REGISTRY_H_
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Manager/IManager.h"
+
+class TextureManager;
+class AnimationManager;
+class FontManager;
+class SoundSystem;
+
+/******************************************************************************/
+/*!
+	\class AssetRegistry
+
+	\brief Counts the levels using each tileset, animation set, font and sound,
+		   as listed by the manifests in "Resources/AssetsLoading". An asset
+		   is loaded when the first level needing it is entered, and one no
+		   level needs stays loaded, least recently used first out, until the
+		   loaded assets go over the memory budget
+*/
+/******************************************************************************/
+class AssetRegistry : public IManager {
+
+public:
+
+	enum class AssetType {
+
+		TILESET,
+		ANIMATION_SET,
+		FONT,
+		SOUND
+	};
+
+private:
+
+	struct Asset {
+
+		AssetType type_;
+		// Name in its manifest, the path of its file for an animation set
+		std::string name_;
+		// Name it is loaded under by its manager
+		std::string loaded_name_;
+		// What follows the name in its manifest
+		std::string source_;
+		size_t size_;
+		int references_;
+		bool resident_;
+		// Never unloaded, such as anything packed into the start up atlas
+		bool pinned_;
+		bool unused_;
+		std::list<Asset*>::iterator unused_it_;
+	};
+
+	std::map<std::pair<AssetType, std::string>, Asset> assets_;
+	std::unordered_map<std::string, std::vector<Asset*>> manifests_;
+	// Manifests of each level, by the name the level is loaded by
+	std::unordered_map<std::string, std::vector<std::string>> levels_;
+
+	std::vector<std::string> levels_held_;
+	std::vector<std::string> levels_leaving_;
+
+	// Assets no level needs, the least recently used at the front
+	std::list<Asset*> unused_;
+	size_t resident_size_;
+	size_t budget_;
+
+	TextureManager* texture_manager_;
+	AnimationManager* animation_manager_;
+	FontManager* font_manager_;
+	SoundSystem* sound_system_;
+
+/******************************************************************************/
+/*!
+	\fn GetManifest(const std::string& manifest)
+
+	\brief Gets the assets listed by a manifest, reading it the first time.
+		   The type of the assets follows the name of the manifest, sounds
+		   for one without a "_texture", "_animation" or "_font" suffix
+*/
+/******************************************************************************/
+	const std::vector<Asset*>& GetManifest(const std::string& manifest);
+
+/******************************************************************************/
+/*!
+	\fn Acquire(Asset& asset)
+
+	\brief Adds a level using an asset, loading it if it is not loaded
+*/
+/******************************************************************************/
+	void Acquire(Asset& asset);
+
+/******************************************************************************/
+/*!
+	\fn Release(Asset& asset)
+
+	\brief Removes a level using an asset, which is kept loaded as the most
+		   recently used of the unused assets once no level uses it
+*/
+/******************************************************************************/
+	void Release(Asset& asset);
+
+/******************************************************************************/
+/*!
+	\fn Load(Asset& asset)
+
+	\brief Loads an asset through its manager and records its size
+*/
+/******************************************************************************/
+	void Load(Asset& asset);
+
+/******************************************************************************/
+/*!
+	\fn Unload(Asset& asset)
+
+	\brief Unloads an asset through its manager
+*/
+/******************************************************************************/
+	void Unload(Asset& asset);
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn AssetRegistry()
+
+	\brief Constructor for the Asset Registry
+*/
+/******************************************************************************/
+	AssetRegistry();
+
+/******************************************************************************/
+/*!
+	\fn Init()
+
+	\brief Initializes the Asset Registry and reads the manifests of each level
+		   and the memory budget from "Resources/AssetsLoading/levels.json"
+*/
+/******************************************************************************/
+	void Init() override;
+
+/******************************************************************************/
+/*!
+	\fn Pin(const std::string& manifest)
+
+	\brief Loads every asset of a manifest for the rest of the game
+*/
+/******************************************************************************/
+	void Pin(const std::string& manifest);
+
+/******************************************************************************/
+/*!
+	\fn BeginTransition()
+
+	\brief Marks the levels held so far as left. Their assets are only released
+		   by EndTransition, after the levels entered in between acquired theirs
+*/
+/******************************************************************************/
+	void BeginTransition();
+
+/******************************************************************************/
+/*!
+	\fn AcquireLevel(const std::string& level_name)
+
+	\brief Acquires the assets of a level, loading only those not loaded yet.
+		   A level already held is not acquired again
+*/
+/******************************************************************************/
+	void AcquireLevel(const std::string& level_name);
+
+/******************************************************************************/
+/*!
+	\fn EndTransition()
+
+	\brief Releases the assets of the levels left and unloads unused assets
+		   until the loaded assets fit the budget
+*/
+/******************************************************************************/
+	void EndTransition();
+
+/******************************************************************************/
+/*!
+	\fn Trim()
+
+	\brief Unloads the least recently used of the unused assets until the
+		   loaded assets that are not pinned fit the budget
+*/
+/******************************************************************************/
+	void Trim();
+
+/******************************************************************************/
+/*!
+	\fn SetBudget(size_t budget)
+
+	\brief Sets the bytes the loaded assets that are not pinned may take
+*/
+/******************************************************************************/
+	void SetBudget(size_t budget);
+
+/******************************************************************************/
+/*!
+	\fn GetResidentSize()
+
+	\brief Gets the bytes taken by the loaded assets that are not pinned
+*/
+/******************************************************************************/
+	size_t GetResidentSize() const;
+};
+
+#endif
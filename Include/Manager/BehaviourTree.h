@@ -14,207 +14,398 @@
 #define _BEHAVIOUR_TREE_H_
 
 #include <vector>
+#include <cstdint>
 #include "Manager/EntityManager.h"
 #include "Manager/AMap.h"
+#include "Manager/ForcesManager.h"
+#include "MathLib/Vector2D.h"
+#include "Systems/FrameRateController.h"
 #include <iostream>
 
+class AI;
+class Transform;
+class Motion;
+class AnimationRenderer;
+class PointLight;
+class ConeLight;
+class Status;
+class GraphicsSystem;
+
 /******************************************************************************/
 /*!
   \class Behaviour
 
-  \brief Class containing multiple behaviour tree node classes
+  \brief Flattened behaviour tree runtime. A tree shape is compiled once into
+		 a contiguous array of nodes that is shared by every agent using it,
+		 each agent only carries its own blackboard
 */
 /******************************************************************************/
 class Behaviour
 {
 public:
+
+	// Composite nodes run their children in order, an action runs a leaf function
+	enum class NodeType : uint8_t
+	{
+		Sequence,
+		Selector,
+		Inverter,
+		Action
+	};
+
+	// Destinations remembered by the path finding leaves, one per leaf instance
+	enum DestinationSlot : uint8_t
+	{
+		SentrySlot,
+		PatrolSlot,
+		ChaseSlot,
+		SlotCount
+	};
+
+	// Tick level of detail, agents further from the player are ticked less often
+	enum TickLod : uint8_t
+	{
+		NearLod,
+		MidLod,
+		FarLod,
+		LodCount
+	};
+
+	struct Node;
+	struct Agent;
+	struct Context;
+
+	// Leaf behaviour, reads the agent's blackboard and the shared tick context
+	using Action = bool(*)(Agent& agent, const Context& context, const Node& node);
+
+	// Optional response of a tree type upon ai collision
+	using CollisionAction = void(*)(Agent& agent, EntityID obj);
+
+	/******************************************************************************/
+	/*!
+	  \struct Node
+
+	  \brief Node of a compiled tree. Children of a composite are stored directly
+			 after it, end_ is the index one past the composite's last descendant
+	*/
+	/******************************************************************************/
+	struct Node
+	{
+		Action action_;
+		float param_;
+		uint16_t end_;
+		DestinationSlot slot_;
+		NodeType type_;
+	};
+
+	/******************************************************************************/
+	/*!
+	  \struct Blackboard
+
+	  \brief Per agent state that was previously spread across the node objects
+	*/
+	/******************************************************************************/
+	struct Blackboard
+	{
+		AI* ai_;
+		Transform* transform_;
+		Motion* motion_;
+		AnimationRenderer* renderer_;
+		PointLight* point_light_;
+		ConeLight* cone_light_;
+
+		// Whether every component required by the animation leaves exists
+		bool animated_;
+
+		Vector2D destination_[SlotCount];
+		Time_Channel respawn_timer_;
+	};
+
 	/******************************************************************************/
 	/*!
-	  \class Node
-	
-	  \brief Interface Node for all behaviour tree nodes
+	  \struct Agent
+
+	  \brief Per entity data ticked by a shared tree
+	*/
+	/******************************************************************************/
+	struct Agent
+	{
+		EntityID id_;
+		Blackboard board_;
+
+		// Last leaf reached during the previous tick
+		uint16_t cursor_;
+
+		// Current level of detail
+		TickLod lod_;
+
+		// Step of the last tick, and the time since it when ticked. A due tick
+		// skipped to stay within the tick budget leaves a longer gap
+		uint32_t last_tick_;
+		float tick_delta_;
+	};
+
+	/******************************************************************************/
+	/*!
+	  \class Commands
+
+	  \brief Side effects of the leaves on shared systems. When ticking on the
+			 main thread they are executed immediately, when ticking on worker
+			 threads they are recorded and executed later by Flush
 	*/
 	/******************************************************************************/
-	class Node {
+	class Commands
+	{
+		enum class Type : uint8_t
+		{
+			AddForce,
+			ChangeAnimation,
+			FlipTexture,
+			PlayBGM,
+			FindPath
+		};
+
+		struct Command
+		{
+			Type type_;
+			EntityID id_;
+			ForcesManager::ForceID force_;
+			float age_;
+			Vector2D a_;
+			Vector2D b_;
+			const char* name_;
+			AnimationRenderer* renderer_;
+			AI* ai_;
+		};
+
+		std::vector<Command> commands_;
+		bool deferred_;
+
+		GraphicsSystem* graphics_;
+		ForcesManager* forces_;
+		AMap* map_;
+
+		/******************************************************************************/
+		/*!
+		  \fn Execute()
+
+		  \brief Executes a single command, returns the result of path requests
+		*/
+		/******************************************************************************/
+		bool Execute(const Command& command);
+
 	public:
+
 		/******************************************************************************/
 		/*!
-		  \fn run()
-		
-		  \brief Virtual run for derived classes
+		  \fn Commands()
+
+		  \brief Constructor for an unbound, immediate buffer
 		*/
 		/******************************************************************************/
-		virtual bool run() = 0;
+		Commands();
+
 		/******************************************************************************/
 		/*!
-		  \fn ~Node()
+		  \fn Bind()
 
-		  \brief Virtual destructor for derived classes
+		  \brief Sets the systems the commands are executed on
 		*/
 		/******************************************************************************/
-		virtual ~Node() = default;
-	};
+		void Bind(GraphicsSystem* graphics, ForcesManager* forces, AMap* map);
 
-	/******************************************************************************/
-	/*!
-	  \class CompositeNode
-	
-	  \brief Composite Node, Node that contains multiple children
-	*/
-	/******************************************************************************/
-	class CompositeNode : public Node {
-		std::vector<Node*> children;
-	public:
 		/******************************************************************************/
 		/*!
-		  \fn getChildren()
+		  \fn SetDeferred()
 
-		  \brief Returns Nodes children
+		  \brief Sets whether commands are recorded instead of executed
 		*/
 		/******************************************************************************/
-		const std::vector<Node*>& getChildren() const;
+		void SetDeferred(bool deferred) { deferred_ = deferred; }
+
 		/******************************************************************************/
 		/*!
-		  \fn addChild(Node* child)
+		  \fn AddForce()
 
-		  \brief Adds a child node into the back of the children list
+		  \brief Adds a force to an entity through the ForcesManager
 		*/
 		/******************************************************************************/
-		void addChild(Node* child);
+		void AddForce(EntityID id, ForcesManager::ForceID force, float age, const Vector2D& direction);
+
 		/******************************************************************************/
 		/*!
-		  \fn ~CompositeNode()
+		  \fn ChangeAnimation()
 
-		  \brief Destructor for Composite nodes
+		  \brief Changes the animation of a renderer, name must outlive the buffer
 		*/
 		/******************************************************************************/
-		~CompositeNode();
-	};
+		void ChangeAnimation(AnimationRenderer* renderer, const char* name);
 
-	/******************************************************************************/
-	/*!
-	  \class Selector
-	
-	  \brief Selector Node, Checks children for succesful outcome, if one child is 
-		succesful, returns succesful, if not checks next child, returns fail 
-		if all children fail
-	*/
-	/******************************************************************************/
-	class Selector : public CompositeNode {
-	public:
 		/******************************************************************************/
 		/*!
-		  \fn run()
+		  \fn FlipTexture()
+
+		  \brief Flips the texture of a renderer along the y axis
+		*/
+		/******************************************************************************/
+		void FlipTexture(AnimationRenderer* renderer);
+
+		/******************************************************************************/
+		/*!
+		  \fn PlayBGM()
+
+		  \brief Broadcasts a request to play a sound, name must outlive the buffer
+		*/
+		/******************************************************************************/
+		void PlayBGM(const char* name);
+
+		/******************************************************************************/
+		/*!
+		  \fn FindPath()
+
+		  \brief Finds a path from start to des into the AI's path and returns
+				 the result of the search. It is never recorded, deferred
+				 buffers search the map at the same time
+		*/
+		/******************************************************************************/
+		bool FindPath(AI* ai, const Vector2D& start, const Vector2D& des);
+
+		/******************************************************************************/
+		/*!
+		  \fn Flush()
 
-		  \brief Returns successful should one child succeed
+		  \brief Executes the recorded commands in the order they were recorded
 		*/
 		/******************************************************************************/
-		bool run() override;
+		void Flush();
 	};
 
 	/******************************************************************************/
 	/*!
-	  \class Sequence
+	  \struct Context
 
-	  \brief Sequence Node, Checks children for succesful outcome, if one child
-		fails, returns failure, if not checks next child, returns success
-		if all children succeed
+	  \brief Data shared by every agent for a single tick, resolved once per
+			 update instead of once per node
 	*/
 	/******************************************************************************/
-	class Sequence : public CompositeNode {
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn run()
+	struct Context
+	{
+		Commands* commands_;
+		ForcesManager::ForceID movement_force_;
 
-		  \brief Returns failure should one child fail
-		*/
-		/******************************************************************************/
-		bool run() override;
+		EntityID player_id_;
+		Status* player_status_;
+		Transform* player_transform_;
 	};
 
 	/******************************************************************************/
 	/*!
-	  \class Root
+	  \class Tree
 
-	  \brief Root Node, A starting node that points to one child
+	  \brief A compiled tree shape. Built once through Open/Leaf/Close and then
+			 ticked for any number of agents
 	*/
 	/******************************************************************************/
-	class Root : public Node
+	class Tree
 	{
-		Node* child;
-	public:
+		std::vector<Node> nodes_;
+		std::vector<uint16_t> open_;
+		CollisionAction collision_;
+
 		/******************************************************************************/
 		/*!
-		  \fn setChild(Node* newchild)
+		  \fn Run()
 
-		  \brief Sets the child node
+		  \brief Runs the node at index and returns its result
 		*/
 		/******************************************************************************/
-		void setChild(Node* newchild);
+		bool Run(uint16_t index, Agent& agent, const Context& context) const;
+
+	public:
+
 		/******************************************************************************/
 		/*!
-		  \fn run()
+		  \fn Tree()
 
-		  \brief Runs child node
+		  \brief Constructor for an empty tree
 		*/
 		/******************************************************************************/
-		bool run() override;
+		Tree();
+
 		/******************************************************************************/
 		/*!
-		  \fn CollisionResponse(EntityID obj)
+		  \fn Open()
 
-		  \brief Virtual response upon ai collision
+		  \brief Appends a composite node, following nodes become its children
+				 until the matching Close
 		*/
 		/******************************************************************************/
-		virtual void CollisionResponse(EntityID obj) = 0;
+		void Open(NodeType type);
+
 		/******************************************************************************/
 		/*!
-		  \fn ~Root()
+		  \fn Leaf()
 
-		  \brief Deletes child
+		  \brief Appends an action node to the currently open composite
 		*/
 		/******************************************************************************/
-		~Root() { delete child; }
-	};
+		void Leaf(Action action, float param = 0.0f, DestinationSlot slot = SentrySlot);
 
-	/******************************************************************************/
-	/*!
-	  \class Inverter
+		/******************************************************************************/
+		/*!
+		  \fn Close()
+
+		  \brief Closes the most recently opened composite
+		*/
+		/******************************************************************************/
+		void Close();
 
-	  \brief Inverter Node, Inverts output of child
-	*/
-	/******************************************************************************/
-	class Inverter :public Node
-	{
-		Node* child;
-	public:
 		/******************************************************************************/
 		/*!
-		  \fn setChild(Node* newchild)
+		  \fn SetCollisionAction()
 
-		  \brief Sets the child node
+		  \brief Sets the response of the tree upon ai collision
 		*/
 		/******************************************************************************/
-		void setChild(Node* newchild);
+		void SetCollisionAction(CollisionAction action) { collision_ = action; }
+
 		/******************************************************************************/
 		/*!
-		  \fn run()
+		  \fn CollisionResponse()
 
-		  \brief Runs child node with inverted result
+		  \brief Runs the collision response of the tree for an agent, if any
 		*/
 		/******************************************************************************/
-		bool run() override;
+		void CollisionResponse(Agent& agent, EntityID obj) const;
+
 		/******************************************************************************/
 		/*!
-		  \fn ~Inverter()
+		  \fn Tick()
 
-		  \brief Deletes child
+		  \brief Runs the tree from the root for an agent
 		*/
 		/******************************************************************************/
-		~Inverter() { delete child; }
+		bool Tick(Agent& agent, const Context& context) const;
+
+		/******************************************************************************/
+		/*!
+		  \fn Size()
 
+		  \brief Returns the number of nodes in the tree
+		*/
+		/******************************************************************************/
+		size_t Size() const { return nodes_.size(); }
 	};
+
+	/******************************************************************************/
+	/*!
+	  \fn BindAgent()
+
+	  \brief Resolves the components an agent's leaves use and resets its
+			 blackboard
+	*/
+	/******************************************************************************/
+	static void BindAgent(Agent& agent, EntityID id);
 };
 
-#endif
\ No newline at end of file
+#endif
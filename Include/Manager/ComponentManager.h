@@ -97,6 +97,15 @@ public:
 /******************************************************************************/
 	void AddComponent(EntityID id, T* component);
 
+/******************************************************************************/
+/*!
+  \fn Reserve()
+
+  \brief Makes room in the Type component map for count more components
+*/
+/******************************************************************************/
+	void Reserve(size_t count);
+
 /******************************************************************************/
 /*!
   \fn RemoveComponent()
@@ -237,6 +246,16 @@ public:
 	template <typename T>
 	void RemoveComponent(EntityID id);
 
+/******************************************************************************/
+/*!
+  \fn Reserve()
+
+  \brief Makes room for count more components of the same type as component
+		 in the coresponding CMap
+*/
+/******************************************************************************/
+	void Reserve(Component* component, size_t count);
+
 /******************************************************************************/
 /*!
   \fn ~CManager()
@@ -289,6 +308,11 @@ void CMap<T>::AddComponent(EntityID id, T* component) {
 	component_map_.emplace(id, component);
 }
 
+template <typename T>
+void CMap<T>::Reserve(size_t count) {
+	component_map_.reserve(component_map_.size() + count);
+}
+
 template <typename T>
 void CMap<T>::RemoveComponent(EntityID id) {
 
@@ -342,6 +366,7 @@ void CManager<Ts...>::AddComponentCreator(std::string name, IComponentCreator* c
 	DEBUG_ASSERT((component_creator_arr_.find(name) == component_creator_arr_.end()), "Component creator already exists");
 
 	component_creator_arr_[name] = creator;
+	creator->GetPool()->SetName(name);
 }
 
 template <typename... Ts>
@@ -386,6 +411,12 @@ void CManager<Ts...>::RemoveComponent(EntityID id) {
 	CMap<T>::RemoveComponent(id);
 }
 
+template <typename... Ts>
+void CManager<Ts...>::Reserve(Component* component, size_t count) {
+	// Only the CMap of the component's own type grows
+	((dynamic_cast<Ts*>(component) ? CMap<Ts>::Reserve(count) : void()), ...);
+}
+
 template <typename... Ts>
 CManager<Ts...>::~CManager() {
 
@@ -123,15 +123,6 @@ public:
 /******************************************************************************/
 	void LoadDialogue(std::string dialogue_name, std::string path);
 
-/******************************************************************************/
-/*!
-  \fn DeserializeJSON()
-
-  \brief Parse data
-*/
-/******************************************************************************/
-	void DeserializeJSON(const std::string& filename, rapidjson::Document& doc);
-
 /******************************************************************************/
 /*!
   \fn GetDialogue()
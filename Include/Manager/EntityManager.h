@@ -19,10 +19,22 @@
 #include <set>
 #include <map>
 #include <memory>
+#include <functional>
+#include <vector>
 
 #include "Entity/Entity.h"
+#include "Entity/NameTable.h"
 #include "Manager/IManager.h"
 
+// Ids of entities created in one batch, which are consecutive
+struct EntityIDRange {
+
+	EntityID begin_;
+	EntityID end_;
+
+	size_t Size() const { return end_ - begin_; }
+};
+
 class EntityManager : public IManager
 {
 public:
@@ -90,6 +102,18 @@ public:
 /******************************************************************************/
 	Entity* CloneArchetype(const std::string& archetype_name);
 
+/******************************************************************************/
+/*!
+  \fn InstantiateArchetype()
+
+  \brief Clones count entities of an archetype at once. The component pools
+		 and maps grow once for the batch. initializer is then called on
+		 each entity with its index
+*/
+/******************************************************************************/
+	EntityIDRange InstantiateArchetype(const std::string& archetype_name, size_t count,
+									   const std::function<void(Entity*, size_t)>& initializer = {});
+
 /******************************************************************************/
 /*!
   \fn StoreEntityID()
@@ -153,6 +177,25 @@ public:
 */
 /******************************************************************************/
 	EntityIdMapType& GetEntities();
+
+/******************************************************************************/
+/*!
+  \fn GetLastEntityID()
+
+  \brief Returns the id given to the most recently created entity
+*/
+/******************************************************************************/
+	EntityID GetLastEntityID() const { return last_entity_id_; }
+
+/******************************************************************************/
+/*!
+  \fn SetLastEntityID()
+
+  \brief Sets the id the next created entities are numbered after, so
+		 restored entities keep the ids they were saved with
+*/
+/******************************************************************************/
+	void SetLastEntityID(EntityID id) { last_entity_id_ = id; }
 	
 
 /******************************************************************************/
@@ -164,6 +207,33 @@ public:
 /******************************************************************************/
 	void SortPlayerEntities();
 
+/******************************************************************************/
+/*!
+  \fn AddNamedEntity()
+
+  \brief Adds an entity to the set of entities with the same name
+*/
+/******************************************************************************/
+	void AddNamedEntity(NameID name, Entity* entity);
+
+/******************************************************************************/
+/*!
+  \fn RemoveNamedEntity()
+
+  \brief Removes an entity from the set of entities with the same name
+*/
+/******************************************************************************/
+	void RemoveNamedEntity(NameID name, Entity* entity);
+
+/******************************************************************************/
+/*!
+  \fn GetNamedEntities()
+
+  \brief Retrieves the entities with a name, ordered by id
+*/
+/******************************************************************************/
+	const EntityIdMapType& GetNamedEntities(NameID name) const;
+
 /******************************************************************************/
 /*!
   \fn DeleteEntity()
@@ -240,6 +310,9 @@ private:
 	size_t last_entity_id_;
 	Entity* player_ptr_;
 	EntityIdMapType entity_id_map_;
+	// Entities by the interned name of their Name component
+	std::vector<EntityIdMapType> named_entities_;
+	NameID player_name_;
 	EntityIDSetDelete entities_to_delete_;
 	EntityArchetypeMapType entity_archetype_map_;
 	EntityIDSetDelete archetypes_to_delete_;
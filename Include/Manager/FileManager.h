@@ -0,0 +1,89 @@
+/**********************************************************************************
+*\file         FileManager.h
+*\brief        Contains declaration of functions and variables used for
+*			   the File Manager
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _FILE_MANAGER_H_
+#define _FILE_MANAGER_H_
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Manager/IManager.h"
+#include "../rapidjson/document.h"
+
+class FileManager : public IManager {
+
+	// Parsed in place, so the document's strings point into the buffer
+	struct JSONFile {
+
+		std::vector<char> buffer_;
+		rapidjson::Document doc_;
+		std::filesystem::file_time_type write_time_;
+	};
+
+	std::unordered_map<std::string, std::unique_ptr<JSONFile>> json_files_;
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn Init()
+
+	\brief Initializes the File Manager
+*/
+/******************************************************************************/
+	void Init() override;
+
+/******************************************************************************/
+/*!
+	\fn ReadFile(const std::string& filename, std::vector<char>& buffer)
+
+	\brief Reads a whole file into buffer with a single read, followed by a
+		   null terminator. Returns false if the file cannot be opened
+*/
+/******************************************************************************/
+	bool ReadFile(const std::string& filename, std::vector<char>& buffer);
+
+/******************************************************************************/
+/*!
+	\fn GetJSON(const std::string& filename)
+
+	\brief Gets the parsed document of a JSON file. A file read again before
+		   ClearJSON is not read or parsed again unless it was written since
+*/
+/******************************************************************************/
+	const rapidjson::Document& GetJSON(const std::string& filename);
+
+/******************************************************************************/
+/*!
+	\fn ClearJSON()
+
+	\brief Releases every kept document. No document from GetJSON may still
+		   be in use
+*/
+/******************************************************************************/
+	void ClearJSON();
+};
+
+/******************************************************************************/
+/*!
+	\fn DeSerializeJSON(const std::string& filename)
+
+	\brief Gets the parsed document of a JSON file from the File Manager
+*/
+/******************************************************************************/
+const rapidjson::Document& DeSerializeJSON(const std::string& filename);
+
+#endif
@@ -18,6 +18,7 @@
 #include <glm/glm.hpp>
 #include <map>
 #include <string>
+#include <vector>
 #include <GL/glew.h>
 #include "Manager/IManager.h"
 #include <ft2build.h>
@@ -26,12 +27,22 @@
 #include "prettywriter.h"
 #include FT_FREETYPE_H
 
+// Vertex of a glyph quad, text of a whole layer is sent in one buffer
+struct GlyphVertex {
+
+    glm::vec2 position_;
+    glm::vec2 tex_coord_;
+    glm::vec3 color_;
+};
+
 class Character {
 
-    unsigned int textureID_;  // ID handle of the glyph texture
+    unsigned int textureID_;  // ID handle of the font's glyph atlas
     glm::ivec2   size_;       // Size of glyph
     glm::ivec2   bearing_;    // Offset from baseline to left/top of glyph
     unsigned int advance_;    // Offset to advance to next glyph
+    glm::vec2    uv_min_;     // Texture coordinates of the glyph's top left
+    glm::vec2    uv_max_;     // Texture coordinates of the glyph's bottom right
 
 public:
 
@@ -47,13 +58,14 @@ public:
 /******************************************************************************/
 /*!
     \fn Character(unsigned int textureID, glm::ivec2 size, glm::ivec2 bearing,
-                  unsigned int advance)
+                  unsigned int advance, glm::vec2 uv_min, glm::vec2 uv_max)
 
     \brief Constructor for character that initializes all its data members
 		   according to the respective values
 */
 /******************************************************************************/
-    Character(unsigned int textureID, glm::ivec2 size, glm::ivec2 bearing, unsigned int advance);
+    Character(unsigned int textureID, glm::ivec2 size, glm::ivec2 bearing, unsigned int advance,
+              glm::vec2 uv_min, glm::vec2 uv_max);
 
 /******************************************************************************/
 /*!
@@ -90,15 +102,37 @@ public:
 */
 /******************************************************************************/
     unsigned int GetAdvance();
+
+/******************************************************************************/
+/*!
+    \fn GetUVMin()
+
+    \brief Get texture coordinates of the top left of the character
+*/
+/******************************************************************************/
+    glm::vec2 GetUVMin();
+
+/******************************************************************************/
+/*!
+    \fn GetUVMax()
+
+    \brief Get texture coordinates of the bottom right of the character
+*/
+/******************************************************************************/
+    glm::vec2 GetUVMax();
     
 };
 
 class Font {
 
-    std::map<char, Character> characters_;
+    // Glyph metrics indexed by codepoint, every glyph shares one atlas texture
+    std::vector<Character> characters_;
+    GLuint atlas_handle_;
 
 public:
 
+    static constexpr size_t glyph_count_ = 128;
+
 /******************************************************************************/
 /*!
     \fn Font()
@@ -110,22 +144,32 @@ public:
 
 /******************************************************************************/
 /*!
-    \fn Font(std::map<char, Character> characters)
+    \fn Font(std::vector<Character> characters, GLuint atlas_handle)
 
     \brief Constructor for Font that initializes all its data members
 		   according to the respective values
 */
 /******************************************************************************/
-    Font(std::map<char, Character> characters);
+    Font(std::vector<Character> characters, GLuint atlas_handle);
+
+/******************************************************************************/
+/*!
+    \fn GetCharacter(char c)
+
+    \brief Gets the metrics of a character, characters outside of the font
+           are drawn as a space
+*/
+/******************************************************************************/
+    const Character& GetCharacter(char c) const;
 
 /******************************************************************************/
 /*!
-    \fn GetCharacters()
+    \fn GetAtlasHandle()
 
-    \brief Gets the characters within a font
+    \brief Gets the handle of the texture holding every glyph of the font
 */
 /******************************************************************************/
-    std::map<char, Character>* GetCharacters();
+    GLuint GetAtlasHandle() const;
 };
 
 
@@ -158,7 +202,8 @@ public:
 /*!
     \fn GetFont(std::string name)
 
-    \brief Gets font from the Font Manager's container
+    \brief Gets font from the Font Manager's container, nullptr if it is
+           not loaded
 */
 /******************************************************************************/
     Font* GetFont(std::string name);
@@ -174,21 +219,23 @@ public:
 
 /******************************************************************************/
 /*!
-    \fn FontBatchLoad(std::string level_name)
+    \fn UnloadFont(std::string font_name)
 
-    \brief Loads all fonts used for the level
+    \brief Deletes the atlas of a font and removes it from the Font Manager's
+           container. Returns false if the font is not loaded
 */
 /******************************************************************************/
-    void FontBatchLoad(std::string level_name);
+    bool UnloadFont(std::string font_name);
 
 /******************************************************************************/
 /*!
-    \fn DeSerializeJSON()
+    \fn FontBatchLoad(std::string level_name)
 
-    \brief Loads the content of a JSON file into a doc
+    \brief Loads all fonts used for the level
 */
 /******************************************************************************/
-    void DeSerializeJSON(const std::string& filename, rapidjson::Document& doc);
+    void FontBatchLoad(std::string level_name);
+
 };
 
 #endif
\ No newline at end of file
@@ -16,9 +16,12 @@
 #ifndef _FORCES_MANAGER_H_
 #define _FORCES_MANAGER_H_
 
-#include <map>
 #include <vector>
 #include <string>
+#include <queue>
+#include <functional>
+#include <unordered_map>
+#include <cstdint>
 #include "Entity/Entity.h"
 #include "MathLib/Vector2D.h"
 #include "Manager/IManager.h"
@@ -27,14 +30,20 @@
 class ForcesManager : public IManager
 {
 public:
+	// Interned force name, compared instead of the name string
+	using ForceID = uint32_t;
+	// Index of an entity's accumulator within the dense accumulator array
+	using ForceSlot = size_t;
+
+	static constexpr ForceSlot invalid_slot = static_cast<ForceSlot>(-1);
+
 	struct Force {
 
-		std::string name_;
-		float age_;
-		float lifespan_;
+		ForceID id_;
+		double expiry_;
 		Vector2D force_;
 
-		Force(const std::string& name, const float& lifespan, const Vector2D& force);
+		Force(const ForceID& id, const double& expiry, const Vector2D& force);
 	};
 
 	using ForceVec = std::vector<Force>;
@@ -42,19 +51,46 @@ public:
 
 	struct EntityForces {
 
+		EntityID owner_;
 		ForceVec vec_;
 		Vector2D sum_of_forces_;
 
-		bool VerifyForce(const std::string& name);
+		bool VerifyForce(const ForceID& id);
+	};
+
+	// Min-heap entry ordering forces by the time they expire
+	struct ForceExpiry {
+
+		double expiry_;
+		ForceSlot slot_;
+		ForceID id_;
+
+		bool operator>(const ForceExpiry& rhs) const { return expiry_ > rhs.expiry_; }
 	};
 
-	using ForceMapIt = std::map<EntityID, EntityForces>::iterator;
+	using ExpiryHeap = std::priority_queue<ForceExpiry, std::vector<ForceExpiry>, std::greater<ForceExpiry>>;
 
 private:
 	
-	std::map<EntityID, EntityForces> force_map_;
+	// Dense per-entity accumulators, slots stay stable until Purge()
+	std::vector<EntityForces> accumulators_;
+	std::unordered_map<EntityID, ForceSlot> slot_map_;
 
+	// Interned force names
+	std::unordered_map<std::string, ForceID> force_ids_;
 
+	ExpiryHeap expiry_heap_;
+	double clock_;
+
+/******************************************************************************/
+/*!
+	\fn GetSlot()
+
+	\brief Returns the accumulator slot of an entity, creating one if the entity
+		   has none. Newly created slots are cached in the entity's Motion
+*/
+/******************************************************************************/
+	ForceSlot GetSlot(EntityID id);
 
 public:
 
@@ -62,10 +98,20 @@ public:
 /*!
 	\fn ForcesManager()
 
-	\brief Default constructor for Texture
+	\brief Default constructor for ForcesManager
 */
 /******************************************************************************/
-	ForcesManager() = default;
+	ForcesManager();
+
+/******************************************************************************/
+/*!
+	\fn GetForceID()
+
+	\brief Interns a force name and returns its id, callers that add the same
+		   force every tick should resolve the id once and keep it
+*/
+/******************************************************************************/
+	ForceID GetForceID(const std::string& name);
 
 /******************************************************************************/
 /*!
@@ -73,9 +119,28 @@ public:
 
 	\brief Adds a Force to a vector of applied forces active on a Motion component
 */
+/******************************************************************************/
+	void AddForce(EntityID id, const ForceID& force_id, const float& lifespan, const Vector2D& force);
+
+/******************************************************************************/
+/*!
+	\fn AddForce()
+
+	\brief Adds a Force by name, the name is interned on every call
+*/
 /******************************************************************************/
 	void AddForce(EntityID id, const std::string& name, const float& lifespan, const Vector2D& force);
 
+/******************************************************************************/
+/*!
+	\fn FindSlot()
+
+	\brief Returns the accumulator slot of an entity, or invalid_slot if no
+		   force has been applied to it
+*/
+/******************************************************************************/
+	ForceSlot FindSlot(EntityID id);
+
 /******************************************************************************/
 /*!
 	\fn GetForce()
@@ -85,6 +150,16 @@ public:
 /******************************************************************************/
 	Vector2D GetForce(EntityID id);
 
+/******************************************************************************/
+/*!
+	\fn GetForce()
+
+	\brief Returns the force accumulated in a slot without any map lookup,
+		   returns a zero vector if the slot does not belong to the entity
+*/
+/******************************************************************************/
+	Vector2D GetForce(ForceSlot slot, EntityID id) const;
+
 /******************************************************************************/
 /*!
 	\fn Init()
@@ -16,6 +16,9 @@
 #ifndef _LOGIC_MANAGER_H_
 #define _LOGIC_MANAGER_H_
 #include <map>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
 #include "Entity/Entity.h"
 #include "Manager/IManager.h"
 #include "Systems/Debug.h"
@@ -39,10 +42,90 @@ using remove_cv = std::conditional_t<
 	T>;
 
 
+class LogicHandle
+{
+	// Function pointers of any signature round trip through this type
+	using ErasedFn = void(*)();
+
+	ErasedFn function_;
+
+#ifdef _DEBUG
+	// Signature the function was registered with, only checked in debug
+	const std::type_info* signature_;
+#endif
+
+public:
+
+	/******************************************************************************/
+	/*!
+		\fn LogicHandle()
+
+		\brief Default constructor for LogicHandle, an empty handle does nothing
+			   when executed
+	*/
+	/******************************************************************************/
+	LogicHandle() :
+		function_{ nullptr }
+#ifdef _DEBUG
+		, signature_{ nullptr }
+#endif
+	{}
+
+	/******************************************************************************/
+	/*!
+		\fn Create()
+
+		\brief Creates a handle to a function pointer
+	*/
+	/******************************************************************************/
+	template <typename... Args>
+	static LogicHandle Create(void(*function)(Args...)) {
+
+		LogicHandle handle{};
+		handle.function_ = reinterpret_cast<ErasedFn>(function);
+#ifdef _DEBUG
+		handle.signature_ = &typeid(void(*)(Args...));
+#endif
+		return handle;
+	}
+
+	/******************************************************************************/
+	/*!
+		\fn operator bool()
+
+		\brief Returns whether the handle is bound to a function
+	*/
+	/******************************************************************************/
+	explicit operator bool() const { return function_ != nullptr; }
+
+	/******************************************************************************/
+	/*!
+		\fn Exec()
+
+		\brief Executes the bound function through a plain indirect call, the
+			   params are deduced the same way as LogicManager::Exec
+	*/
+	/******************************************************************************/
+	template <typename... Args>
+	void Exec(Args&&... args) const {
+
+		if (!function_)
+			return;
+
+#ifdef _DEBUG
+		DEBUG_ASSERT(*signature_ == typeid(void(*)(remove_cv<Args>...)), "Function signature does not match!");
+#endif
+		reinterpret_cast<void(*)(remove_cv<Args>...)>(function_)(std::forward<Args>(args)...);
+	}
+};
+
 class LogicManager : public IManager
 {
 private:
 
+	// Type erased handles of every registered function, resolved once at bind time
+	std::unordered_map<std::string, LogicHandle> handles_;
+
 	template <typename... Args>
 	static inline std::map<std::string, void(*)(Args...)> logic_map_ = {};
 
@@ -62,6 +145,7 @@ private:
 
 		DEBUG_ASSERT(function, "Function is nullptr!");
 		logic_map_<remove_cv<Args>...>[name] = function;
+		handles_[name] = LogicHandle::Create(function);
 	}
 
 public:
@@ -83,6 +167,16 @@ public:
 	/******************************************************************************/
 	void Init() override;
 
+	/******************************************************************************/
+	/*!
+		\fn GetHandle()
+
+		\brief Returns a handle to the function registered under name, or an
+			   empty handle if no such function exists
+	*/
+	/******************************************************************************/
+	LogicHandle GetHandle(const std::string& name) const;
+
 	/******************************************************************************/
 	/*!
 		\fn Exec()
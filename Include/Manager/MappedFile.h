@@ -0,0 +1,134 @@
+/**********************************************************************************
+*\file         MappedFile.h
+*\brief        Contains declaration of functions and variables used for
+*			   reading cooked files through memory mapping
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+
+#ifndef _MAPPED_FILE_H_
+#define _MAPPED_FILE_H_
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+/******************************************************************************/
+/*!
+	\class MappedFile
+
+	\brief A read only file mapped into memory. Its contents are read straight
+		   from the mapped pages and stay valid until it is unmapped
+*/
+/******************************************************************************/
+class MappedFile {
+
+	void* file_;
+	void* mapping_;
+	const unsigned char* view_;
+	size_t size_;
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn MappedFile()
+
+	\brief Constructs a file that is not mapped yet
+*/
+/******************************************************************************/
+	MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+/******************************************************************************/
+/*!
+	\fn Map(const std::string& path)
+
+	\brief Maps a file, returns false if it cannot be opened or is empty
+*/
+/******************************************************************************/
+	bool Map(const std::string& path);
+
+/******************************************************************************/
+/*!
+	\fn Unmap()
+
+	\brief Releases the mapped file
+*/
+/******************************************************************************/
+	void Unmap();
+
+/******************************************************************************/
+/*!
+	\fn GetData()
+
+	\brief Gets the start of the mapped file
+*/
+/******************************************************************************/
+	const unsigned char* GetData() const { return view_; }
+
+/******************************************************************************/
+/*!
+	\fn GetSize()
+
+	\brief Gets the size of the mapped file in bytes
+*/
+/******************************************************************************/
+	size_t GetSize() const { return size_; }
+
+/******************************************************************************/
+/*!
+	\fn ~MappedFile()
+
+	\brief Unmaps the file if it is still mapped
+*/
+/******************************************************************************/
+	~MappedFile();
+};
+
+/******************************************************************************/
+/*!
+	\fn HashFileContents(const std::string& filename)
+
+	\brief Hashes the contents of a file, returns 0 if it cannot be read. Used
+		   to tell if the source of a cooked file has changed
+*/
+/******************************************************************************/
+uint64_t HashFileContents(const std::string& filename);
+
+/******************************************************************************/
+/*!
+	\struct FileBlock
+
+	\brief A run of bytes to be written to a file
+*/
+/******************************************************************************/
+struct FileBlock {
+
+	const void* data_;
+	size_t size_;
+};
+
+/******************************************************************************/
+/*!
+	\fn WriteFileAtomic(const std::string& path,
+						std::initializer_list<FileBlock> blocks)
+
+	\brief Writes blocks one after another as the contents of a file. They
+		   are written aside and renamed over the file, so a half written
+		   file is never mapped or read. Returns false if the file was left
+		   as it was
+*/
+/******************************************************************************/
+bool WriteFileAtomic(const std::string& path, std::initializer_list<FileBlock> blocks);
+
+#endif
@@ -67,13 +67,60 @@ public:
 
 /******************************************************************************/
 /*!
-    \fn AddTristripsBatchModel(int batch_size, std::string model_name)
+    \fn AddTristripsBatchModel(int batch_size, int segments, std::string model_name)
 
     \brief Adds a triangle strips model (with batch_size being the number of
-           objects rendered) and adds the model to the Model Manager's map
+           objects rendered) and adds the model to the Model Manager's map.
+           Its vertex buffer holds a ring of segments interleaved batches
 */
 /******************************************************************************/
-    Model* AddTristripsBatchModel(int batch_size, std::string model_name);
+    Model* AddTristripsBatchModel(int batch_size, int segments, std::string model_name);
+
+/******************************************************************************/
+/*!
+    \fn AddInstancedBatchModel(int batch_size, int segments, std::string model_name)
+
+    \brief Adds a model drawing one triangle strip quad per instance record
+           (with batch_size being the number of objects rendered) and adds the
+           model to the Model Manager's map. Its vertex buffer holds a ring of
+           segments batches
+*/
+/******************************************************************************/
+    Model* AddInstancedBatchModel(int batch_size, int segments, std::string model_name);
+
+/******************************************************************************/
+/*!
+    \fn AddUIBatchModel(int max_quads, int bands, std::string model_name)
+
+    \brief Adds a triangles model holding bands regions of max_quads quads of
+           interleaved UIBatch vertices and adds the model to the Model
+           Manager's map. The indices address one region, drawn with a base
+           vertex
+*/
+/******************************************************************************/
+    Model* AddUIBatchModel(int max_quads, int bands, std::string model_name);
+
+/******************************************************************************/
+/*!
+    \fn AddInstancedLightModel(int max_lights, int segments, std::string model_name)
+
+    \brief Adds a model drawing one triangle strip quad per light instance
+           and adds the model to the Model Manager's map. Its vertex buffer
+           holds segments regions of max_lights lights, one per light type
+*/
+/******************************************************************************/
+    Model* AddInstancedLightModel(int max_lights, int segments, std::string model_name);
+
+/******************************************************************************/
+/*!
+    \fn AddTextBatchModel(int max_glyphs, std::string model_name)
+
+    \brief Adds a triangles model holding up to max_glyphs glyph quads of
+           interleaved GlyphVertex data and adds the model to the Model
+           Manager's map
+*/
+/******************************************************************************/
+    Model* AddTextBatchModel(int max_glyphs, std::string model_name);
 
 /******************************************************************************/
 /*!
@@ -25,6 +25,22 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
+
+// Location of a uniform, resolved once from a linked shader program
+struct UniformHandle {
+
+    GLint location_ = -1;
+};
+
+// Per frame data shared by every shader program through a std140 uniform block
+struct FrameUniforms {
+
+    glm::mat4 projection_;
+    glm::vec4 world_to_ndc_xform_[3];   // std140 pads each mat3 column to a vec4
+    glm::vec2 win_size_;
+    glm::vec2 padding_;
+};
 
 class Shader {
 
@@ -131,6 +147,17 @@ public:
 /******************************************************************************/
     void DeleteShaderProgram();
 
+/******************************************************************************/
+/*!
+    \fn GetUniform(GLchar const* name)
+
+    \brief Returns the location of an active uniform, read from the table
+           built when the program was linked. Array uniforms are found by
+           their name without an index
+*/
+/******************************************************************************/
+    UniformHandle GetUniform(GLchar const* name) const;
+
 /******************************************************************************/
 /*!
     \fn SetUniform(GLchar const* name, GLboolean val)
@@ -230,6 +257,115 @@ public:
 /******************************************************************************/
     void SetUniform(GLchar const* name, glm::mat4& val);
 
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, GLboolean val)
+
+    \brief Sets the values of a boolean uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, GLboolean val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, GLint val)
+
+    \brief Sets the values of an int uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, GLint val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, GLfloat val)
+
+    \brief Sets the values of a float uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, GLfloat val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, GLfloat x, GLfloat y)
+
+    \brief Sets the values of a vec2 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, GLfloat x, GLfloat y);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, GLfloat x, GLfloat y, GLfloat z)
+
+    \brief Sets the values of a vec3 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, GLfloat x, GLfloat y, GLfloat z);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+
+    \brief Sets the values of a vec4 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, glm::vec2 val)
+
+    \brief Sets the values of a vec2 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, glm::vec2 val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, glm::vec3 val)
+
+    \brief Sets the values of a vec3 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, glm::vec3 val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, glm::vec4 val)
+
+    \brief Sets the values of a vec4 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, glm::vec4 val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, glm::mat3& val)
+
+    \brief Sets the values of a mat3 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, glm::mat3& val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, glm::mat4& val)
+
+    \brief Sets the values of a mat4 uniform through its resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, glm::mat4& val);
+
+/******************************************************************************/
+/*!
+    \fn SetUniform(UniformHandle handle, GLint const* vals, GLsizei count)
+
+    \brief Sets the values of an int or sampler array uniform through its
+           resolved location
+*/
+/******************************************************************************/
+    void SetUniform(UniformHandle handle, GLint const* vals, GLsizei count);
+
 /******************************************************************************/
 /*!
     \fn PrintActiveAttribs()
@@ -259,12 +395,41 @@ private:
 
     GLuint pgm_handle = 0;  // handle to linked shader program object
     GLboolean is_linked = GL_FALSE; // has the program successfully linked?
+
+    // locations of the active uniforms, filled once the program is linked
+    std::unordered_map<std::string, GLint> uniforms_;
+
+/******************************************************************************/
+/*!
+    \fn ReflectUniforms()
+
+    \brief Enumerates the active uniforms of the linked program into the
+           location table
+*/
+/******************************************************************************/
+    void ReflectUniforms();
 };
 
 class ShaderManager : public IManager {
 
     std::map<std::string, Shader> shaders_;
 
+    // Binding point of the FrameUniforms block declared in the shaders
+    static constexpr GLuint frame_block_binding_ = 0;
+
+    GLuint frame_block_ = 0;
+    FrameUniforms frame_uniforms_;
+
+/******************************************************************************/
+/*!
+    \fn UploadFrameUniforms()
+
+    \brief Uploads the per frame uniforms into the shared uniform block,
+           creating it on first use
+*/
+/******************************************************************************/
+    void UploadFrameUniforms();
+
 public:
 
 /******************************************************************************/
@@ -293,6 +458,33 @@ public:
 */
 /******************************************************************************/
     Shader* GetShdrpgm(std::string shader_type);
+
+/******************************************************************************/
+/*!
+    \fn SetScreenUniforms(const glm::mat4& projection, const glm::vec2& win_size)
+
+    \brief Sets the screen projection and window size seen by every shader
+*/
+/******************************************************************************/
+    void SetScreenUniforms(const glm::mat4& projection, const glm::vec2& win_size);
+
+/******************************************************************************/
+/*!
+    \fn SetCameraUniforms(const glm::mat3& world_to_ndc_xform)
+
+    \brief Sets the camera transform seen by every shader
+*/
+/******************************************************************************/
+    void SetCameraUniforms(const glm::mat3& world_to_ndc_xform);
+
+/******************************************************************************/
+/*!
+    \fn ~ShaderManager()
+
+    \brief Destructor for Shader Manager
+*/
+/******************************************************************************/
+    ~ShaderManager();
 };
 
 #endif
@@ -0,0 +1,221 @@
+/**********************************************************************************
+*\file         TextureAtlas.h
+*\brief        Contains declaration of functions and variables used for
+*			   packing images into texture atlases
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+
+#ifndef _TEXTURE_ATLAS_H_
+#define _TEXTURE_ATLAS_H_
+
+#include <glm/glm.hpp>
+#include <vector>
+
+/******************************************************************************/
+/*!
+	\class SkylinePacker
+
+	\brief Places rectangles into a fixed size page using the bottom left
+		   skyline heuristic
+*/
+/******************************************************************************/
+class SkylinePacker {
+
+	struct Segment {
+
+		int x_;
+		int y_;
+		int width_;
+	};
+
+	std::vector<Segment> skyline_;
+	int width_;
+	int height_;
+	int used_height_;
+
+/******************************************************************************/
+/*!
+	\fn Fit(size_t index, int width, int height)
+
+	\brief Returns the lowest y a rectangle starting at the segment can be
+		   placed at, or -1 if it does not fit
+*/
+/******************************************************************************/
+	int Fit(size_t index, int width, int height) const;
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn Init(int width, int height)
+
+	\brief Empties the page and sets its size
+*/
+/******************************************************************************/
+	void Init(int width, int height);
+
+/******************************************************************************/
+/*!
+	\fn Insert(int width, int height, int& x, int& y)
+
+	\brief Places a rectangle, returns false if the page has no room for it
+*/
+/******************************************************************************/
+	bool Insert(int width, int height, int& x, int& y);
+
+/******************************************************************************/
+/*!
+	\fn GetUsedHeight()
+
+	\brief Returns the height of the tallest column placed so far
+*/
+/******************************************************************************/
+	int GetUsedHeight() const { return used_height_; }
+};
+
+/******************************************************************************/
+/*!
+	\class TextureAtlas
+
+	\brief Packs 32 bit images into as few pages as possible on the CPU. The
+		   GL upload is left to the TextureManager, so packing can be run and
+		   checked without a GPU. Each image is surrounded by padding filled
+		   with its own edge pixels so filtering never samples a neighbour
+*/
+/******************************************************************************/
+class TextureAtlas {
+
+public:
+
+	struct Image {
+
+		int width_;
+		int height_;
+		std::vector<unsigned char> pixels_;
+	};
+
+	// page_ is -1 for images larger than a page, they are kept on their own
+	struct Placement {
+
+		int page_;
+		int x_;
+		int y_;
+	};
+
+	struct Page {
+
+		int width_;
+		int height_;
+		std::vector<unsigned char> pixels_;
+	};
+
+/******************************************************************************/
+/*!
+	\fn Add(Image image)
+
+	\brief Queues an image to be packed and returns its index
+*/
+/******************************************************************************/
+	size_t Add(Image image);
+
+/******************************************************************************/
+/*!
+	\fn Pack(int page_size, int padding)
+
+	\brief Places every queued image, tallest first, and copies them into the
+		   pages. Pages are page_size wide and trimmed to the height used
+*/
+/******************************************************************************/
+	void Pack(int page_size, int padding);
+
+/******************************************************************************/
+/*!
+	\fn Clear()
+
+	\brief Releases every image and page
+*/
+/******************************************************************************/
+	void Clear();
+
+/******************************************************************************/
+/*!
+	\fn GetImage(size_t index)
+
+	\brief Gets a queued image
+*/
+/******************************************************************************/
+	const Image& GetImage(size_t index) const { return images_[index]; }
+
+/******************************************************************************/
+/*!
+	\fn GetImageCount()
+
+	\brief Gets the number of queued images
+*/
+/******************************************************************************/
+	size_t GetImageCount() const { return images_.size(); }
+
+/******************************************************************************/
+/*!
+	\fn GetPlacement(size_t index)
+
+	\brief Gets where an image was packed, only valid after Pack
+*/
+/******************************************************************************/
+	const Placement& GetPlacement(size_t index) const { return placements_[index]; }
+
+/******************************************************************************/
+/*!
+	\fn GetPages()
+
+	\brief Gets the packed pages, only valid after Pack
+*/
+/******************************************************************************/
+	const std::vector<Page>& GetPages() const { return pages_; }
+
+/******************************************************************************/
+/*!
+	\fn ToAtlasUV(size_t index, const glm::vec2& uv)
+
+	\brief Converts a texture coordinate within an image into one within its
+		   page. Coordinates of images that were not packed are unchanged
+*/
+/******************************************************************************/
+	glm::vec2 ToAtlasUV(size_t index, const glm::vec2& uv) const;
+
+/******************************************************************************/
+/*!
+	\fn ToAtlasScale(size_t index)
+
+	\brief Gets the scale from an image's texture coordinates to its page's
+*/
+/******************************************************************************/
+	glm::vec2 ToAtlasScale(size_t index) const;
+
+private:
+
+	std::vector<Image> images_;
+	std::vector<Placement> placements_;
+	std::vector<Page> pages_;
+	int padding_;
+
+/******************************************************************************/
+/*!
+	\fn Blit(size_t index)
+
+	\brief Copies an image into its page and extrudes its edges into the
+		   padding around it
+*/
+/******************************************************************************/
+	void Blit(size_t index);
+};
+
+#endif
@@ -0,0 +1,139 @@
+/**********************************************************************************
+*\file         TextureCache.h
+*\brief        Contains declaration of functions and variables used for
+*			   caching decoded images as cooked texture files
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+
+#ifndef _TEXTURE_CACHE_H_
+#define _TEXTURE_CACHE_H_
+
+#include <cstdint>
+#include <string>
+#include "Manager/TextureAtlas.h"
+#include "Manager/MappedFile.h"
+
+/******************************************************************************/
+/*!
+	\class CookedTexture
+
+	\brief A mapped cooked texture file. Its pixels can be uploaded straight
+		   from the mapped pages
+*/
+/******************************************************************************/
+class CookedTexture : public MappedFile {
+
+public:
+
+	struct Header {
+
+		char magic_[4];
+		uint32_t version_;
+		uint32_t width_;
+		uint32_t height_;
+		uint64_t source_hash_;
+	};
+
+/******************************************************************************/
+/*!
+	\fn GetHeader()
+
+	\brief Gets the header at the start of the mapped file
+*/
+/******************************************************************************/
+	const Header& GetHeader() const { return *reinterpret_cast<const Header*>(GetData()); }
+
+/******************************************************************************/
+/*!
+	\fn GetWidth()
+
+	\brief Gets the width of the cooked image
+*/
+/******************************************************************************/
+	int GetWidth() const { return static_cast<int>(GetHeader().width_); }
+
+/******************************************************************************/
+/*!
+	\fn GetHeight()
+
+	\brief Gets the height of the cooked image
+*/
+/******************************************************************************/
+	int GetHeight() const { return static_cast<int>(GetHeader().height_); }
+
+/******************************************************************************/
+/*!
+	\fn GetPixels()
+
+	\brief Gets the 32 bit BGRA pixels following the header
+*/
+/******************************************************************************/
+	const unsigned char* GetPixels() const { return GetData() + sizeof(Header); }
+};
+
+/******************************************************************************/
+/*!
+	\class TextureCache
+
+	\brief Stores decoded 32 bit BGRA images in a directory of cooked files,
+		   named after a hash of the source image's contents. An edited
+		   source hashes to a new name, so a stale cook is never read
+*/
+/******************************************************************************/
+class TextureCache {
+
+public:
+
+	static constexpr uint32_t version_ = 1;
+
+/******************************************************************************/
+/*!
+	\fn Init(const std::string& directory)
+
+	\brief Sets and creates the directory the cooked files are kept in
+*/
+/******************************************************************************/
+	void Init(const std::string& directory);
+
+/******************************************************************************/
+/*!
+	\fn Load(uint64_t hash, CookedTexture& cooked)
+
+	\brief Maps the cooked file of a source hash. Returns false if there is
+		   none or it does not hold a valid image
+*/
+/******************************************************************************/
+	bool Load(uint64_t hash, CookedTexture& cooked) const;
+
+/******************************************************************************/
+/*!
+	\fn Cook(uint64_t hash, const TextureAtlas::Image& image)
+
+	\brief Writes a decoded image as the cooked file of a source hash
+*/
+/******************************************************************************/
+	void Cook(uint64_t hash, const TextureAtlas::Image& image) const;
+
+private:
+
+	std::string directory_;
+
+/******************************************************************************/
+/*!
+	\fn GetCookedPath(uint64_t hash)
+
+	\brief Gets the path of the cooked file of a source hash
+*/
+/******************************************************************************/
+	std::string GetCookedPath(uint64_t hash) const;
+};
+
+#endif
@@ -20,13 +20,20 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <future>
+#include <functional>
 #include "Manager/IManager.h"
+#include "Manager/TextureAtlas.h"
+#include "Manager/TextureCache.h"
 #include "../rapidjson/filereadstream.h"
 #include "../rapidjson/document.h"
 #include "prettywriter.h"
 
 class Texture {
 
+	// Tile coordinates are rewritten when its tileset is packed into an atlas
+	friend class TextureManager;
+
 	size_t width_;
 	size_t height_;
 	GLuint tileset_handle_;
@@ -101,6 +108,8 @@ public:
 
 class Tileset {
 
+	friend class TextureManager;
+
 	GLuint tileset_handle_;
 	std::vector<std::string> tile_names_;
 
@@ -149,6 +158,84 @@ class TextureManager : public IManager {
 	std::map<std::string, Tileset> tilesets_;
 	std::map<std::string, Texture> textures_;
 
+	// Handle and coordinates that refer to an image queued for the atlas
+	struct AtlasUser {
+
+		size_t image_;
+		GLuint* handle_;
+		std::vector<glm::vec2>* tex_vtx_;
+		float* offset_x_;
+		size_t* width_;
+		size_t* height_;
+	};
+
+	static constexpr int atlas_page_size_ = 4096;
+	static constexpr int atlas_padding_ = 2;
+
+	bool atlas_open_;
+	bool atlas_pending_;
+	TextureAtlas atlas_;
+	std::map<std::string, size_t> atlas_files_;
+	std::vector<std::string> atlas_queue_;
+	std::map<GLuint*, AtlasUser> atlas_users_;
+	std::vector<GLuint> atlas_pages_;
+
+	// Decoding and packing run off the main thread, only the GL upload is left to it
+	std::future<void> atlas_packing_;
+	std::vector<size_t> atlas_loose_;
+	std::vector<GLuint> atlas_uploads_;
+
+	// Decoded images kept on disk so warm starts skip FreeImage
+	TextureCache texture_cache_;
+
+/******************************************************************************/
+/*!
+	\fn DecodeImageFile(const char* filename)
+
+	\brief Loads an image file into 32 bit BGRA pixels on the CPU
+*/
+/******************************************************************************/
+	TextureAtlas::Image DecodeImageFile(const char* filename);
+
+/******************************************************************************/
+/*!
+	\fn ReadImageFile(const char* filename)
+
+	\brief Reads an image from its cooked copy, or decodes and cooks it if
+		   the image has no cooked copy yet or was edited since
+*/
+/******************************************************************************/
+	TextureAtlas::Image ReadImageFile(const char* filename);
+
+/******************************************************************************/
+/*!
+	\fn CreateTextureObject(int width, int height, const unsigned char* pixels)
+
+	\brief Uploads 32 bit BGRA pixels into a new texture and returns its handle
+*/
+/******************************************************************************/
+	GLuint CreateTextureObject(int width, int height, const unsigned char* pixels);
+
+/******************************************************************************/
+/*!
+	\fn PackAtlas(int page_size)
+
+	\brief Decodes the queued image files on worker threads and packs them.
+		   Runs on its own thread while the main thread keeps rendering
+*/
+/******************************************************************************/
+	void PackAtlas(int page_size);
+
+/******************************************************************************/
+/*!
+	\fn FinishAtlas()
+
+	\brief Points every texture and animation registered at their place in the
+		   uploaded atlas, then releases the CPU copy of the atlas
+*/
+/******************************************************************************/
+	void FinishAtlas();
+
 public:
 
 /******************************************************************************/
@@ -169,15 +256,6 @@ public:
 /******************************************************************************/
 	void TextureBatchLoad(std::string level_name);
 
-/******************************************************************************/
-/*!
-	\fn DeSerializeJSON()
-
-	\brief Loads the content of a JSON file into a doc
-*/
-/******************************************************************************/
-	void DeSerializeJSON(const std::string& filename, rapidjson::Document& doc);
-
 /******************************************************************************/
 /*!
 	\fn CreateQuadTexture(std::string texture_name,
@@ -210,6 +288,101 @@ public:
 /******************************************************************************/
 	std::vector<GLuint> LoadImageFile(const char* filename);
 
+/******************************************************************************/
+/*!
+	\fn BeginAtlas()
+
+	\brief Starts collecting the images of following batch loads into an atlas
+		   instead of uploading each one into its own texture. An atlas still
+		   being uploaded is finished first
+*/
+/******************************************************************************/
+	void BeginAtlas();
+
+/******************************************************************************/
+/*!
+	\fn CloseAtlas()
+
+	\brief Stops collecting and starts decoding and packing the images collected
+		   since BeginAtlas in the background. UploadAtlas must be pumped until
+		   it returns true before the textures and animations can be drawn
+*/
+/******************************************************************************/
+	void CloseAtlas();
+
+/******************************************************************************/
+/*!
+	\fn UploadAtlas(float budget,
+					const std::function<void(size_t, size_t)>& progress)
+
+	\brief Uploads packed atlas pages until budget seconds have been spent, at
+		   least one per call. progress receives the number of textures
+		   uploaded so far and the total. Returns true once the atlas is done
+*/
+/******************************************************************************/
+	bool UploadAtlas(float budget, const std::function<void(size_t, size_t)>& progress = {});
+
+/******************************************************************************/
+/*!
+	\fn EndAtlas()
+
+	\brief Closes the atlas and waits for it to be decoded, packed and uploaded
+*/
+/******************************************************************************/
+	void EndAtlas();
+
+/******************************************************************************/
+/*!
+	\fn IsAtlasPending()
+
+	\brief Checks if a closed atlas is still being decoded or uploaded
+*/
+/******************************************************************************/
+	bool IsAtlasPending() const { return atlas_pending_; }
+
+/******************************************************************************/
+/*!
+	\fn IsCollectingAtlas()
+
+	\brief Checks if images are being collected into an atlas
+*/
+/******************************************************************************/
+	bool IsCollectingAtlas() const { return atlas_open_; }
+
+/******************************************************************************/
+/*!
+	\fn AddAtlasImage(const char* filename)
+
+	\brief Queues an image file for the atlas, it is decoded once the atlas is
+		   closed. A file queued more than once is only decoded once
+*/
+/******************************************************************************/
+	size_t AddAtlasImage(const char* filename);
+
+/******************************************************************************/
+/*!
+	\fn AddAtlasUser(size_t image, GLuint* handle,
+					  std::vector<glm::vec2>* tex_vtx, float* offset_x,
+					  size_t* width, size_t* height)
+
+	\brief Registers a handle, texture coordinates, frame offset and image size
+		   to be rewritten once the image is packed. They must stay valid until
+		   the atlas is uploaded
+*/
+/******************************************************************************/
+	void AddAtlasUser(size_t image, GLuint* handle,
+					  std::vector<glm::vec2>* tex_vtx = nullptr, float* offset_x = nullptr,
+					  size_t* width = nullptr, size_t* height = nullptr);
+
+/******************************************************************************/
+/*!
+	\fn IsAtlasPage(GLuint handle)
+
+	\brief Checks if a handle is an atlas page shared by several images
+*/
+/******************************************************************************/
+	bool IsAtlasPage(GLuint handle) const;
+
 /******************************************************************************/
 /*!
 	\fn CreateTileset(const char* filename, size_t columns, size_t rows,
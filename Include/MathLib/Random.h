@@ -0,0 +1,142 @@
+/**********************************************************************************
+*\file         Random.h
+*\brief        Contains declaration of functions and variables used for the
+*			   per-thread random number generator
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#ifndef _RANDOM_H_
+#define _RANDOM_H_
+
+#include <cstdint>
+#include <cstddef>
+
+// SSE2 is guaranteed on x64, use the vectorised batch paths when available
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PE_RANDOM_SSE2
+#endif
+
+class RandomGenerator
+{
+	// xoshiro128+ state, scalar stream
+	uint32_t state_[4];
+
+	// xoshiro128+ state, 4 independent lanes used by the batch functions
+	alignas(16) uint32_t lanes_[4][4];
+
+public:
+
+/******************************************************************************/
+/*!
+  \fn RandomGenerator()
+
+  \brief Constructor for RandomGenerator, seeds the generator with the seed
+*/
+/******************************************************************************/
+	explicit RandomGenerator(uint64_t seed = 0x5EEDCAFEF00DULL);
+
+/******************************************************************************/
+/*!
+  \fn Seed()
+
+  \brief Resets the state of both the scalar stream and the batch lanes from
+		 a single 64 bit seed, identical seeds produce identical sequences
+*/
+/******************************************************************************/
+	void Seed(uint64_t seed);
+
+/******************************************************************************/
+/*!
+  \fn NextU32()
+
+  \brief Returns the next 32 bit value of the scalar stream
+*/
+/******************************************************************************/
+	uint32_t NextU32();
+
+/******************************************************************************/
+/*!
+  \fn NextFloat()
+
+  \brief Returns a float within the range of [0, 1)
+*/
+/******************************************************************************/
+	float NextFloat();
+
+/******************************************************************************/
+/*!
+  \fn Range(float min, float max)
+
+  \brief Returns a float within the range of [min, max), drop in replacement
+		 for glm::linearRand
+*/
+/******************************************************************************/
+	float Range(float min, float max);
+
+/******************************************************************************/
+/*!
+  \fn Range(int min, int max)
+
+  \brief Returns an int within the range of [min, max]
+*/
+/******************************************************************************/
+	int Range(int min, int max);
+
+/******************************************************************************/
+/*!
+  \fn Index()
+
+  \brief Returns an index within the range of [0, count), replaces the
+		 biased rand() % count
+*/
+/******************************************************************************/
+	size_t Index(size_t count);
+
+/******************************************************************************/
+/*!
+  \fn FillRange()
+
+  \brief Fills an array with count floats within the range of [min, max),
+		 generating 4 values per iteration when SSE2 is available
+*/
+/******************************************************************************/
+	void FillRange(float* out, size_t count, float min, float max);
+};
+
+/******************************************************************************/
+/*!
+  \fn SeedRandom()
+
+  \brief Sets the seed shared by every thread's generator. Each thread reseeds
+		 itself from this seed and its stream index on its next access, which
+		 allows for deterministic replays
+*/
+/******************************************************************************/
+void SeedRandom(uint64_t seed);
+
+/******************************************************************************/
+/*!
+  \fn SetRandomStream()
+
+  \brief Assigns a fixed stream index to the calling thread. Worker threads
+		 should call this with a stable index for replays to be deterministic
+*/
+/******************************************************************************/
+void SetRandomStream(uint32_t stream);
+
+/******************************************************************************/
+/*!
+  \fn GetRandom()
+
+  \brief Returns the calling thread's generator, no locking is involved
+*/
+/******************************************************************************/
+RandomGenerator& GetRandom();
+
+#endif
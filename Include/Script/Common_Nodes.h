@@ -5,356 +5,128 @@
 #include "Systems/Physics.h"
 #include "Engine/Core.h"
 
+/******************************************************************************/
+/*!
+  \class Common
+
+  \brief Leaves and subtrees shared by the different AI trees
+*/
+/******************************************************************************/
 class Common : public Behaviour
 {
 public:
 	/******************************************************************************/
 	/*!
-	  \class CheckAlive
+	  \fn CheckAlive()
 
-	  \brief Checks whether AI is alive, if not, run respawn
+	  \brief Checks whether AI is alive, if not, run respawn timer and respawn
+			 the AI once it has elapsed
 	*/
 	/******************************************************************************/
-	class CheckAlive :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-		Time_Channel respawn_timer_;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn CheckAlive(EntityID id)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		CheckAlive(EntityID id);
-		  /******************************************************************************/
-		  /*!
-			\fn run()
-
-			\brief Checks whether AI is alive, if not, run respawn
-		  */
-		  /******************************************************************************/
-		  bool run() override;
-	};
+	static bool CheckAlive(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class CheckSentry
+	  \fn CheckSentry()
 
-	  \brief CheckSentry Node, Checks whether AI has more than 1 destinations
+	  \brief Checks whether AI is a sentry, which only has a single destination
 	*/
 	/******************************************************************************/
-	class CheckSentry :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn CheckSentry(EntityID id)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		CheckSentry(EntityID id);
-		/******************************************************************************/
-		/*!
-		  \fn run()
-
-		  \brief Checks whether AI has more than 1 destination
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	static bool CheckSentry(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class SentryReturn
-	
-	  \brief Sentry Return Node, Checks if AI is at sentry position
+	  \fn SentryReturn()
+
+	  \brief Checks whether AI is away from its sentry position
 	*/
 	/******************************************************************************/
-	class SentryReturn :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn SentryReturn(EntityID id)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		SentryReturn(EntityID id);
-		/******************************************************************************/
-		/*!
-		  \fn run()
-
-		  \brief Checks whether AI is at sentry position
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	static bool SentryReturn(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class CheckWaypoint
-	
-	  \brief CheckWaypoint Node, Contains nodes for the waypoint system
+	  \fn AtWaypoint()
+
+	  \brief Checks whether AI has not yet reached its current waypoint
 	*/
 	/******************************************************************************/
-	class CheckWaypoint :public Selector
-	{
-		EntityID id_;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn CheckWaypoint(EntityID id)
-
-		  \brief Constructor, setting multiple children relating to the waypoint system
-		*/
-		/******************************************************************************/
-		CheckWaypoint(EntityID id) : id_(id) {
-			addChild(new AtWaypoint(id_));
-			addChild(new ChangeWaypoint(id_));
-		}
-	};
+	static bool AtWaypoint(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class AtWaypoint
+	  \fn ChangeWaypoint()
 
-	  \brief AtWaypoint Node, Checks if AI is at the waypoint
+	  \brief Sets the current waypoint of the AI to the next waypoint
 	*/
 	/******************************************************************************/
-	class AtWaypoint :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn AtWaypoint(EntityID id)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		AtWaypoint(EntityID id);
-		/******************************************************************************/
-		/*!
-		  \fn run()
-
-		  \brief Checks whether AI is at the waypoint
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	static bool ChangeWaypoint(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class ChangeWaypoint
+	  \fn CheckPath()
 
-	  \brief ChangeWaypoint Node, Change to the next waypoint
+	  \brief Finds a path to the current waypoint whenever the waypoint stored in
+			 the node's destination slot changes
 	*/
 	/******************************************************************************/
-	class ChangeWaypoint :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		ComponentManager* component_mgr;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn ChangeWaypoint(EntityID id)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		ChangeWaypoint(EntityID id);
-		/******************************************************************************/
-		/*!
-		  \fn run()
-
-		  \brief Change to the next waypoint
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	static bool CheckPath(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class CheckPath
+	  \fn Move()
 
-	  \brief Check Path Node, check if pathfinding algorithm can find a path
+	  \brief Moves AI along its path at the speed stored in the node's param
 	*/
 	/******************************************************************************/
-	class CheckPath :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-		AMap* map_;
-		Vector2D SetDes;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn CheckPath(EntityID id)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		CheckPath(EntityID id);
-		/******************************************************************************/
-		/*!
-		  \fn run()
-
-		  \brief Check if pathfinding algorithm can find a path
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	static bool Move(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class Move
-	
-	  \brief Move Node, Move towards destination
+	  \fn PlayerWithinDistance()
+
+	  \brief Checks whether the player is within the distance stored in the
+			 node's param
 	*/
 	/******************************************************************************/
-	class Move :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-		ForcesManager* forces_;
-		float Speed_;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn Move(EntityID id, float spd)
-	
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		Move(EntityID id, float spd);
-		/******************************************************************************/
-		/*!
-		  \fn run()
-	
-		  \brief Move towards destination
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	static bool PlayerWithinDistance(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class PlayerWithinDistance
+	  \fn PlayerWithinVision()
 
-	  \brief PlayerWithinDistance Node, checks whether the player is within
-		close proximity
+	  \brief Checks whether the player is within the cone vision of the AI, up to
+			 the distance stored in the node's param
 	*/
 	/******************************************************************************/
-	class PlayerWithinDistance :public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-
-		EntityID player_id_;
-		Status* player_status_;
-		Transform* player_rigidbody_;
-
-		float detectdistance_;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn PlayerWithinDistance(EntityID id, float dist)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		PlayerWithinDistance(EntityID id, float dist);
-		/******************************************************************************/
-		/*!
-		  \fn PlayerInit()
-
-		  \brief Sets nodes private variables relating to the player
-		*/
-		/******************************************************************************/
-		void PlayerInit();
-		/******************************************************************************/
-		/*!
-		  \fn run()
-
-		  \brief Checks whether the player is within close proximity
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	static bool PlayerWithinVision(Agent& agent, const Context& context, const Node& node);
 
 	/******************************************************************************/
 	/*!
-	  \class PlayerWithinVision
+	  \fn FaceVelocity()
 
-	  \brief PlayerWithinVision Node, checks whether the player is within
-		cone vision
+	  \brief Flips the AI's texture to face the direction it is moving in
 	*/
 	/******************************************************************************/
-	class PlayerWithinVision : public Node
-	{
-		EntityID id_;
-		AI* ai_;
-		Transform* obj_rigidbody_;
-		ComponentManager* component_mgr;
-
-		EntityID player_id_;
-		Status* player_status_;
-		Transform* player_rigidbody_;
-
-		float detectdistance_ = 0.0f;
-	public:
-		/******************************************************************************/
-		/*!
-		  \fn CheckSentry(EntityID id)
-
-		  \brief Constructor, sets nodes private variables
-		*/
-		/******************************************************************************/
-		PlayerWithinVision(EntityID id, float dist);
-		/******************************************************************************/
-		/*!
-		  \fn PlayerInit()
+	static void FaceVelocity(Agent& agent, const Context& context);
 
-		  \brief Sets nodes private variables relating to the player
-		*/
-		/******************************************************************************/
-		void PlayerInit();
-		/******************************************************************************/
-		/*!
-		  \fn run()
+	/******************************************************************************/
+	/*!
+	  \fn BuildCheckWaypoint()
 
-		  \brief Checks whether the player is within cone vision
-		*/
-		/******************************************************************************/
-		bool run() override;
-	};
+	  \brief Appends the waypoint selector to a tree
+	*/
+	/******************************************************************************/
+	static void BuildCheckWaypoint(Tree& tree);
 
+	/******************************************************************************/
+	/*!
+	  \fn BuildDetectPlayer()
 
+	  \brief Appends the player detection selector to a tree, detection ranges
+			 depend on the level of the AI
+	*/
+	/******************************************************************************/
+	static void BuildDetectPlayer(Tree& tree, int level);
 };
 
 #endif
@@ -26,6 +26,7 @@
 #include "Systems/Game.h"
 #include "Manager/ComponentManager.h"
 #include "Components/LogicComponent.h"
+#include "MathLib/Random.h"
 #include "GameStates/PlayState.h"
 #include "GameStates/MenuState.h"
 
@@ -33,7 +34,7 @@ void PlayBurrow(Status* status) {
 	
 	if (status->GetStatus() == StatusType::BURROW) {
 
-		int value = std::rand() % 3;
+		int value = static_cast<int>(GetRandom().Index(3));
 		std::string sound{"PlayerBurrowing_"};
 		sound += std::to_string(value);
 		CORE->GetSystem<SoundSystem>()->PlaySounds(sound);
@@ -198,7 +198,7 @@ private:
 		 interactable game entity
 */
 /******************************************************************************/
-	void PlayerScenarioResponse(AABBIt aabb1, AABBIt aabb2, std::string scenario);
+	void PlayerScenarioResponse(AABBIt aabb1, AABBIt aabb2, LogicHook scenario);
 
 /******************************************************************************/
 /*!
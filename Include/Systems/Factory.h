@@ -21,6 +21,9 @@
 #include "GameStates/Levels.h"
 #include "Manager/ComponentManager.h"
 #include "Manager/EntityManager.h"
+#include "Manager/FileManager.h"
+#include "Systems/LevelCache.h"
+#include "Systems/SnapshotStore.h"
 #include <set>
 #include <map>
 #include <string>
@@ -55,15 +58,31 @@ class EntityFactory : public ISystem {
 	ComponentManager* comp_mgr_;
 	EntityManager* entity_mgr_;
 
+	// Levels cooked from their JSON files the first time they are loaded
+	LevelCache level_cache_;
+
+	// Save game snapshots of the world, kept by slot
+	SnapshotStore snapshots_;
+
 /******************************************************************************/
 /*!
   \fn CloneLevelEntities()
 
   \brief Creates and serializes entities of an archetype in a level given 
-		 an archetype name and json to load from
+		 an archetype name and json to load from, recording them into cook
+*/
+/******************************************************************************/
+	void CloneLevelEntities(const std::string& filename, const std::string& archetype_name, LevelCook& cook);
+
+/******************************************************************************/
+/*!
+  \fn CloneCookedLevel()
+
+  \brief Creates all entities in a level from its cooked file. Returns false
+		 if the level has no cooked file or its JSON files changed since
 */
 /******************************************************************************/
-	void CloneLevelEntities(const std::string& filename, const std::string& archetype_name);
+	bool CloneCookedLevel(const std::string& filename);
 
 public:
 /******************************************************************************/
@@ -94,6 +113,17 @@ public:
 /******************************************************************************/
 	Entity* CloneArchetype(const std::string& archetype_name);
 
+/******************************************************************************/
+/*!
+  \fn InstantiateArchetype()
+
+  \brief Clones count entities of an archetype at once, calling initializer on
+		 each with its index
+*/
+/******************************************************************************/
+	EntityIDRange InstantiateArchetype(const std::string& archetype_name, size_t count,
+									   const std::function<void(Entity*, size_t)>& initializer = {});
+
 /******************************************************************************/
 /*!
   \fn CreateAllArchetypes()
@@ -142,6 +172,29 @@ public:
 /******************************************************************************/
 	void SerializeCurrentLevelEntities();
 
+/******************************************************************************/
+/*!
+  \fn SaveSnapshot()
+
+  \brief Captures every entity cloned from an archetype and the values of its
+		 components into a binary snapshot kept under a slot name. The
+		 snapshot is written to its file in the background. Entities with
+		 no archetype are left out, with a warning
+*/
+/******************************************************************************/
+	void SaveSnapshot(const std::string& slot);
+
+/******************************************************************************/
+/*!
+  \fn LoadSnapshot()
+
+  \brief Replaces all entities with the ones captured in the snapshot of a
+		 slot, keeping their ids. Returns false, leaving the entities as they
+		 are, if the slot has no snapshot
+*/
+/******************************************************************************/
+	bool LoadSnapshot(const std::string& slot);
+
 /******************************************************************************/
 /*!
   \fn SerializeLevelPaths()
@@ -274,13 +327,4 @@ public:
 
 extern EntityFactory* FACTORY;
 
-/******************************************************************************/
-/*!
-  \fn DeSerializeJSON()
-
-  \brief Loads the content of a JSON file into a doc
-*/
-/******************************************************************************/
-void DeSerializeJSON(const std::string& filename, rapidjson::Document& doc);
-
 #endif
\ No newline at end of file
@@ -179,6 +179,9 @@ public:
 private:
 	bool debug_;
 
+	// Seconds of each frame spent uploading start up textures
+	float asset_upload_budget_;
+
 	// stack to hold the states
 	std::vector<GameState*> states_;
 	std::vector<std::string> files_to_load_;
@@ -28,10 +28,18 @@
 #include "Systems/CameraSystem.h"
 #include "Components/AnimationRenderer.h"
 #include "Components/TextRenderer.h"
+#include "Systems/RenderQueue.h"
+#include "Systems/SpriteBatch.h"
+#include "Systems/UIBatch.h"
 #include <windows.h>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
+class PartitioningSystem;
+class Transform;
+class Scale;
+class Clickable;
+
 class GraphicsSystem : public ISystem {
 
     class RenderLayer {
@@ -46,8 +54,40 @@ class GraphicsSystem : public ISystem {
 
     glm::vec2 win_size_;
     
-    std::map<std::string, Shader*> graphic_shaders_;
-    std::map<std::string, Model*> graphic_models_;
+    // Shaders and models are resolved once in Init and indexed by these
+    enum GraphicShader {
+
+        ObjectShader,
+        InstancedObjectShader,
+        TextShader,
+        UIShader,
+        FinalShader,
+        VignetteShader,
+        DebugShader,
+        GraphicShaderCount
+    };
+
+    enum GraphicModel {
+
+        DebugModel,
+        BoxModel,
+        TextModel,
+        UIBatchModel,
+        BatchModel,
+        InstancedBatchModel,
+        GraphicModelCount
+    };
+
+    Shader* graphic_shaders_[GraphicShaderCount];
+    Model* graphic_models_[GraphicModelCount];
+
+    // Uniforms set per draw, the per frame ones live in the FrameUniforms block
+    UniformHandle final_opacity_;
+    UniformHandle vignette_center_;
+    UniformHandle vignette_clear_size_;
+    UniformHandle vignette_max_size_;
+    UniformHandle vignette_opacity_;
+    UniformHandle debug_color_;
 
     std::shared_ptr<WindowsSystem> windows_system_;
     std::shared_ptr<CameraSystem> camera_system_;
@@ -57,6 +97,7 @@ class GraphicsSystem : public ISystem {
     std::shared_ptr<ShaderManager> shader_manager_;
     std::shared_ptr<FontManager> font_manager_;
     std::shared_ptr<ComponentManager> component_manager_;
+    PartitioningSystem* partitioning_;
 
     //render all game objects to texture
     GLuint frame_buffer_;
@@ -70,13 +111,56 @@ class GraphicsSystem : public ISystem {
 
     //for batching
     int batch_size_;
-    std::vector<glm::vec2> tex_vtx_sent;
-    std::vector<glm::vec2> scaling_sent;
-    std::vector<glm::vec2> rotation_sent;
-    std::vector<glm::vec2> position_sent;
-    std::vector<float> texture_id_sent;
+    RenderQueue render_queue_;
+    int batch_segments_;
+    SpriteBatch sprite_batch_;
     std::map<GLuint, GLuint> texture_handles;
 
+    //number of samplers in uTex2d of the object shader
+    static constexpr size_t max_batch_textures_ = 20;
+
+    //for text, glyphs sharing a font atlas are drawn together
+    static constexpr size_t max_text_glyphs_ = 2048;
+    std::vector<GlyphVertex> text_batch_;
+    GLuint text_batch_texture_;
+
+    //for UI, layers are drawn in three bands around the vignette and UI text
+    enum UIBand {
+
+        UIBandBase,     // layer below 10, under the vignette
+        UIBandOverlay,  // layer 10 to 19, above the vignette
+        UIBandTop,      // layer 20 and above, above the UI text
+        UIBandCount
+    };
+
+    // A UI element drawn as a back, a stencil mask, a fill lowered to match
+    // the player's health and a front, named by the element's entity
+    struct UIFill {
+
+        std::string back_;
+        std::string mask_;
+        std::string fill_;
+        std::string front_;
+        float scale_;
+        float drop_;
+    };
+
+    // Components of a UI renderer, resolved when the UI renderers change
+    struct UIEntry {
+
+        IRenderer* renderer_;
+        Transform* transform_;
+        Scale* scale_;
+        Clickable* clickable_;
+        const UIFill* fill_;
+    };
+
+    static constexpr size_t ui_batch_size_ = 256;
+    UIBatch ui_batches_[UIBandCount];
+    std::vector<UIEntry> ui_entries_;
+    bool ui_entries_dirty_;
+    std::map<std::string, UIFill> ui_fills_;
+
     glm::vec2 vignette_size;
     glm::vec2 max_vignette_size;
 
@@ -235,51 +319,98 @@ void RemoveTextRendererComponent(EntityID id);
     
 /******************************************************************************/
 /*!
-    \fn BatchWorldObject(IRenderer* i_renderer)
+    \fn BatchWorldObject(const RenderQueue::Item& item)
 
     \brief Inserts data of objects, that have a component that inherits from
            IRenderer, into batch.
 */
 /******************************************************************************/
-    void BatchWorldObject(IRenderer* i_renderer);
+    void BatchWorldObject(const RenderQueue::Item& item);
+
+/******************************************************************************/
+/*!
+    \fn DrawBatch(Model* model)
+
+    \brief Draw all objects in the batch with the shader in use
+*/
+/******************************************************************************/
+    void DrawBatch(Model* model);
+
+/******************************************************************************/
+/*!
+    \fn UpdateTextMesh(TextRenderer* text_renderer)
+
+    \brief Lays out the glyph quads of a TextRenderer if its text, scale,
+           color or position changed. Returns false if it cannot be drawn
+*/
+/******************************************************************************/
+    bool UpdateTextMesh(TextRenderer* text_renderer);
 
 /******************************************************************************/
 /*!
-    \fn DrawBatch(GLuint vbo_hdl, glm::mat3 world_to_ndc_xform)
+    \fn BatchTextObject(Model* model, TextRenderer* text_renderer)
 
-    \brief Draw all objects in the batch
+    \brief Adds the glyphs of a TextRenderer to the text batch, drawing the
+           batch first if it is full or uses another font
 */
 /******************************************************************************/
-    void DrawBatch(GLuint vbo_hdl, glm::mat3 world_to_ndc_xform);
+    void BatchTextObject(Model* model, TextRenderer* text_renderer);
 
 /******************************************************************************/
 /*!
-    \fn DrawTextObject(Shader* shader, Model* model,
-                       TextRenderer* text_renderer)
+    \fn DrawTextBatch(Model* model)
 
-    \brief Draw objects that have a TextRenderer component
+    \brief Draws all glyphs in the text batch with a single call
 */
 /******************************************************************************/
-    void DrawTextObject(Shader* shader, Model* model,
-                        TextRenderer* text_renderer);
+    void DrawTextBatch(Model* model);
 
 /******************************************************************************/
 /*!
-    \fn DrawUIObject(Shader* shader, Model* model, IRenderer* i_renderer)
+    \fn LoadBatchSettings()
 
-    \brief Draw UI objects that have a IRenderer component
+    \brief Loads the size and ring segments of the world sprite batch, and
+           whether sprites are drawn instanced, from JSON
 */
 /******************************************************************************/
-    void DrawUIObject(Shader* shader, Model* model, IRenderer* i_renderer);
+    void LoadBatchSettings();
 
 /******************************************************************************/
 /*!
-    \fn DrawHealthbar(Shader* shader, Model* model, IRenderer* i_renderer)
+    \fn LoadUIFills()
 
-    \brief Draws the healthbar
+    \brief Loads the UI elements drawn as masked fills from JSON
 */
 /******************************************************************************/
-    void DrawHealthbar(Shader* shader, Model* model, IRenderer* i_renderer);
+    void LoadUIFills();
+
+/******************************************************************************/
+/*!
+    \fn RebuildUIEntries()
+
+    \brief Resolves the components of every UI renderer in layer order
+*/
+/******************************************************************************/
+    void RebuildUIEntries();
+
+/******************************************************************************/
+/*!
+    \fn BatchUIFill(UIBatch& batch, const UIEntry& entry)
+
+    \brief Adds the four quads of a masked fill element to a UI batch
+*/
+/******************************************************************************/
+    void BatchUIFill(UIBatch& batch, const UIEntry& entry);
+
+/******************************************************************************/
+/*!
+    \fn DrawUIBand(UIBand band, Shader* shader, Model* model)
+
+    \brief Records the UI renderers of a band, uploads them if they changed
+           since the last frame and draws them
+*/
+/******************************************************************************/
+    void DrawUIBand(UIBand band, Shader* shader, Model* model);
 
 /******************************************************************************/
 /*!
@@ -467,6 +598,25 @@ void RemoveTextRendererComponent(EntityID id);
 /******************************************************************************/
     void EnableLighting(bool value);
 
+/******************************************************************************/
+/*!
+    \fn EnableInstancedSprites()
+
+    \brief Draws world sprites as one instance record each instead of four
+           vertices
+*/
+/******************************************************************************/
+    void EnableInstancedSprites(bool value);
+
+/******************************************************************************/
+/*!
+    \fn InstancedSprites()
+
+    \brief Returns whether world sprites are drawn instanced
+*/
+/******************************************************************************/
+    bool InstancedSprites() const;
+
 /******************************************************************************/
 /*!
     \fn EntitiesWithThisTexture()
@@ -283,13 +283,13 @@ public:
 /******************************************************************************/
 /*!
 	\fn DeletePopUp(const char* windowName, std::string objName, 
-	Entity* entity = nullptr, std::shared_ptr<Component> component = nullptr)
+	Entity* entity = nullptr, Component* component = nullptr)
 
 	\brief Manages the pop up for deletion of entities/archetype/components
 */
 /******************************************************************************/
 	void DeletePopUp(const char* windowName, std::string objName, Entity* entity = nullptr, 
-					std::shared_ptr<Component> component = nullptr);
+					Component* component = nullptr);
 
 /******************************************************************************/
 /*!
@@ -0,0 +1,199 @@
+/**********************************************************************************
+*\file         LevelCache.h
+*\brief        Contains declaration of functions and variables used for
+*			   cooking levels into a binary format that loads without
+*			   parsing the JSON entity files
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _LEVEL_CACHE_H_
+#define _LEVEL_CACHE_H_
+
+#include "Entity/CloneReader.h"
+#include "Entity/ComponentTypes.h"
+#include "Manager/MappedFile.h"
+#include <string>
+#include <vector>
+
+/******************************************************************************/
+/*!
+	\class LevelCook
+
+	\brief Records a level while it is loaded from JSON. Each archetype holds
+		   its entities, and each entity the binary blocks its components
+		   were cloned with
+*/
+/******************************************************************************/
+class LevelCook {
+
+	std::vector<std::string> sources_;
+	std::vector<unsigned char> archetypes_;
+	uint32_t archetype_count_;
+
+	// Offsets of the counts and size being filled in
+	size_t entity_count_at_;
+	size_t component_count_at_;
+	size_t block_size_at_;
+
+/******************************************************************************/
+/*!
+	\fn Increment(size_t offset)
+
+	\brief Adds one to a count already written into the archetypes
+*/
+/******************************************************************************/
+	void Increment(size_t offset);
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn LevelCook()
+
+	\brief Constructs an empty recording
+*/
+/******************************************************************************/
+	LevelCook();
+
+/******************************************************************************/
+/*!
+	\fn AddSource(const std::string& path)
+
+	\brief Adds a file the level was loaded from. The cooked level is stale
+		   once any of them changes
+*/
+/******************************************************************************/
+	void AddSource(const std::string& path);
+
+/******************************************************************************/
+/*!
+	\fn BeginArchetype(const std::string& name)
+
+	\brief Starts recording the entities cloned from an archetype
+*/
+/******************************************************************************/
+	void BeginArchetype(const std::string& name);
+
+/******************************************************************************/
+/*!
+	\fn BeginEntity()
+
+	\brief Starts recording a new entity of the current archetype
+*/
+/******************************************************************************/
+	void BeginEntity();
+
+/******************************************************************************/
+/*!
+	\fn BeginComponent(ComponentTypes type)
+
+	\brief Starts recording a component of the current entity, returns the
+		   block its values are to be appended to
+*/
+/******************************************************************************/
+	std::vector<unsigned char>* BeginComponent(ComponentTypes type);
+
+/******************************************************************************/
+/*!
+	\fn EndComponent()
+
+	\brief Finishes the block of the current component
+*/
+/******************************************************************************/
+	void EndComponent();
+
+/******************************************************************************/
+/*!
+	\fn GetSources()
+
+	\brief Gets the files the level was loaded from
+*/
+/******************************************************************************/
+	const std::vector<std::string>& GetSources() const { return sources_; }
+
+/******************************************************************************/
+/*!
+	\fn GetArchetypes()
+
+	\brief Gets the recorded archetypes
+*/
+/******************************************************************************/
+	const std::vector<unsigned char>& GetArchetypes() const { return archetypes_; }
+
+/******************************************************************************/
+/*!
+	\fn GetArchetypeCount()
+
+	\brief Gets the number of recorded archetypes
+*/
+/******************************************************************************/
+	uint32_t GetArchetypeCount() const { return archetype_count_; }
+};
+
+/******************************************************************************/
+/*!
+	\class LevelCache
+
+	\brief Stores cooked levels in a directory, one file per level JSON. The
+		   JSON files stay the authoring format, a cooked level is written
+		   whenever one is loaded from them
+*/
+/******************************************************************************/
+class LevelCache {
+
+	std::string directory_;
+
+/******************************************************************************/
+/*!
+	\fn GetCookedPath(const std::string& level_file)
+
+	\brief Gets the path of the cooked file of a level JSON
+*/
+/******************************************************************************/
+	std::string GetCookedPath(const std::string& level_file) const;
+
+public:
+
+	static constexpr uint32_t magic_ = 0x564C4250; // "PBLV"
+	static constexpr uint32_t version_ = 2;
+
+/******************************************************************************/
+/*!
+	\fn Init(const std::string& directory)
+
+	\brief Sets and creates the directory the cooked levels are kept in
+*/
+/******************************************************************************/
+	void Init(const std::string& directory);
+
+/******************************************************************************/
+/*!
+	\fn Load(const std::string& level_file, MappedFile& cooked,
+			 CloneReader& archetypes)
+
+	\brief Maps the cooked file of a level and points archetypes at its
+		   recorded archetypes. Returns false if there is none, or if any
+		   of the files it was cooked from or the component layout has
+		   changed since
+*/
+/******************************************************************************/
+	bool Load(const std::string& level_file, MappedFile& cooked, CloneReader& archetypes) const;
+
+/******************************************************************************/
+/*!
+	\fn Save(const std::string& level_file, const LevelCook& cook)
+
+	\brief Writes a recorded level as the cooked file of a level JSON
+*/
+/******************************************************************************/
+	void Save(const std::string& level_file, const LevelCook& cook) const;
+};
+
+#endif
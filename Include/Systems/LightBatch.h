@@ -0,0 +1,117 @@
+/**********************************************************************************
+*\file         LightBatch.h
+*\brief        Contains declaration of functions and variables used for
+*			   packing lights into instance records
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef LIGHTBATCH_H
+#define LIGHTBATCH_H
+
+#include <vector>
+#include <glm/glm.hpp>
+
+/******************************************************************************/
+/*!
+	\class LightBatch
+
+	\brief Packs the parameters of one type of light into preallocated
+		   instance records, without touching OpenGL, so that every light of
+		   the type is drawn by a single instanced call
+*/
+/******************************************************************************/
+class LightBatch {
+
+public:
+
+	// One light, center and radius are in window pixels, angle in radians
+	struct Instance {
+
+		glm::vec2 center_;
+		glm::vec2 direction_;
+		glm::vec3 color_;
+		float intensity_;
+		float radius_;
+		float angle_;
+	};
+
+/******************************************************************************/
+/*!
+	\fn Init(size_t capacity)
+
+	\brief Allocates storage for capacity lights
+*/
+/******************************************************************************/
+	void Init(size_t capacity);
+
+/******************************************************************************/
+/*!
+	\fn Clear()
+
+	\brief Empties the batch for the next frame
+*/
+/******************************************************************************/
+	void Clear() { count_ = 0; }
+
+/******************************************************************************/
+/*!
+	\fn Add(const glm::vec2& center, const glm::vec3& color, float intensity,
+			float radius, const glm::vec2& direction, float angle)
+
+	\brief Packs a light, its angle is given in degrees. Returns false if the
+		   batch is full
+*/
+/******************************************************************************/
+	bool Add(const glm::vec2& center, const glm::vec3& color, float intensity,
+			 float radius, const glm::vec2& direction = glm::vec2{ 1.0f, 0.0f }, float angle = 0.0f);
+
+/******************************************************************************/
+/*!
+	\fn Data()
+
+	\brief Returns the packed instances
+*/
+/******************************************************************************/
+	const Instance* Data() const { return instances_.data(); }
+
+/******************************************************************************/
+/*!
+	\fn Count()
+
+	\brief Returns the number of lights packed
+*/
+/******************************************************************************/
+	size_t Count() const { return count_; }
+
+/******************************************************************************/
+/*!
+	\fn Bytes()
+
+	\brief Returns the size of the packed instances in bytes
+*/
+/******************************************************************************/
+	size_t Bytes() const { return count_ * sizeof(Instance); }
+
+/******************************************************************************/
+/*!
+	\fn Capacity()
+
+	\brief Returns the number of lights the batch can hold
+*/
+/******************************************************************************/
+	size_t Capacity() const { return instances_.size(); }
+
+private:
+
+	std::vector<Instance> instances_;
+	size_t count_;
+};
+
+#endif
@@ -21,17 +21,31 @@
 #include "Components/PointLight.h"
 #include "Components/ConeLight.h"
 #include "Manager/ComponentManager.h"
+#include "Systems/LightBatch.h"
 #include <unordered_map>
 #include <windows.h>
 #include <GL/glew.h>
 
+class PartitioningSystem;
+
 class LightingSystem : public ISystem {
 
 	bool debug_;
 
-	std::map<std::string, Shader*> lighting_shaders_;
 	Model* light_model_;
 
+	// Visible lights of each type, packed while their positions are updated
+	enum LightSegment {
+
+		ConeSegment,
+		PointSegment,
+		SegmentCount
+	};
+
+	static constexpr size_t max_lights_ = 1024;
+	LightBatch light_batches_[SegmentCount];
+	Shader* light_shaders_[SegmentCount];
+
 	GLuint lighting_buffer;
 	GLuint lighting_texture;
 	GLuint addition_buffer;
@@ -41,6 +55,7 @@ class LightingSystem : public ISystem {
 	WindowsSystem* windows_system_;
 	CameraSystem* camera_system_;
 	GraphicsSystem* graphics_system_;
+	PartitioningSystem* partitioning_;
 	ComponentManager* component_manager_;
 
 	glm::vec2 win_size_;
@@ -150,21 +165,22 @@ public:
 
 /******************************************************************************/
 /*!
-	\fn DrawPointLight(Shader* shader, PointLight* point_light, float cam_zoom)
+	\fn UpdateLightDirection(ConeLight* cone_light)
 
-	\brief Draws the Point Light component
+	\brief Points the Cone Light component in the direction its entity moves
 */
 /******************************************************************************/
-	void DrawPointLight(Shader* shader, PointLight* point_light, float cam_zoom);
+	void UpdateLightDirection(ConeLight* cone_light);
 
 /******************************************************************************/
 /*!
-	\fn DrawConeLight(Shader* shader, ConeLight* cone_light)
+	\fn DrawLightBatch(LightSegment segment)
 
-	\brief Draws the Cone Light component
+	\brief Uploads the lights packed for a light type and draws all of them
+		   with one instanced call
 */
 /******************************************************************************/
-	void DrawConeLight(Shader* shader, ConeLight* cone_light, float cam_zoom);
+	void DrawLightBatch(LightSegment segment);
 
 /******************************************************************************/
 /*!
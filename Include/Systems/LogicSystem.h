@@ -15,11 +15,15 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <vector>
+#include <memory>
 #include "Systems/Message.h"
 #include "Components/AI.h"
 #include "Systems/ISystem.h"
 #include "Manager/ComponentManager.h"
 #include "Components/ParentChild.h"
+#include "Manager/BehaviourTree.h"
+#include "Systems/WorkerPool.h"
 
 using AIIt = std::unordered_map<EntityID, AI*>::iterator;
 using AIType = CMap<AI>;
@@ -27,9 +31,96 @@ using AIIt = AIType::MapTypeIt;
 
 class LogicSystem: public ISystem{
 
+	// Compiled tree shared by every AI of one type and level, along with the
+	// AI that are ticked together with it this frame
+	struct TreeGroup
+	{
+		AI::AIType type_;
+		int level_;
+		Behaviour::Tree tree_;
+		std::vector<AI*> agents_;
+	};
+
 	//std::unordered_map<EntityID, AI*> ai_arr_;
 	AIType* ai_arr_;
 	ComponentManager* comp_mgr;
+	std::vector<std::unique_ptr<TreeGroup>> groups_;
+	Behaviour::Context context_;
+
+	// Distance from the player up to which each level of detail applies, and
+	// the number of fixed steps between ticks of an agent at that level
+	float lod_range_[Behaviour::LodCount - 1];
+	uint32_t lod_rate_[Behaviour::LodCount];
+
+	// Maximum number of agents ticked in a single step, 0 for no limit
+	size_t tick_budget_;
+	uint32_t tick_count_;
+	std::vector<AI*> due_;
+
+	// Agents ticked on the main thread execute their commands immediately,
+	// each parallel batch records into its own buffer instead
+	Behaviour::Commands commands_;
+	std::vector<Behaviour::Commands> batch_commands_;
+	std::vector<AI*> order_;
+	bool parallel_;
+
+	// Minimum number of agents in each parallel batch
+	size_t batch_size_;
+
+	// Started the first time parallel ticking is enabled
+	WorkerPool workers_;
+
+	/******************************************************************************/
+	/*!
+	  \fn DeSerialize()
+
+	  \brief Reads the level of detail settings from the AI config file
+	*/
+	/******************************************************************************/
+	void DeSerialize();
+
+	/******************************************************************************/
+	/*!
+	  \fn ComputeLod()
+
+	  \brief Returns the level of detail of an agent from its distance to the
+			 player
+	*/
+	/******************************************************************************/
+	Behaviour::TickLod ComputeLod(const Behaviour::Agent& agent) const;
+
+	/******************************************************************************/
+	/*!
+	  \fn IsDue()
+
+	  \brief Checks whether an agent should be ticked this step. Agents are
+			 offset by their id so that agents of the same level of detail are
+			 spread across steps, an agent whose tick was skipped is due until
+			 it is ticked
+	*/
+	/******************************************************************************/
+	bool IsDue(const Behaviour::Agent& agent) const;
+
+	/******************************************************************************/
+	/*!
+	  \fn TickParallel()
+
+	  \brief Splits the agents due this step into batches that are ticked on
+			 the worker pool, then applies the commands of every batch on the
+			 main thread in batch order
+	*/
+	/******************************************************************************/
+	void TickParallel();
+
+	/******************************************************************************/
+	/*!
+	  \fn UpdateContext()
+
+	  \brief Resolves the per tick data shared by every agent, returns false if
+			 there is no player for the agents to act upon
+	*/
+	/******************************************************************************/
+	bool UpdateContext();
 
 public:
 
@@ -51,6 +142,49 @@ public:
 	/******************************************************************************/
 	virtual void Update(float frametime) override;
 
+	/******************************************************************************/
+	/*!
+	  \fn GetTree()
+
+	  \brief Returns the shared tree for AI of a type and level, compiling it on
+			 first use. Returns nullptr for types without a tree
+	*/
+	/******************************************************************************/
+	const Behaviour::Tree* GetTree(AI::AIType type, int level);
+
+	/******************************************************************************/
+	/*!
+	  \fn SetLod()
+
+	  \brief Sets the range up to which a level of detail applies and the number
+			 of fixed steps between ticks at that level. The range of FarLod is
+			 ignored
+	*/
+	/******************************************************************************/
+	void SetLod(Behaviour::TickLod lod, float range, uint32_t rate);
+
+	/******************************************************************************/
+	/*!
+	  \fn SetTickBudget()
+
+	  \brief Sets the maximum number of agents ticked in a single step. The
+			 agents that waited the longest relative to their rate are ticked
+			 first, then the nearer ones, and skipped agents wait longer on
+			 the following steps. 0 removes the limit
+	*/
+	/******************************************************************************/
+	void SetTickBudget(size_t budget) { tick_budget_ = budget; }
+
+	/******************************************************************************/
+	/*!
+	  \fn SetParallel()
+
+	  \brief Sets whether agents are ticked on worker threads once there are
+			 enough agents for at least two batches of batch_size
+	*/
+	/******************************************************************************/
+	void SetParallel(bool parallel, size_t batch_size);
+
 	/******************************************************************************/
 	/*!
 	  \fn Draw()
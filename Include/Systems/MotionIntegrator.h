@@ -0,0 +1,103 @@
+/**********************************************************************************
+*\file         MotionIntegrator.h
+*\brief        Contains declaration of functions and variables used for the
+*			   batched Motion/Transform integrator
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#ifndef _MOTION_INTEGRATOR_H_
+#define _MOTION_INTEGRATOR_H_
+
+#include <vector>
+#include <cstddef>
+
+// Select the widest kernel the compiler was allowed to emit
+#if defined(__AVX__)
+#define PE_MOTION_AVX
+#endif
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define PE_MOTION_SSE
+#endif
+
+class Motion;
+class Transform;
+
+// Structure of arrays holding every dynamic body for a single integration step
+struct MotionBatch
+{
+	// Packed simulation data
+	std::vector<float> pos_x_, pos_y_;
+	std::vector<float> vel_x_, vel_y_;
+	std::vector<float> acc_x_, acc_y_;
+	std::vector<float> force_x_, force_y_;
+	std::vector<float> inv_mass_;
+
+	// Rotation applied to the change in velocity, identity for non particles
+	std::vector<float> cos_, sin_;
+
+	// Components the results are scattered back into
+	std::vector<Motion*> motions_;
+	std::vector<Transform*> transforms_;
+
+	size_t size_ = 0;
+
+/******************************************************************************/
+/*!
+  \fn Clear()
+
+  \brief Empties the batch without releasing the capacity of the arrays
+*/
+/******************************************************************************/
+	void Clear();
+
+/******************************************************************************/
+/*!
+  \fn Reserve()
+
+  \brief Resizes the packed arrays to hold at least count bodies, the arrays
+		 are padded so the kernels never need to handle a partial register
+*/
+/******************************************************************************/
+	void Reserve(size_t count);
+
+/******************************************************************************/
+/*!
+  \fn Push()
+
+  \brief Appends a body to the batch and returns the index the caller fills
+		 the packed data at. transform may be nullptr, in which case only the
+		 velocity is integrated
+*/
+/******************************************************************************/
+	size_t Push(Motion* motion, Transform* transform);
+};
+
+/******************************************************************************/
+/*!
+  \fn IntegrateMotion()
+
+  \brief Computes acceleration, damped velocity, zero snapping and the new
+		 position for every body in the batch. Uses AVX or SSE when available
+		 and falls back to scalar code for the remainder
+*/
+/******************************************************************************/
+void IntegrateMotion(MotionBatch& batch, float frametime);
+
+/******************************************************************************/
+/*!
+  \fn IntegrateMotionScalar()
+
+  \brief Reference scalar implementation of IntegrateMotion over the range
+		 [begin, end) of the batch
+*/
+/******************************************************************************/
+void IntegrateMotionScalar(MotionBatch& batch, size_t begin, size_t end, float frametime);
+
+#endif
@@ -40,6 +40,10 @@ public:
 
 	using AnimationRendererMap = CMap<AnimationRenderer>;
 
+	using PointLightMap = CMap<PointLight>;
+
+	using ConeLightMap = CMap<ConeLight>;
+
 	using AABBMap = CMap<AABB>;
 	using AABBMapIt = AABBMap::MapTypeIt;
 
@@ -151,22 +155,56 @@ public:
 /******************************************************************************/
 	const EntityIDSet& GetActiveEntityIDs() const;
 
+/******************************************************************************/
+/*!
+  \fn IsRendererVisible()
+
+  \brief Returns whether a world renderer intersects the main camera's view.
+		 Everything is visible when there is no camera or partition
+*/
+/******************************************************************************/
+	bool IsRendererVisible(EntityID id) const;
+
+/******************************************************************************/
+/*!
+  \fn IsLightVisible()
+
+  \brief Returns whether a point or cone light intersects the main camera's
+		 view. Everything is visible when there is no camera or partition
+*/
+/******************************************************************************/
+	bool IsLightVisible(EntityID id) const;
+
 private:
 	
 	// Data members
 	ComponentManager* component_manager_;
 	AnimationRendererMap* animation_map_;
+	PointLightMap* point_light_map_;
+	ConeLightMap* cone_light_map_;
 	TextureRendererMap* texture_map_;
 	TransformMap* transform_map_;
 	AABBMap* aabb_map_;
 
 	PartitionAxis x_, y_;
 	PartitionAxis renderer_x_, renderer_y_;
+	PartitionAxis light_x_, light_y_;
 	size_t grid_size_;
 	Vector2D abs_bottom_left_;
 	Vector2D abs_top_right_;
 	EntityIDSet id_set_;
 
+	// Renderers and lights within the camera's view, only valid when
+	// visibility_valid_ is set
+	Bitset visible_renderers_;
+	Bitset visible_lights_;
+	bool visibility_valid_;
+
+	// Renderers and lights placed in the axes this frame, anything else
+	// has no bounds and is never culled
+	Bitset partitioned_renderers_;
+	Bitset partitioned_lights_;
+
 
 	// Private helper functions
 	void ComputeBoundaries(const Vector2D& camera_pos, const float& camera_zoom, Vector2D& bottom_left, Vector2D& top_right);
@@ -174,12 +212,18 @@ private:
 	void ComputePartitionBoundaries(Vector2D& bottom_left, Vector2D& top_right);
 	void InitEntityInPartition(const EntityID& id);
 	void InitRendererInPartition(const EntityID& id);
+	void InitLightInPartition(const EntityID& id, float radius);
+	void SetBoundsInPartition(PartitionAxis& x_axis, PartitionAxis& y_axis, const EntityID& id,
+							  const Vector2D& pos, const Vector2D& half_extent);
+	Bitset GetVisibleInAxes(const PartitionAxis& x_axis, const PartitionAxis& y_axis,
+							const My::Vector2D<size_t>& bottom_left, const My::Vector2D<size_t>& top_right) const;
 
 /******************************************************************************/
 /*!
   \fn GetPartitionedEntities()
 
-  \brief Stores all entities on the screen into an unordered_set
+  \brief Stores all entities on the screen into an unordered_set, and the
+		 renderers and lights on the screen into the visibility bitsets
 */
 /******************************************************************************/
 	void ComputePartitionedEntities();
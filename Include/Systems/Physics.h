@@ -29,6 +29,7 @@
 #include "Manager/LogicManager.h"
 #include "Components/Motion.h"
 #include "Components/Status.h"
+#include "Systems/MotionIntegrator.h"
 #include <unordered_map>
 
 class Physics : public ISystem
@@ -79,8 +80,9 @@ public:
 /*!
   \fn Update()
 
-  \brief Computes the new velocity for every Motion component and then
-		 updates the Transform components based on that new Motion component
+  \brief Gathers every live Motion component into a packed batch, integrates
+		 the batch and scatters the new velocity and position back into the
+		 Motion and Transform components
 */
 /******************************************************************************/
 	virtual void Update(float frametime) override;
@@ -112,6 +114,10 @@ private:
 	GraphicsSystem* graphics_sys_;
 	ComponentManager* component_mgr_;
 	LogicManager* logic_mgr_;
+	EntityManager* entity_mgr_;
+
+	// Interned name of the entities moved by player input
+	NameID player_name_;
 	
 	// Component map pointers
 	TransformType* transform_arr_;
@@ -122,6 +128,9 @@ private:
 	using LogicComponentType = CMap<LogicComponent>;
 	using LogicIt = LogicComponentType::MapTypeIt;
 	LogicComponentType* logic_arr_;
+
+	// Packed bodies integrated each step, capacity is kept between steps
+	MotionBatch batch_;
 };
 
 /******************************************************************************/
@@ -0,0 +1,125 @@
+/**********************************************************************************
+*\file         RenderQueue.h
+*\brief        Contains declaration of functions and variables used for
+*			   the draw key sorted render queue
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+               or disclosure of this file or its contents without the prior
+               written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <vector>
+#include <cstdint>
+#include <GL/glew.h>
+
+class IRenderer;
+class Transform;
+class Scale;
+
+/******************************************************************************/
+/*!
+    \class RenderQueue
+
+    \brief Flat array of world renderers keyed by a 64 bit draw key, rebuilt
+           and radix sorted every frame. From the most significant bits:
+
+           layer    16 bits, drawn from lowest to highest
+           depth    32 bits, drawn from highest y to lowest y
+           texture  12 bits, groups equal depth sprites sharing a texture
+           material  4 bits, reserved, every world object uses ObjectShader
+*/
+/******************************************************************************/
+class RenderQueue {
+
+public:
+
+    struct Item {
+
+        uint64_t key_;
+        IRenderer* renderer_;
+        Transform* transform_;
+        Scale* scale_;
+    };
+
+    using ItemIt = std::vector<Item>::const_iterator;
+
+/******************************************************************************/
+/*!
+    \fn MakeKey(int layer, float depth, GLuint texture, uint8_t material)
+
+    \brief Packs the sorting criteria of a renderer into a draw key
+*/
+/******************************************************************************/
+    static uint64_t MakeKey(int layer, float depth, GLuint texture, uint8_t material = 0);
+
+/******************************************************************************/
+/*!
+    \fn Clear()
+
+    \brief Empties the queue, keeping its storage for the next frame
+*/
+/******************************************************************************/
+    void Clear();
+
+/******************************************************************************/
+/*!
+    \fn Push(uint64_t key, IRenderer* renderer, Transform* transform,
+             Scale* scale)
+
+    \brief Adds a renderer to the queue along with the components used to
+           batch it
+*/
+/******************************************************************************/
+    void Push(uint64_t key, IRenderer* renderer, Transform* transform, Scale* scale);
+
+/******************************************************************************/
+/*!
+    \fn Sort()
+
+    \brief Sorts the queue by draw key with a stable LSD radix sort, passes
+           where every key shares the same byte are skipped
+*/
+/******************************************************************************/
+    void Sort();
+
+/******************************************************************************/
+/*!
+    \fn Size()
+
+    \brief Returns the number of renderers in the queue
+*/
+/******************************************************************************/
+    size_t Size() const { return items_.size(); }
+
+/******************************************************************************/
+/*!
+    \fn begin()
+
+    \brief Returns an iterator to the first renderer in draw order
+*/
+/******************************************************************************/
+    ItemIt begin() const { return items_.begin(); }
+
+/******************************************************************************/
+/*!
+    \fn end()
+
+    \brief Returns an iterator past the last renderer in draw order
+*/
+/******************************************************************************/
+    ItemIt end() const { return items_.end(); }
+
+private:
+
+    std::vector<Item> items_;
+    std::vector<Item> scratch_;
+};
+
+#endif
@@ -0,0 +1,137 @@
+/**********************************************************************************
+*\file         SnapshotStore.h
+*\brief        Contains declaration of functions and variables used for
+*			   keeping save game snapshots of the world in memory and on disk
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _SNAPSHOT_STORE_H_
+#define _SNAPSHOT_STORE_H_
+
+#include "Entity/CloneReader.h"
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/******************************************************************************/
+/*!
+	\class SnapshotStore
+
+	\brief Keeps snapshots of the world by slot name, the latest of each in
+		   memory and in a file of a directory. A saved snapshot is never
+		   changed, so its file is written on a background thread while the
+		   game goes on. Saves made while one is being written are queued,
+		   and a later save of a slot replaces one still waiting
+*/
+/******************************************************************************/
+class SnapshotStore {
+
+public:
+
+	using Snapshot = std::shared_ptr<const std::vector<unsigned char>>;
+
+private:
+
+	std::string directory_;
+	std::map<std::string, Snapshot> snapshots_;
+
+	// Files waiting to be written by path, only touched under write_lock_
+	std::mutex write_lock_;
+	std::map<std::string, Snapshot> queued_writes_;
+	bool writing_;
+	std::future<void> writer_;
+
+/******************************************************************************/
+/*!
+	\fn GetPath(const std::string& slot)
+
+	\brief Gets the path of the file of a slot
+*/
+/******************************************************************************/
+	std::string GetPath(const std::string& slot) const;
+
+/******************************************************************************/
+/*!
+	\fn WriteQueued()
+
+	\brief Writes the queued files one at a time until none are left, runs
+		   on the background thread
+*/
+/******************************************************************************/
+	void WriteQueued();
+
+public:
+
+	static constexpr uint32_t magic_ = 0x56534250; // "PBSV"
+	static constexpr uint32_t version_ = 3;
+
+/******************************************************************************/
+/*!
+	\fn SnapshotStore()
+
+	\brief Constructs a store with no snapshots
+*/
+/******************************************************************************/
+	SnapshotStore();
+
+/******************************************************************************/
+/*!
+	\fn ~SnapshotStore()
+
+	\brief Waits for the queued files to be written
+*/
+/******************************************************************************/
+	~SnapshotStore();
+
+/******************************************************************************/
+/*!
+	\fn Init(const std::string& directory)
+
+	\brief Sets and creates the directory the snapshot files are kept in
+*/
+/******************************************************************************/
+	void Init(const std::string& directory);
+
+/******************************************************************************/
+/*!
+	\fn Save(const std::string& slot, std::vector<unsigned char>&& contents)
+
+	\brief Keeps contents as the snapshot of a slot and queues it to be
+		   written to the slot's file. Never waits for an earlier write
+*/
+/******************************************************************************/
+	void Save(const std::string& slot, std::vector<unsigned char>&& contents);
+
+/******************************************************************************/
+/*!
+	\fn Load(const std::string& slot, Snapshot& snapshot, CloneReader& contents)
+
+	\brief Gets the snapshot of a slot, read from its file if it was not saved
+		   since the game started, and points contents at what was saved.
+		   Returns false if there is none, or if its file is of another version
+		   or was saved by a build with another component layout
+*/
+/******************************************************************************/
+	bool Load(const std::string& slot, Snapshot& snapshot, CloneReader& contents);
+
+/******************************************************************************/
+/*!
+	\fn Wait()
+
+	\brief Waits until every queued file is written
+*/
+/******************************************************************************/
+	void Wait();
+};
+
+#endif
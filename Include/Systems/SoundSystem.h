@@ -198,6 +198,16 @@ public:
 /******************************************************************************/
 	void LoadSound(std::string name, std::stringstream& data);
 
+/******************************************************************************/
+/*!
+  \fn GetSoundSize()
+
+  \brief Returns the bytes a loaded sound file is decoded into, or 0 if it
+		 is not loaded
+*/
+/******************************************************************************/
+	size_t GetSoundSize(std::string name);
+
 /******************************************************************************/
 /*!
   \fn PlaySound()
@@ -249,7 +259,7 @@ public:
 /*!
   \fn RemoveSound()
 
-  \brief Removes a sound file that is currently loaded
+  \brief Removes a sound file that is currently loaded and releases it
 */
 /******************************************************************************/
 	void RemoveSound(std::string name);
@@ -264,6 +274,16 @@ public:
 /******************************************************************************/
 	void RemoveCompletedChannel();
 
+/******************************************************************************/
+/*!
+  \fn ResetPlayer()
+
+  \brief Forgets the player entity sounds are heard from, it is found again
+         on the next update. Called whenever the entities are destroyed
+*/
+/******************************************************************************/
+	void ResetPlayer();
+
 /******************************************************************************/
 /*!
   \fn Init()
@@ -0,0 +1,193 @@
+/**********************************************************************************
+*\file         SpriteBatch.h
+*\brief        Contains declaration of functions and variables used for
+*			   building the world sprite vertex stream
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+               or disclosure of this file or its contents without the prior
+               written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+
+#include <vector>
+#include <glm/glm.hpp>
+
+/******************************************************************************/
+/*!
+    \class SpriteBatch
+
+    \brief Builds the per sprite data of one batch into preallocated storage,
+           without touching OpenGL. The GPU buffer it is uploaded to is a ring
+           of segments, one batch each, so a batch is never written into the
+           part of the buffer the previous draw is still reading from.
+
+           Sprites are either written as four interleaved vertices, or as a
+           single instance record when instancing is enabled.
+*/
+/******************************************************************************/
+class SpriteBatch {
+
+public:
+
+    // One corner of a sprite, the corner position itself is static in the model
+    struct Vertex {
+
+        glm::vec2 tex_vtx_;
+        glm::vec2 scaling_;
+        glm::vec2 rotation_;
+        glm::vec2 position_;
+        float texture_id_;
+    };
+
+    // One sprite, texture coordinates of corner 0 in xy and corner 3 in zw
+    struct Instance {
+
+        glm::vec4 tex_rect_;
+        glm::vec2 scaling_;
+        glm::vec2 rotation_;
+        glm::vec2 position_;
+        float texture_id_;
+    };
+
+/******************************************************************************/
+/*!
+    \fn Init(size_t capacity, size_t segments, bool instanced)
+
+    \brief Allocates storage for capacity sprites per batch, the ring holds
+           segments batches
+*/
+/******************************************************************************/
+    void Init(size_t capacity, size_t segments, bool instanced);
+
+/******************************************************************************/
+/*!
+    \fn Add(const glm::vec2* tex_vtx, const glm::vec2& scaling,
+            const glm::vec2& rotation, const glm::vec2& position,
+            float texture_id)
+
+    \brief Writes a sprite into the batch, tex_vtx points to its 4 corners.
+           The batch must not be full
+*/
+/******************************************************************************/
+    void Add(const glm::vec2* tex_vtx, const glm::vec2& scaling,
+             const glm::vec2& rotation, const glm::vec2& position, float texture_id);
+
+/******************************************************************************/
+/*!
+    \fn Advance()
+
+    \brief Empties the batch after it has been drawn and moves on to the next
+           segment of the ring
+*/
+/******************************************************************************/
+    void Advance();
+
+/******************************************************************************/
+/*!
+    \fn Full()
+
+    \brief Returns whether the batch has reached its capacity
+*/
+/******************************************************************************/
+    bool Full() const { return count_ == capacity_; }
+
+/******************************************************************************/
+/*!
+    \fn Empty()
+
+    \brief Returns whether no sprite has been added since the last Advance
+*/
+/******************************************************************************/
+    bool Empty() const { return count_ == 0; }
+
+/******************************************************************************/
+/*!
+    \fn Count()
+
+    \brief Returns the number of sprites in the batch
+*/
+/******************************************************************************/
+    size_t Count() const { return count_; }
+
+/******************************************************************************/
+/*!
+    \fn Instanced()
+
+    \brief Returns whether sprites are written as instance records
+*/
+/******************************************************************************/
+    bool Instanced() const { return instanced_; }
+
+/******************************************************************************/
+/*!
+    \fn Data()
+
+    \brief Returns the sprite data of the batch, ready to be uploaded
+*/
+/******************************************************************************/
+    const void* Data() const;
+
+/******************************************************************************/
+/*!
+    \fn Bytes()
+
+    \brief Returns the size of the sprite data of the batch
+*/
+/******************************************************************************/
+    size_t Bytes() const { return count_ * SpriteStride(); }
+
+/******************************************************************************/
+/*!
+    \fn SpriteStride()
+
+    \brief Returns the bytes written per sprite
+*/
+/******************************************************************************/
+    size_t SpriteStride() const;
+
+/******************************************************************************/
+/*!
+    \fn Segment()
+
+    \brief Returns the index of the ring segment the batch is uploaded to
+*/
+/******************************************************************************/
+    size_t Segment() const { return segment_; }
+
+/******************************************************************************/
+/*!
+    \fn SegmentOffset()
+
+    \brief Returns the byte offset of the current segment within the ring
+*/
+/******************************************************************************/
+    size_t SegmentOffset() const { return segment_ * capacity_ * SpriteStride(); }
+
+/******************************************************************************/
+/*!
+    \fn RingBytes()
+
+    \brief Returns the size of the GPU buffer holding every segment
+*/
+/******************************************************************************/
+    size_t RingBytes() const { return segments_ * capacity_ * SpriteStride(); }
+
+private:
+
+    std::vector<Vertex> vertices_;
+    std::vector<Instance> instances_;
+
+    size_t capacity_;
+    size_t segments_;
+    size_t segment_;
+    size_t count_;
+    bool instanced_;
+};
+
+#endif
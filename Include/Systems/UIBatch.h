@@ -0,0 +1,164 @@
+/**********************************************************************************
+*\file         UIBatch.h
+*\brief        Contains declaration of functions and variables used for
+*			   building the UI vertex stream
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+               or disclosure of this file or its contents without the prior
+               written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef UIBATCH_H
+#define UIBATCH_H
+
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+/******************************************************************************/
+/*!
+    \class UIBatch
+
+    \brief Records the UI quads of one layer band into a single vertex stream,
+           without touching OpenGL. Consecutive quads are merged into draws
+           that share up to max_textures textures through a sampler array.
+
+           The stream of the previous frame is kept, so the GPU copy only
+           needs to be replaced when the band actually changed.
+*/
+/******************************************************************************/
+class UIBatch {
+
+public:
+
+    // How a draw uses the stencil buffer, used by masked fill elements
+    enum class Stencil : uint8_t {
+
+        None,
+        Write,
+        Test
+    };
+
+    struct Vertex {
+
+        glm::vec2 position_;
+        glm::vec2 tex_coord_;
+        float texture_id_;
+    };
+
+    // A run of quads drawn with one call
+    struct Draw {
+
+        size_t first_;
+        size_t count_;
+        size_t textures_begin_;
+        size_t texture_count_;
+        Stencil stencil_;
+    };
+
+/******************************************************************************/
+/*!
+    \fn Init(size_t capacity, size_t max_textures)
+
+    \brief Allocates storage for capacity quads, each draw binds at most
+           max_textures textures
+*/
+/******************************************************************************/
+    void Init(size_t capacity, size_t max_textures);
+
+/******************************************************************************/
+/*!
+    \fn Begin()
+
+    \brief Starts recording the band for this frame
+*/
+/******************************************************************************/
+    void Begin();
+
+/******************************************************************************/
+/*!
+    \fn Add(const glm::vec2* position, const glm::vec2* tex_vtx,
+            unsigned int texture, Stencil stencil)
+
+    \brief Records a quad, position and tex_vtx point to its 4 corners.
+           Returns false if the band is full
+*/
+/******************************************************************************/
+    bool Add(const glm::vec2* position, const glm::vec2* tex_vtx,
+             unsigned int texture, Stencil stencil = Stencil::None);
+
+/******************************************************************************/
+/*!
+    \fn End()
+
+    \brief Finishes recording and returns whether the vertices differ from
+           the ones recorded last, and so need to be uploaded again
+*/
+/******************************************************************************/
+    bool End();
+
+/******************************************************************************/
+/*!
+    \fn Invalidate()
+
+    \brief Forces the next End to report a change
+*/
+/******************************************************************************/
+    void Invalidate() { invalid_ = true; }
+
+/******************************************************************************/
+/*!
+    \fn Vertices()
+
+    \brief Returns the vertices recorded, four per quad
+*/
+/******************************************************************************/
+    const std::vector<Vertex>& Vertices() const { return vertices_; }
+
+/******************************************************************************/
+/*!
+    \fn Draws()
+
+    \brief Returns the draws recorded, in order
+*/
+/******************************************************************************/
+    const std::vector<Draw>& Draws() const { return draws_; }
+
+/******************************************************************************/
+/*!
+    \fn Textures()
+
+    \brief Returns the textures bound by the draws, a draw's texture_id_
+           values index its own range
+*/
+/******************************************************************************/
+    const std::vector<unsigned int>& Textures() const { return textures_; }
+
+/******************************************************************************/
+/*!
+    \fn Capacity()
+
+    \brief Returns the number of quads the band can hold
+*/
+/******************************************************************************/
+    size_t Capacity() const { return capacity_; }
+
+private:
+
+    std::vector<Vertex> vertices_;
+    std::vector<Draw> draws_;
+    std::vector<unsigned int> textures_;
+
+    // Last frame's vertices, compared against in End
+    std::vector<Vertex> previous_;
+
+    size_t capacity_;
+    size_t max_textures_;
+    bool invalid_;
+};
+
+#endif
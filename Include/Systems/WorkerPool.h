@@ -0,0 +1,106 @@
+/**********************************************************************************
+*\file         WorkerPool.h
+*\brief        Contains declaration of functions and variables used for
+*			   the Worker Pool
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#pragma once
+#ifndef _WORKER_POOL_H_
+#define _WORKER_POOL_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/******************************************************************************/
+/*!
+	\class WorkerPool
+
+	\brief Threads started once and kept waiting between runs. Job 0 of a run
+		   is done by the calling thread and job i by worker i - 1, so a job
+		   index always runs on the same thread
+*/
+/******************************************************************************/
+class WorkerPool {
+
+	std::vector<std::thread> threads_;
+	std::mutex lock_;
+	std::condition_variable start_;
+	std::condition_variable done_;
+
+	const std::function<void(size_t)>* job_;
+	size_t jobs_;
+	size_t pending_;
+	uint64_t generation_;
+	bool stop_;
+
+/******************************************************************************/
+/*!
+	\fn WorkerLoop(size_t worker)
+
+	\brief Waits for runs and does the job of the worker in each
+*/
+/******************************************************************************/
+	void WorkerLoop(size_t worker);
+
+public:
+
+/******************************************************************************/
+/*!
+	\fn WorkerPool()
+
+	\brief Constructor for a pool without workers
+*/
+/******************************************************************************/
+	WorkerPool();
+
+/******************************************************************************/
+/*!
+	\fn ~WorkerPool()
+
+	\brief Stops and joins every worker
+*/
+/******************************************************************************/
+	~WorkerPool();
+
+/******************************************************************************/
+/*!
+	\fn Init(size_t workers, const std::function<void(size_t)>& on_start = {})
+
+	\brief Starts the workers, on_start is called on each with its index
+		   before its first job
+*/
+/******************************************************************************/
+	void Init(size_t workers, const std::function<void(size_t)>& on_start = {});
+
+/******************************************************************************/
+/*!
+	\fn GetWorkerCount()
+
+	\brief Returns the number of workers, not counting the calling thread
+*/
+/******************************************************************************/
+	size_t GetWorkerCount() const { return threads_.size(); }
+
+/******************************************************************************/
+/*!
+	\fn Run(size_t jobs, const std::function<void(size_t)>& job)
+
+	\brief Runs job for every index below jobs and returns once all are done.
+		   jobs may be at most one more than the number of workers
+*/
+/******************************************************************************/
+	void Run(size_t jobs, const std::function<void(size_t)>& job);
+};
+
+#endif
@@ -1,13 +1,13 @@
 #version 450 core
 
-layout (location=0) out vec4 fFragClr;
+layout (location=0) flat in vec2 light_center;
+layout (location=1) flat in vec2 direction;
+layout (location=2) flat in vec3 light_color;
+layout (location=3) flat in float intensity;
+layout (location=4) flat in float radius;
+layout (location=5) flat in float angle;
 
-uniform vec3 light_color;
-uniform vec2 light_center;
-uniform float intensity;
-uniform float radius;
-uniform vec2 direction;
-uniform float angle;
+layout (location=0) out vec4 fFragClr;
 
 void main () {
   
@@ -2,7 +2,13 @@
 
 layout (location=0) in vec2 vVertexPosition;
 
-uniform mat3 world_to_ndc_xform;
+// Per frame data shared by every program, see FrameUniforms in ShaderManager.h
+layout (std140, binding = 0) uniform FrameUniforms {
+
+    mat4 projection;
+    mat3 world_to_ndc_xform;
+    vec2 win_size;
+};
 
 void main() {
     
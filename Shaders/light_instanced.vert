@@ -0,0 +1,44 @@
+#version 450 core
+
+layout (location=0) in vec2 center;
+layout (location=1) in vec2 direction;
+layout (location=2) in vec3 color;
+layout (location=3) in float intensity;
+layout (location=4) in float radius;
+layout (location=5) in float angle;
+
+layout (location=0) flat out vec2 light_center;
+layout (location=1) flat out vec2 light_direction;
+layout (location=2) flat out vec3 light_color;
+layout (location=3) flat out float light_intensity;
+layout (location=4) flat out float light_radius;
+layout (location=5) flat out float light_angle;
+
+// Per frame data shared by every program, see FrameUniforms in ShaderManager.h
+layout (std140, binding = 0) uniform FrameUniforms {
+
+    mat4 projection;
+    mat3 world_to_ndc_xform;
+    vec2 win_size;
+};
+
+// Strip order of the light model's quad corners
+const int corners[4] = int[4]( 2, 0, 3, 1 );
+
+void main() {
+
+    int corner = corners[gl_VertexID];
+    vec2 select = vec2(corner & 1, corner >> 1);
+
+    // Nothing outside the light's radius is lit, so only that square is drawn
+    vec2 pixel = center + (select * 2.0f - 1.0f) * radius;
+
+    gl_Position = vec4(pixel / win_size * 2.0f - 1.0f, 0.0, 1.0);
+
+    light_center = center;
+    light_direction = direction;
+    light_color = color;
+    light_intensity = intensity;
+    light_radius = radius;
+    light_angle = angle;
+}
@@ -1,11 +1,11 @@
 #version 450 core
 
-layout (location=0) out vec4 fFragClr;
+layout (location=0) flat in vec2 light_center;
+layout (location=2) flat in vec3 light_color;
+layout (location=3) flat in float intensity;
+layout (location=4) flat in float radius;
 
-uniform vec3 light_color;
-uniform vec2 light_center;
-uniform float intensity;
-uniform float radius;
+layout (location=0) out vec4 fFragClr;
 
 void main () {
 
@@ -13,4 +13,4 @@ void main () {
   float attenuation = max(0, 1 - dist/radius);
   attenuation *= attenuation;
   fFragClr = intensity * attenuation * vec4(light_color, 1.0);
-}
\ No newline at end of file
+}
@@ -1,14 +1,14 @@
 #version 450 core
 
 layout(location=0) in vec2 vTexCoord;
+layout(location=1) in vec3 vColor;
 
 layout (location=0) out vec4 fFragClr;
 
 uniform sampler2D uTex2d;
-uniform vec3 text_color;
 
 void main () {
     
     vec4 sampled = vec4(1.0, 1.0, 1.0, texture(uTex2d, vTexCoord).r);
-    fFragClr = vec4(text_color, 1.0) * sampled;
-}
\ No newline at end of file
+    fFragClr = vec4(vColor, 1.0) * sampled;
+}
@@ -2,13 +2,22 @@
 
 layout (location=0) in vec2 vVertexPosition;
 layout (location=1) in vec2 vVertexTexCoord;
+layout (location=2) in vec3 vVertexColor;
 
 layout (location=0) out vec2 vTexCoord;
+layout (location=1) out vec3 vColor;
 
-uniform mat4 projection;
+// Per frame data shared by every program, see FrameUniforms in ShaderManager.h
+layout (std140, binding = 0) uniform FrameUniforms {
+
+    mat4 projection;
+    mat3 world_to_ndc_xform;
+    vec2 win_size;
+};
 
 void main() {
         
     gl_Position = projection * vec4(vVertexPosition, 0.0, 1.0);
     vTexCoord = vVertexTexCoord;
+    vColor = vVertexColor;
 }
@@ -1,18 +1,19 @@
 #version 450 core
 
 layout(location=0) in vec2 vTexCoord;
+layout(location=1) flat in int tex_id;
 
 layout (location=0) out vec4 fFragClr;
 
-uniform sampler2D uTex2d;
+uniform sampler2D uTex2d[20];
 
 void main () {
-    
-    vec4 color = texture(uTex2d, vTexCoord);
+
+    vec4 color = texture(uTex2d[tex_id], vTexCoord);
 
     if (color.a == 0.0) {
-        discard; 
+        discard;
     }
 
     fFragClr = color;
-}
\ No newline at end of file
+}
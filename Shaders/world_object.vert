@@ -10,7 +10,13 @@ layout (location=5) in float texture_id;
 layout (location=0) out vec2 vTexCoord;
 layout (location=1) flat out int tex_id;
 
-uniform mat3 world_to_ndc_xform;
+// Per frame data shared by every program, see FrameUniforms in ShaderManager.h
+layout (std140, binding = 0) uniform FrameUniforms {
+
+    mat4 projection;
+    mat3 world_to_ndc_xform;
+    vec2 win_size;
+};
 
 void main() {
     
@@ -61,9 +61,19 @@ void AABB::DeSerialize(std::stringstream& data) {
 	data >> scale_.x >> scale_.y >> layer_;
 }
 
-void AABB::DeSerializeClone(std::stringstream& data) {
+void AABB::DeSerializeClone(CloneReader& data) {
 
-	DeSerialize(data);
+	data >> scale_.x >> scale_.y >> layer_;
+}
+
+void AABB::SerializeSnapshot(CloneWriter& data) {
+
+	data << scale_.x << scale_.y << layer_;
+}
+
+void AABB::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
 void AABB::SerializeClone(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer) {
@@ -71,10 +81,10 @@ void AABB::SerializeClone(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writ
 	Serialize(writer);
 }
 
-std::shared_ptr<Component> AABB::Clone() {
+Component* AABB::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning AABB Component\n");
 	
-	std::shared_ptr<AABB> cloned = std::make_shared<AABB>();
+	AABB* cloned = MakeComponent<AABB>();
 
 	cloned->bottom_left_ = bottom_left_;
 	cloned->top_right_ = top_right_;
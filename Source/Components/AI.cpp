@@ -13,15 +13,30 @@
 
 #include "Components/AI.h"
 #include "Manager/ComponentManager.h"
-#include "Script/ScriptList.h"
 #include "Systems/LogicSystem.h"
 #include "Engine/Core.h"
+#include <algorithm>
 
-AI::AI() : root_(nullptr){}
+namespace {
+
+	// The name GetType reads the type back from
+	std::string GetTypeName(AI::AIType type) {
+
+		switch (type) {
+
+		case AI::Mite:
+			return "Mite";
+		case AI::Hornet:
+			return "Hornet";
+		default:
+			return "Stag_Beetle";
+		}
+	}
+}
+
+AI::AI() : tree_(nullptr), agent_{} {}
 
 AI::~AI() {
-	if (root_)
-		delete root_;
 	CORE->GetManager<ComponentManager>()->RemoveComponent<AI>(Component::GetOwner()->GetID());
 }
 
@@ -82,16 +97,18 @@ void AI::DeSerialize(std::stringstream& data) {
 	data >> type >> level_ >> range_ >> speed_;
 }
 
-void AI::SetRoot(AIType type){
-	switch (type) 
-	{
-	case StagBeetle:
-		root_ = new Stag_Tree::StagRoot(GetOwner()->GetID());
-		break;
-	case Mite:
-		root_ = new Mite_Tree::MiteRoot(GetOwner()->GetID());
-		break;
-	}
+void AI::SetTree(AIType type){
+
+	tree_ = CORE->GetSystem<LogicSystem>()->GetTree(type, level_);
+
+	if (tree_)
+		Behaviour::BindAgent(agent_, GetOwner()->GetID());
+}
+
+void AI::CollisionResponse(EntityID obj) {
+
+	if (tree_)
+		tree_->CollisionResponse(agent_, obj);
 }
 
 AI::AIType AI::GetType(std::string type)
@@ -106,14 +123,14 @@ AI::AIType AI::GetType(std::string type)
 	return StagBeetle;
 }
 
-void AI::DeSerializeClone(std::stringstream& data) {
+void AI::DeSerializeClone(CloneReader& data) {
 
 	std::string type;
 
 	// clone data will be for number of destinations and destinations
 	data >> type >> level_ >> range_ >> speed_ >> num_destinations_;
 	type_ = GetType(type);
-	SetRoot(type_);
+	SetTree(type_);
 	//DEBUG_ASSERT((num_destinations_ >= 2), "Empty destinations in JSON");
 
 	destinations_.resize(num_destinations_);
@@ -127,10 +144,40 @@ void AI::DeSerializeClone(std::stringstream& data) {
 	DEBUG_ASSERT((current_destination_ != destinations_.end()), "Empty destinations in JSON");
 }
 
-std::shared_ptr<Component> AI::Clone() {
+void AI::SerializeSnapshot(CloneWriter& data) {
+
+	data << GetTypeName(type_) << level_ << range_ << speed_ << destinations_.size();
+
+	for (const Vector2D& destination : destinations_) {
+
+		data << destination.x << destination.y;
+	}
+
+	data << static_cast<int>(state_) << static_cast<size_t>(current_destination_ - destinations_.begin()) << alive_;
+}
+
+void AI::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
+
+	int state = static_cast<int>(state_);
+	size_t current = 0;
+	data >> state >> current >> alive_;
+
+	state_ = static_cast<AIState>(state);
+
+	// The path may have changed since the save, an empty one has no
+	// destination to restore
+	if (!destinations_.empty()) {
+
+		current_destination_ = destinations_.begin() + (std::min)(current, destinations_.size() - 1);
+	}
+}
+
+Component* AI::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning AI Component\n");
 
-	std::shared_ptr<AI> cloned = std::make_shared<AI>();
+	AI* cloned = MakeComponent<AI>();
 
 	cloned->alive_ = true;
 	cloned->type_ = type_;
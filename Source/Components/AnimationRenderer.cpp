@@ -101,15 +101,61 @@ void AnimationRenderer::DeSerialize(std::stringstream& data) {
     data >> play_animation_ >> has_finished_animating_ >> layer_ >> ui_ >> alive_;
 }
 
-void AnimationRenderer::DeSerializeClone(std::stringstream& data)
+void AnimationRenderer::DeSerializeClone(CloneReader& data)
 {
-    DeSerialize(data);
+    int num_animations;
+
+    data >> num_animations;
+
+    for (int i = 0; i < num_animations; ++i) {
+
+        std::string temp;
+        data >> temp;
+
+        animation_names_.push_back(temp);
+    }
+
+    data >> current_animation_name_;
+
+    data >> play_animation_ >> has_finished_animating_ >> layer_ >> ui_ >> alive_;
+}
+
+void AnimationRenderer::SerializeSnapshot(CloneWriter& data)
+{
+    data << static_cast<int>(animation_names_.size());
+
+    for (const std::string& name : animation_names_) {
+
+        data << name;
+    }
+
+    data << current_animation_name_;
+
+    data << play_animation_ << has_finished_animating_ << layer_ << ui_ << alive_;
+    data << x_mirror_ << y_mirror_;
+}
+
+void AnimationRenderer::DeSerializeSnapshot(CloneReader& data)
+{
+    // Clones start with the animations of their archetype
+    animation_names_.clear();
+    DeSerializeClone(data);
+
+    data >> x_mirror_ >> y_mirror_;
+
+    for (const std::string& name : animation_names_) {
+
+        CORE->GetSystem<GraphicsSystem>()->AddAnimation(this, name);
+    }
+
+    // Points the current animation into this component's own animations
+    CORE->GetSystem<GraphicsSystem>()->SetAnimation(this, current_animation_name_);
 }
 
-std::shared_ptr<Component> AnimationRenderer::Clone() {
+Component* AnimationRenderer::Clone() {
     M_DEBUG->WriteDebugMessage("Cloning AnimationRenderer Component\n");
 
-	std::shared_ptr<AnimationRenderer> cloned = std::make_shared<AnimationRenderer>();
+	AnimationRenderer* cloned = MakeComponent<AnimationRenderer>();
 
     // IRenderer
     cloned->layer_ = layer_;
@@ -78,7 +78,7 @@ void BasicAI::DeSerialize(std::stringstream& data) {
 	data >> speed;
 }
 
-void BasicAI::DeSerializeClone(std::stringstream& data) {
+void BasicAI::DeSerializeClone(CloneReader& data) {
 
 	// clone data will be for number of destinations and destinations
 	data >> num_destinations_;
@@ -96,10 +96,37 @@ void BasicAI::DeSerializeClone(std::stringstream& data) {
 	DEBUG_ASSERT((current_destination_ != destinations_.end()), "Empty destinations in JSON");
 }
 
-std::shared_ptr<Component> BasicAI::Clone() {
+void BasicAI::SerializeSnapshot(CloneWriter& data) {
+
+	data << destinations_.size();
+
+	for (const Vector2D& destination : destinations_) {
+
+		data << destination.x << destination.y;
+	}
+
+	data << static_cast<size_t>(current_destination_ - destinations_.begin());
+}
+
+void BasicAI::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
+
+	size_t current = 0;
+	data >> current;
+
+	// Stays on the last point if the path got shorter, and as cloned if
+	// it has none
+	if (!destinations_.empty()) {
+
+		current_destination_ = destinations_.begin() + (std::min)(current, destinations_.size() - 1);
+	}
+}
+
+Component* BasicAI::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning BasicAI Component\n");
 
-	std::shared_ptr<BasicAI> cloned = std::make_shared<BasicAI>();
+	BasicAI* cloned = MakeComponent<BasicAI>();
 
 	cloned->speed = speed;
 	cloned->num_destinations_ = num_destinations_;
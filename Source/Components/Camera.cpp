@@ -66,9 +66,11 @@ void Camera::DeSerialize(std::stringstream& data)
 
 }
 
-void Camera::DeSerializeClone(std::stringstream& data)
+void Camera::DeSerializeClone(CloneReader& data)
 {
-    DeSerialize(data);
+    data >> cam_pos_.x >> cam_pos_.y
+        >> cam_size_.x >> cam_size_.y
+        >> cam_zoom_;
 
     cam_size_ /= cam_zoom_;
 
@@ -83,11 +85,24 @@ void Camera::DeSerializeClone(std::stringstream& data)
     world_to_ndc_xform_ = camwin_to_ndc_xform_ * view_xform_;
 }
 
-std::shared_ptr<Component> Camera::Clone()
+void Camera::SerializeSnapshot(CloneWriter& data)
+{
+    // DeSerializeClone divides the size by the zoom again
+    data << cam_pos_.x << cam_pos_.y
+         << cam_size_.x * cam_zoom_ << cam_size_.y * cam_zoom_
+         << cam_zoom_;
+}
+
+void Camera::DeSerializeSnapshot(CloneReader& data)
+{
+    DeSerializeClone(data);
+}
+
+Component* Camera::Clone()
 {
     M_DEBUG->WriteDebugMessage("Cloning Health Component\n");
 
-    std::shared_ptr<Camera> cloned = std::make_shared<Camera>();
+    Camera* cloned = MakeComponent<Camera>();
 
     cloned->cam_pos_ = cam_pos_;
     cloned->cam_zoom_ = cam_zoom_;
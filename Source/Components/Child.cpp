@@ -52,14 +52,24 @@ void Child::DeSerialize(std::stringstream& data) {
 	data >> parent_name_;
 }
 
-void Child::DeSerializeClone(std::stringstream& data) {
+void Child::DeSerializeClone(CloneReader& data) {
 
-	DeSerialize(data);
+	data >> parent_name_;
+}
+
+void Child::SerializeSnapshot(CloneWriter& data) {
+
+	data << parent_name_;
+}
+
+void Child::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
-std::shared_ptr<Component> Child::Clone() {
+Component* Child::Clone() {
 
-	std::shared_ptr<Child> cloned = std::make_shared<Child>();
+	Child* cloned = MakeComponent<Child>();
 	cloned->parent_name_ = parent_name_;
 
 	return cloned;
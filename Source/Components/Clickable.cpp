@@ -88,15 +88,25 @@ void Clickable::DeSerialize(std::stringstream& data) {
 	data >> scale_.x >> scale_.y >> active_ >> group_;
 }
 
-void Clickable::DeSerializeClone(std::stringstream& data) {
+void Clickable::DeSerializeClone(CloneReader& data) {
 	
 	data >> index_ >> active_ >> scale_.x >> scale_.y >> group_;
 }
 
-std::shared_ptr<Component> Clickable::Clone() {
+void Clickable::SerializeSnapshot(CloneWriter& data) {
+
+	data << index_ << active_ << scale_.x << scale_.y << group_;
+}
+
+void Clickable::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
+}
+
+Component* Clickable::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning Clickable Component\n");
 	
-	std::shared_ptr<Clickable> cloned = std::make_shared<Clickable>();
+	Clickable* cloned = MakeComponent<Clickable>();
 
 	cloned->bottom_left_ = bottom_left_;
 	cloned->top_right_ = top_right_;
@@ -57,10 +57,10 @@ void Collectible::DeSerialize(std::stringstream& data) {
 	item_type_ = StringToCollectible(item_name_);
 }
 
-std::shared_ptr<Component> Collectible::Clone() {
+Component* Collectible::Clone() {
 
 	M_DEBUG->WriteDebugMessage("Cloning Inventory Component\n");
-	std::shared_ptr<Collectible> cloned = std::make_shared<Collectible>();
+	Collectible* cloned = MakeComponent<Collectible>();
 
 	cloned->item_name_ = item_name_;
 	cloned->item_description_ = item_description_;
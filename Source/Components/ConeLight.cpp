@@ -69,15 +69,31 @@ void ConeLight::DeSerialize(std::stringstream& data) {
 		 >> alive_;
 }
 
-void ConeLight::DeSerializeClone(std::stringstream& data) {
+void ConeLight::DeSerializeClone(CloneReader& data) {
 
-	DeSerialize(data);
+	data >> angle_
+		 >> color_.x >> color_.y >> color_.z
+		 >> radius_ >> intensity_
+		 >> alive_;
+}
+
+void ConeLight::SerializeSnapshot(CloneWriter& data) {
+
+	data << angle_
+		 << color_.x << color_.y << color_.z
+		 << radius_ << intensity_
+		 << alive_;
+}
+
+void ConeLight::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
-std::shared_ptr<Component> ConeLight::Clone() {
+Component* ConeLight::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning PointLight Component\n");
 
-	std::shared_ptr<ConeLight> cloned = std::make_shared<ConeLight>();
+	ConeLight* cloned = MakeComponent<ConeLight>();
 
 	cloned->color_ = color_;
 	cloned->intensity_ = intensity_;
@@ -52,9 +52,19 @@ void DialogueTrigger::DeSerialize(std::stringstream& data) {
 	data >> dialogue_name_;
 }
 
-void DialogueTrigger::DeSerializeClone(std::stringstream& data) {
+void DialogueTrigger::DeSerializeClone(CloneReader& data) {
 
-	DeSerialize(data);
+	data >> dialogue_name_;
+}
+
+void DialogueTrigger::SerializeSnapshot(CloneWriter& data) {
+
+	data << dialogue_name_;
+}
+
+void DialogueTrigger::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
 void DialogueTrigger::SerializeClone(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer) {
@@ -62,10 +72,10 @@ void DialogueTrigger::SerializeClone(rapidjson::PrettyWriter<rapidjson::StringBu
 	Serialize(writer);
 }
 
-std::shared_ptr<Component> DialogueTrigger::Clone() {
+Component* DialogueTrigger::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning DialogueTrigger Component\n");
 	
-	std::shared_ptr<DialogueTrigger> cloned = std::make_shared<DialogueTrigger>();
+	DialogueTrigger* cloned = MakeComponent<DialogueTrigger>();
 
 	cloned->dialogue_name_ = dialogue_name_;
 
@@ -19,7 +19,7 @@
 #include "Systems/GraphicsSystem.h"
 #include "Engine/Core.h"
 #include "MathLib/Matrix3x3.h"
-#include <glm/gtc/random.hpp>
+#include "MathLib/Random.h"
 
 
 Emitter::Emitter() :
@@ -127,7 +127,7 @@ void Emitter::DeSerialize(std::stringstream& data) {
 }
 
 
-void Emitter::DeSerializeClone(std::stringstream& data) {
+void Emitter::DeSerializeClone(CloneReader& data) {
 
 	// Initialize emitter's data
 	data >> lifetime_ >> spawn_interval_ >> request_ >> max_spawn_;
@@ -169,20 +169,62 @@ void Emitter::DeSerializeClone(std::stringstream& data) {
 	alive_ = true;
 }
 
+void Emitter::SerializeSnapshot(CloneWriter& data) {
 
-std::shared_ptr<Component> Emitter::Clone() {
+	data << lifetime_ << spawn_interval_ << request_ << max_spawn_;
 
-	return std::make_shared<Emitter>();	
+	data << particle_lifetime_.lifetime_range_.x << particle_lifetime_.lifetime_range_.y;
+
+	data << particle_position_.min_pos_.x << particle_position_.min_pos_.y;
+	data << particle_position_.max_pos_.x << particle_position_.max_pos_.y;
+
+	data << particle_force_.force_range_.x << particle_force_.force_range_.y;
+	data << particle_force_.direction_range_.x << particle_force_.direction_range_.y;
+
+	data << particle_rotation_.rotation_speed_.x << particle_rotation_.rotation_speed_.y;
+	data << particle_rotation_.min_rotation_range_.x << particle_rotation_.min_rotation_range_.y;
+	data << particle_rotation_.max_rotation_range_.x << particle_rotation_.max_rotation_range_.y;
+
+	data << particle_texture_.texture_names_.size();
+
+	for (const std::string& name : particle_texture_.texture_names_) {
+
+		data << name;
+	}
+
+	data << particle_destination_.set_destination_;
+
+	if (particle_destination_.set_destination_) {
+
+		data << particle_destination_.destination_.x << particle_destination_.destination_.y;
+		data << particle_destination_.time_range_.x << particle_destination_.time_range_.y;
+	}
+
+	// Particles are not saved, so the emitter starts spawning again
+	data << alive_ << interval_;
+}
+
+void Emitter::DeSerializeSnapshot(CloneReader& data) {
+
+	particle_texture_.texture_names_.clear();
+	DeSerializeClone(data);
+
+	data >> alive_ >> interval_;
+}
+
+
+Component* Emitter::Clone() {
+
+	return MakeComponent<Emitter>();	
 }
 
 
-void Emitter::SetParticle(const EntityID& id) {
+void Emitter::SetParticle(const EntityID& id, size_t index) {
 
 	// Get relevant managers
-	std::shared_ptr<ComponentManager> component_manager = CORE->GetManager<ComponentManager>();
-	std::shared_ptr<TextureManager> texture_manager = CORE->GetManager<TextureManager>();
-	std::shared_ptr<GraphicsSystem> graphics_system = CORE->GetSystem<GraphicsSystem>();
-	std::shared_ptr<ForcesManager> forces_manager = CORE->GetManager<ForcesManager>();
+	ComponentManager* component_manager = &*CORE->GetManager<ComponentManager>();
+	GraphicsSystem* graphics_system = &*CORE->GetSystem<GraphicsSystem>();
+	ForcesManager* forces_manager = &*CORE->GetManager<ForcesManager>();
 
 	// Get relevant components
 	Particle* particle = component_manager->GetComponent<Particle>(id);
@@ -195,11 +237,11 @@ void Emitter::SetParticle(const EntityID& id) {
 	if (!particle || !xform_p || !xform_e || !motion || !texture_renderer)
 		return;
 
-	particle_lifetime_.Generate(particle);
-	particle_position_.Generate(xform_p, xform_e);
-	particle_force_.Generate(forces_manager, particle, id);
-	particle_rotation_.Generate(xform_p);
-	particle_texture_.Generate(graphics_system, texture_renderer);
+	particle_lifetime_.Generate(particle, samples_, index);
+	particle_position_.Generate(xform_p, xform_e, samples_, index);
+	particle_force_.Generate(forces_manager, particle, id, samples_, index);
+	particle_rotation_.Generate(xform_p, samples_, index);
+	particle_texture_.Generate(graphics_system, texture_renderer, GetRandom());
 	particle_destination_.Init(particle);
 
 	// Set parent id
@@ -222,7 +264,9 @@ void Emitter::Spawn(float frametime) {
 	if (!request_)
 		return;
 
-	size_t rand_val = rand() % request_;
+	RandomGenerator& rng = GetRandom();
+
+	size_t rand_val = rng.Index(request_);
 	size_t count_to_request_ = max_spawn_ > current_spawn_ + rand_val ? 
 		rand_val : 0;
 
@@ -234,9 +278,18 @@ void Emitter::Spawn(float frametime) {
 	if (particles.empty())
 		return;
 
-	for (auto& id : particles) {
+	// Sample the whole burst up front so each range is filled in one pass
+	const size_t count = particles.size();
+	samples_.Resize(count);
+
+	particle_lifetime_.Sample(rng, samples_, count);
+	particle_position_.Sample(rng, samples_, count);
+	particle_force_.Sample(rng, samples_, count);
+	particle_rotation_.Sample(rng, samples_, count);
+
+	for (size_t i = 0; i < count; ++i) {
 
-		SetParticle(id);
+		SetParticle(particles[i], i);
 	}
 }
 
@@ -369,50 +422,81 @@ void Emitter::SetDestinationStruct(Vector2D destination, Vector2D time, bool sta
 
 
 
+void ParticleSamples::Resize(size_t count) {
+
+	lifetime_.resize(count);
+	position_x_.resize(count);
+	position_y_.resize(count);
+	force_.resize(count);
+	direction_.resize(count);
+	rotation_speed_.resize(count);
+	rotation_min_.resize(count);
+	rotation_max_.resize(count);
+}
+
+// Sample particle data
+void GenerateLifetime::Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count) {
+
+	rng.FillRange(samples.lifetime_.data(), count, lifetime_range_.x, lifetime_range_.y);
+}
+
+void GeneratePosition::Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count) {
+
+	rng.FillRange(samples.position_x_.data(), count, min_pos_.x, max_pos_.x);
+	rng.FillRange(samples.position_y_.data(), count, min_pos_.y, max_pos_.y);
+}
+
+void GenerateForce::Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count) {
+
+	rng.FillRange(samples.direction_.data(), count, direction_range_.x, direction_range_.y);
+	rng.FillRange(samples.force_.data(), count, force_range_.x, force_range_.y);
+}
+
+void GenerateRotation::Sample(RandomGenerator& rng, ParticleSamples& samples, size_t count) {
+
+	rng.FillRange(samples.rotation_speed_.data(), count, rotation_speed_.x, rotation_speed_.y);
+	rng.FillRange(samples.rotation_min_.data(), count, min_rotation_range_.x, max_rotation_range_.x);
+	rng.FillRange(samples.rotation_max_.data(), count, min_rotation_range_.y, max_rotation_range_.y);
+}
+
 // Generate particle data
-void GenerateLifetime::Generate(Particle* particle) {
+void GenerateLifetime::Generate(Particle* particle, const ParticleSamples& samples, size_t index) {
 
-	float lifetime = glm::linearRand(lifetime_range_.x, lifetime_range_.y);
-	particle->SetLifetime(lifetime);
+	particle->SetLifetime(samples.lifetime_[index]);
 }
 
-void GeneratePosition::Generate(Transform* particle_transform, Transform* emitter_transform) {
+void GeneratePosition::Generate(Transform* particle_transform, Transform* emitter_transform, const ParticleSamples& samples, size_t index) {
 
-	Vector2D spawn{};
-	spawn.x = glm::linearRand(min_pos_.x, max_pos_.x);
-	spawn.y = glm::linearRand(min_pos_.y, max_pos_.y);
+	Vector2D spawn{ samples.position_x_[index], samples.position_y_[index] };
 
 	spawn += emitter_transform->GetPosition();
 
 	particle_transform->SetPosition(spawn);
 }
 
-void GenerateForce::Generate(std::shared_ptr<ForcesManager> force_manager, Particle* particle, EntityID particle_id) {
+void GenerateForce::Generate(ForcesManager* force_manager, Particle* particle, EntityID particle_id, const ParticleSamples& samples, size_t index) {
 
 	// Rand direction
 	Vector2D vec{};
 	Matrix3x3 mtx{};
-	float direction = glm::linearRand(direction_range_.x, direction_range_.y);
 
-	Mtx33RotDeg(mtx, direction);
+	Mtx33RotDeg(mtx, samples.direction_[index]);
 	// Rand force
-	vec.x = vec.y = glm::linearRand(force_range_.x, force_range_.y);
+	vec.x = vec.y = samples.force_[index];
 	vec = mtx * vec;
 
 	force_manager->AddForce(particle_id, "Particle", particle->GetLifetime(), vec);
 }
 
-void GenerateRotation::Generate(Transform* transform) {
+void GenerateRotation::Generate(Transform* transform, const ParticleSamples& samples, size_t index) {
 
 	// Rand rotation speed
-	float texture_rotation_speed = glm::linearRand(rotation_speed_.x, rotation_speed_.y);
+	float texture_rotation_speed = samples.rotation_speed_[index];
 	transform->SetRotationSpeed(texture_rotation_speed);
 
 
 	// Rand rotation range
-	Vector2D rotation_range{};
-	rotation_range.x = glm::linearRand(min_rotation_range_.x, max_rotation_range_.x);
-	rotation_range.y = glm::linearRand(min_rotation_range_.y, max_rotation_range_.y);
+	Vector2D rotation_range{ samples.rotation_min_[index], samples.rotation_max_[index] };
 
 	if (rotation_range.y < rotation_range.x)
 		std::swap(rotation_range.y, rotation_range.x);
@@ -421,13 +505,14 @@ void GenerateRotation::Generate(Transform* transform) {
 	transform->SetRotationRange(rotation_range);
 }
 
-void GenerateTexture::Generate(std::shared_ptr<GraphicsSystem> graphics_system, TextureRenderer* texture) {
+void GenerateTexture::Generate(GraphicsSystem* graphics_system, TextureRenderer* texture, RandomGenerator& rng) {
 
 	// Rand texture choice
 	if (!number_of_textures_)
 		return;
 
-	size_t index = number_of_textures_ == 1 ? 0 : glm::linearRand(0, static_cast<int>(number_of_textures_ - 1));	graphics_system->ChangeTexture(texture, texture_names_[index]);
+	size_t index = number_of_textures_ == 1 ? 0 : rng.Index(number_of_textures_);
+	graphics_system->ChangeTexture(texture, texture_names_[index]);
 }
 
 void GenerateDestination::Generate(std::shared_ptr<ForcesManager> force_manager, Particle* particle, EntityID particle_id) {
@@ -437,7 +522,7 @@ void GenerateDestination::Generate(std::shared_ptr<ForcesManager> force_manager,
 		CameraSystem* cam_sys = &*CORE->GetSystem<CameraSystem>();
 		Vector2D particle_pos = CORE->GetManager<ComponentManager>()->GetComponent<Transform>(particle_id)->GetPosition();
 		Vector2D particle_des = cam_sys->UIToGameCoords(destination_);
-		float travel_time = glm::linearRand(time_range_.x, time_range_.y);
+		float travel_time = GetRandom().Range(time_range_.x, time_range_.y);
 
 		Vector2D p_force = (particle_des - particle_pos * CORE->GetGlobalScale()) / travel_time;
 
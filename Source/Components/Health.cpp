@@ -56,14 +56,27 @@ void Health::DeSerialize(std::stringstream& data) {
 	current_health_ = maximum_health_;
 }
 
-void Health::DeSerializeClone(std::stringstream& data) {
-	DeSerialize(data);
+void Health::DeSerializeClone(CloneReader& data) {
+
+	data >> maximum_health_;
+	current_health_ = maximum_health_;
+}
+
+void Health::SerializeSnapshot(CloneWriter& data) {
+
+	data << maximum_health_ << current_health_;
+}
+
+void Health::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
+	data >> current_health_;
 }
 
-std::shared_ptr<Component> Health::Clone() {
+Component* Health::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning Health Component\n");
 
-	std::shared_ptr<Health> cloned = std::make_shared<Health>();
+	Health* cloned = MakeComponent<Health>();
 
 	cloned->current_health_ = current_health_;
 	cloned->maximum_health_ = maximum_health_;
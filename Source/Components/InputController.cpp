@@ -85,7 +85,7 @@ void InputController::DeSerialize(std::stringstream& data) {
 	(void)data;
 }
 
-void InputController::DeSerializeClone(std::stringstream& data) {
+void InputController::DeSerializeClone(CloneReader& data) {
 
 	//first value denotes how many times to loop
 	data >> num_entries_; 
@@ -99,10 +99,26 @@ void InputController::DeSerializeClone(std::stringstream& data) {
 	}
 }
 
-std::shared_ptr<Component> InputController::Clone() {
+void InputController::SerializeSnapshot(CloneWriter& data) {
+
+	data << input_map_.size();
+
+	for (const auto& [name, key] : input_map_) {
+
+		data << name << static_cast<int>(key);
+	}
+}
+
+void InputController::DeSerializeSnapshot(CloneReader& data) {
+
+	input_map_.clear();
+	DeSerializeClone(data);
+}
+
+Component* InputController::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning InputController Component\n");
 	
-	std::shared_ptr<InputController> cloned = std::make_shared<InputController>();
+	InputController* cloned = MakeComponent<InputController>();
 
 	return cloned;
 }
\ No newline at end of file
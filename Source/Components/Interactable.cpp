@@ -68,7 +68,7 @@ void Interactable::DeSerialize(std::stringstream& data) {
 	(void)data;
 }
 
-void Interactable::DeSerializeClone(std::stringstream& data) {
+void Interactable::DeSerializeClone(CloneReader& data) {
 
 	size_t sz{};
 	std::string key{}, val{};
@@ -81,10 +81,26 @@ void Interactable::DeSerializeClone(std::stringstream& data) {
 	}
 }
 
-std::shared_ptr<Component> Interactable::Clone() {
+void Interactable::SerializeSnapshot(CloneWriter& data) {
+
+	data << event_animations_.size();
+
+	for (const auto& [key, val] : event_animations_) {
+
+		data << key << val;
+	}
+}
+
+void Interactable::DeSerializeSnapshot(CloneReader& data) {
+
+	event_animations_.clear();
+	DeSerializeClone(data);
+}
+
+Component* Interactable::Clone() {
 
 	M_DEBUG->WriteDebugMessage("Cloning Inventory Component\n");
-	std::shared_ptr<Interactable> cloned = std::make_shared<Interactable>();
+	Interactable* cloned = MakeComponent<Interactable>();
 
 	//cloned->event_animations_ = event_animations_;
 
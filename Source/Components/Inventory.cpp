@@ -51,10 +51,50 @@ void Inventory::DeSerialize(std::stringstream& data) {
 	data >> max_capacity_;
 }
 
-std::shared_ptr<Component> Inventory::Clone() {
+void Inventory::SerializeSnapshot(CloneWriter& data) {
+
+	data << current_capacity_ << max_capacity_ << inventory_.size();
+
+	for (const auto& [name, item] : inventory_) {
+
+		data << name << item.count_ << item.description_ << item.entities_.size();
+
+		for (EntityID id : item.entities_) {
+
+			data << id;
+		}
+	}
+}
+
+void Inventory::DeSerializeSnapshot(CloneReader& data) {
+
+	size_t item_count = 0;
+	data >> current_capacity_ >> max_capacity_ >> item_count;
+
+	inventory_.clear();
+
+	for (size_t i = 0; i < item_count; ++i) {
+
+		ItemName name{};
+		ItemDescription item{ 0, "" };
+		size_t entity_count = 0;
+		data >> name >> item.count_ >> item.description_ >> entity_count;
+
+		item.entities_.resize(entity_count);
+
+		for (EntityID& id : item.entities_) {
+
+			data >> id;
+		}
+
+		inventory_[name] = item;
+	}
+}
+
+Component* Inventory::Clone() {
 
 	M_DEBUG->WriteDebugMessage("Cloning Inventory Component\n");
-	std::shared_ptr<Inventory> cloned = std::make_shared<Inventory>();
+	Inventory* cloned = MakeComponent<Inventory>();
 
 	//cloned->current_capacity_ = current_capacity_;
 	//cloned->max_capacity_ = max_capacity_;
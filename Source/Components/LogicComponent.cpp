@@ -16,9 +16,25 @@
 #include "Components/LogicComponent.h"
 #include "Manager/ComponentManager.h"
 
+// Names of the hooks as they appear in the entity json, in LogicHook order
+static const char* hook_names_[] = {
+	"UpdateTexture",
+	"UpdateChildOffset",
+	"UpdateInput",
+	"UpdateAnimation",
+	"ButtonUpdateTexture",
+	"Collectible",
+	"Interactable",
+	"Title"
+};
+
+static_assert(sizeof(hook_names_) / sizeof(hook_names_[0]) == static_cast<size_t>(LogicHook::Count),
+			  "Every LogicHook requires a name");
+
 void LogicComponent::Init() {
 
 	CORE->GetManager<ComponentManager>()->AddComponent<LogicComponent>(Component::GetOwner()->GetID(), this);
+	BindHooks();
 }
 
 
@@ -72,12 +88,42 @@ void LogicComponent::DeSerialize(std::stringstream& data) {
 
 		my_logic_.emplace(name, fn_name);
 	}
+
+	BindHooks();
 }
 
 
-void LogicComponent::DeSerializeClone(std::stringstream& data) {
+void LogicComponent::DeSerializeClone(CloneReader& data) {
 	
-	DeSerialize(data);
+	data >> size_;
+
+	std::string name, fn_name;
+
+	for (size_t i = 0; i < size_; ++i) {
+
+		data >> name >> fn_name;
+
+		my_logic_.emplace(name, fn_name);
+	}
+
+	BindHooks();
+}
+
+void LogicComponent::SerializeSnapshot(CloneWriter& data) {
+
+	data << my_logic_.size();
+
+	for (const auto& [name, fn_name] : my_logic_) {
+
+		data << name << fn_name;
+	}
+}
+
+void LogicComponent::DeSerializeSnapshot(CloneReader& data) {
+
+	// Clones start with the logic of their archetype, which emplace would keep
+	my_logic_.clear();
+	DeSerializeClone(data);
 }
 
 
@@ -92,12 +138,31 @@ const std::string LogicComponent::GetLogic(const std::string& fn) {
 }
 
 
-std::shared_ptr<Component> LogicComponent::Clone() {
+const LogicHandle& LogicComponent::GetHook(LogicHook hook) const {
+
+	return hooks_[static_cast<size_t>(hook)];
+}
+
+
+void LogicComponent::BindHooks() {
+
+	LogicManager* logic_mgr = &*CORE->GetManager<LogicManager>();
+
+	for (size_t i = 0; i < hooks_.size(); ++i) {
+
+		auto it = my_logic_.find(hook_names_[i]);
+		hooks_[i] = (it != my_logic_.end()) ? logic_mgr->GetHandle(it->second) : LogicHandle{};
+	}
+}
+
+
+Component* LogicComponent::Clone() {
 
-	std::shared_ptr<LogicComponent> clone = std::make_shared<LogicComponent>();
+	LogicComponent* clone = MakeComponent<LogicComponent>();
 
 	clone->size_ = size_;
 	clone->my_logic_ = my_logic_;
+	clone->hooks_ = hooks_;
 
 	return clone;
 }
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "Components/Motion.h"
 #include "Systems/Physics.h"
 #include "Systems/Collision.h"
+#include "Manager/ForcesManager.h"
 #include "Engine/Core.h"
 
 Motion::Motion() : 
@@ -25,7 +26,8 @@ Motion::Motion() :
 	mass_{},
 	force_{},
 	is_left_{ false },
-	alive_{ true }
+	alive_{ true },
+	force_slot_{ static_cast<size_t>(-1) }
 {}
 
 Motion::~Motion() {
@@ -36,6 +38,7 @@ Motion::~Motion() {
 void Motion::Init() {
 
 	CORE->GetManager<ComponentManager>()->AddComponent<Motion>(Component::GetOwner()->GetID(), this);
+	force_slot_ = CORE->GetManager<ForcesManager>()->FindSlot(Component::GetOwner()->GetID());
 }
 
 void Motion::Serialize(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer) {
@@ -66,11 +69,25 @@ void Motion::DeSerialize(std::stringstream& data) {
 	inv_mass_ = mass_ == 0.0f ? 0.0f : 1 / mass_;
 }
 
+void Motion::SerializeSnapshot(CloneWriter& data) {
 
-std::shared_ptr<Component> Motion::Clone() {
+	data << velocity_.x << velocity_.y
+		 << acceleration_.x << acceleration_.y
+		 << is_left_ << is_top_ << alive_;
+}
+
+void Motion::DeSerializeSnapshot(CloneReader& data) {
+
+	data >> velocity_.x >> velocity_.y
+		 >> acceleration_.x >> acceleration_.y
+		 >> is_left_ >> is_top_ >> alive_;
+}
+
+
+Component* Motion::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning Motion Component\n");
 
-	std::shared_ptr<Motion> cloned = std::make_shared<Motion>();
+	Motion* cloned = MakeComponent<Motion>();
 
 	cloned->acceleration_ = acceleration_;
 	cloned->velocity_ = velocity_;
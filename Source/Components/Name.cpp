@@ -14,22 +14,25 @@
 
 #include "Components/Name.h"
 #include "Manager/ComponentManager.h"
+#include "Manager/EntityManager.h"
 #include "MathLib/Vector2D.h"
 #include "Engine/Core.h"
 #include <iostream> 
 
 Name::Name() : 
-	name_{ }
+	name_{ NameTable::invalid_ }
 {}
 
 Name::~Name() {
 	
 	CORE->GetManager<ComponentManager>()->RemoveComponent<Name>(Component::GetOwner()->GetID());
+	CORE->GetManager<EntityManager>()->RemoveNamedEntity(name_, Component::GetOwner());
 }
 
 void Name::Init() {
 	
 	CORE->GetManager<ComponentManager>()->AddComponent<Name>(Component::GetOwner()->GetID(), this);
+	CORE->GetManager<EntityManager>()->AddNamedEntity(name_, Component::GetOwner());
 }
 
 void Name::Serialize(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer) {
@@ -40,7 +43,7 @@ void Name::Serialize(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer) {
 	writer->String("Name");
 
 	writer->Key("name");
-	writer->String(name_.c_str());
+	writer->String(GetName().c_str());
 
 	writer->EndObject();
 }
@@ -52,24 +55,27 @@ void Name::DeSerialize(std::stringstream& data) {
 	*/
 	std::cout << "Entered Serialize Name w/ stream" << std::endl;
 	
-	data >> name_;
+	std::string name;
+	data >> name;
+
+	name_ = NameTable::Intern(name);
 }
 
-std::string Name::GetEntityName() const {
+const std::string& Name::GetEntityName() const {
 
-	return name_;
+	return NameTable::GetString(name_);
 }
 
-std::shared_ptr<Component> Name::Clone() {
+Component* Name::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning Name Component\n");
-	std::shared_ptr<Name> cloned = std::make_shared<Name>();
+	Name* cloned = MakeComponent<Name>();
 
 	cloned->name_ = name_;
 
 	return cloned;
 }
 
-std::string Name::GetName()
+const std::string& Name::GetName() const
 {
-	return name_;
+	return NameTable::GetString(name_);
 }
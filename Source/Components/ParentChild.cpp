@@ -53,14 +53,24 @@ void ParentChild::DeSerialize(std::stringstream& data) {
 	data >> name_;
 }
 
-void ParentChild::DeSerializeClone(std::stringstream& data) {
+void ParentChild::DeSerializeClone(CloneReader& data) {
 	
-	DeSerialize(data);
+	data >> name_;
+}
+
+void ParentChild::SerializeSnapshot(CloneWriter& data) {
+
+	data << name_;
+}
+
+void ParentChild::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
-std::shared_ptr<Component> ParentChild::Clone() {
+Component* ParentChild::Clone() {
 
-	std::shared_ptr<ParentChild> cloned = std::make_shared<ParentChild>();
+	ParentChild* cloned = MakeComponent<ParentChild>();
 	cloned->name_ = name_;
 
 	return cloned;
@@ -54,9 +54,9 @@ void Particle::DeSerialize(std::stringstream& data) {
 }
 
 
-std::shared_ptr<Component> Particle::Clone() {
+Component* Particle::Clone() {
 
-	return std::make_shared<Particle>();
+	return MakeComponent<Particle>();
 }
 
 
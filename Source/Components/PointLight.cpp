@@ -64,15 +64,27 @@ void PointLight::DeSerialize(std::stringstream& data) {
 		 >> radius_ >> intensity_ >> alive_;
 }
 
-void PointLight::DeSerializeClone(std::stringstream& data) {
+void PointLight::DeSerializeClone(CloneReader& data) {
 
-	DeSerialize(data);
+	data >> color_.x >> color_.y >> color_.z
+		 >> radius_ >> intensity_ >> alive_;
+}
+
+void PointLight::SerializeSnapshot(CloneWriter& data) {
+
+	data << color_.x << color_.y << color_.z
+		 << radius_ << intensity_ << alive_;
+}
+
+void PointLight::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
-std::shared_ptr<Component> PointLight::Clone() {
+Component* PointLight::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning PointLight Component\n");
 
-	std::shared_ptr<PointLight> cloned = std::make_shared<PointLight>();
+	PointLight* cloned = MakeComponent<PointLight>();
 
 	cloned->color_ = color_;
 	cloned->intensity_ = intensity_;
@@ -61,15 +61,25 @@ void Scale::DeSerialize(std::stringstream& data) {
 	data >> scale_.x >> scale_.y;
 }
 
-void Scale::DeSerializeClone(std::stringstream& data) {
+void Scale::DeSerializeClone(CloneReader& data) {
 		
-	DeSerialize((data));
+	data >> scale_.x >> scale_.y;
+}
+
+void Scale::SerializeSnapshot(CloneWriter& data) {
+
+	data << scale_.x << scale_.y;
+}
+
+void Scale::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
-std::shared_ptr<Component> Scale::Clone() {
+Component* Scale::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning Scale Component\n");	
 
-	std::shared_ptr<Scale> cloned = std::make_shared<Scale>();
+	Scale* cloned = MakeComponent<Scale>();
 
 	cloned->scale_ = scale_;
 
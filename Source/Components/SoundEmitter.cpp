@@ -166,7 +166,7 @@ void SoundEmitter::DeSerialize(std::stringstream& data) {
 }
 
 
-void SoundEmitter::DeSerializeClone(std::stringstream& data) {
+void SoundEmitter::DeSerializeClone(CloneReader& data) {
 	
 	data >> sound_name_ >> num_sound_lines_;
 
@@ -180,8 +180,25 @@ void SoundEmitter::DeSerializeClone(std::stringstream& data) {
 	}
 }
 
+void SoundEmitter::SerializeSnapshot(CloneWriter& data) {
 
-std::shared_ptr<Component> SoundEmitter::Clone() {
+	data << sound_name_ << sound_lines_.size();
+
+	for (const SoundLine& line : sound_lines_) {
+
+		data << line.start_.x << line.start_.y;
+		data << line.end_.x << line.end_.y;
+	}
+}
+
+void SoundEmitter::DeSerializeSnapshot(CloneReader& data) {
+
+	sound_lines_.clear();
+	DeSerializeClone(data);
+}
+
+
+Component* SoundEmitter::Clone() {
 	
-	return std::make_shared<SoundEmitter>();
+	return MakeComponent<SoundEmitter>();
 }
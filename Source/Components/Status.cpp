@@ -71,10 +71,22 @@ void Status::DeSerialize(std::stringstream& data) {
     */
 }
 
-std::shared_ptr<Component> Status::Clone() {
+void Status::SerializeSnapshot(CloneWriter& data) {
+
+	data << static_cast<int>(status_) << status_timer_ << cooldown_timer_;
+}
+
+void Status::DeSerializeSnapshot(CloneReader& data) {
+
+	int status = static_cast<int>(status_);
+	data >> status >> status_timer_ >> cooldown_timer_;
+	status_ = static_cast<StatusType>(status);
+}
+
+Component* Status::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning Status Component\n");
 
-	std::shared_ptr<Status> cloned = std::make_shared<Status>();
+	Status* cloned = MakeComponent<Status>();
 
 	cloned->status_ = status_;
 	cloned->status_timer_ = status_timer_;
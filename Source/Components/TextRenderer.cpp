@@ -18,7 +18,11 @@
 #include "Engine/Core.h"
 #include "Systems/GraphicsSystem.h"
 
-TextRenderer::TextRenderer() {
+TextRenderer::TextRenderer() :
+    mesh_position_{},
+    mesh_color_{},
+    mesh_scale_{},
+    mesh_dirty_{ true } {
 
 }
 
@@ -32,6 +36,7 @@ void TextRenderer::Init() {
     CORE->GetSystem<GraphicsSystem>()->AddTextRendererComponent(Component::GetOwner()->GetID(), this);
 
     font_ = CORE->GetManager<FontManager>()->GetFont(font_name_);
+    mesh_dirty_ = true;
 }
 
 void TextRenderer::Serialize(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer) {
@@ -95,15 +100,54 @@ void TextRenderer::DeSerialize(std::stringstream& data) {
 }
 
 
-void TextRenderer::DeSerializeClone(std::stringstream& data)
+void TextRenderer::DeSerializeClone(CloneReader& data)
 {
-    DeSerialize(data);
+    int sentence_length;
+
+    data >> font_name_
+        >> sentence_length;
+
+    for (int i = 0; i < sentence_length; ++i) {
+
+        std::string temp;
+        data >> temp;
+        text_ += temp + " ";
+    }
+
+     data >> color_.x >> color_.y >> color_.z
+          >> scale_
+          >> layer_
+          >> ui_
+          >> alive_;
+}
+
+void TextRenderer::SerializeSnapshot(CloneWriter& data)
+{
+    // The text is saved whole after the other values, with no words before them
+    data << font_name_
+         << 0;
+
+    data << color_.x << color_.y << color_.z
+         << scale_
+         << layer_
+         << ui_
+         << alive_;
+
+    data << text_;
 }
 
-std::shared_ptr<Component> TextRenderer::Clone() {
+void TextRenderer::DeSerializeSnapshot(CloneReader& data)
+{
+    DeSerializeClone(data);
+    data >> text_;
+
+    mesh_dirty_ = true;
+}
+
+Component* TextRenderer::Clone() {
     M_DEBUG->WriteDebugMessage("Cloning AnimationRenderer Component\n");
 
-    std::shared_ptr<TextRenderer> cloned = std::make_shared<TextRenderer>();
+    TextRenderer* cloned = MakeComponent<TextRenderer>();
 
     cloned->font_name_ = font_name_;
     cloned->font_ = font_;
@@ -119,5 +163,9 @@ std::shared_ptr<Component> TextRenderer::Clone() {
 
 void TextRenderer::SetText(std::string text)
 {
-    text_ = text;
+    if (text_ != text) {
+
+        text_ = text;
+        mesh_dirty_ = true;
+    }
 }
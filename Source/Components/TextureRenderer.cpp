@@ -69,7 +69,7 @@ void TextureRenderer::DeSerialize(std::stringstream& data) {
     data >> texture_name_ >> layer_ >> ui_ >> alive_;
 }
 
-void TextureRenderer::DeSerializeClone(std::stringstream& data) {
+void TextureRenderer::DeSerializeClone(CloneReader& data) {
 
     //remove existing entry before proceeding
     CORE->GetSystem<GraphicsSystem>()->RemoveTextureRendererComponent(Component::GetOwner()->GetID());
@@ -77,7 +77,7 @@ void TextureRenderer::DeSerializeClone(std::stringstream& data) {
     //int layer;
 
     //data >> texture_name_ >> layer >> ui_;
-    DeSerialize(data);
+    data >> texture_name_ >> layer_ >> ui_ >> alive_;
 
     //if (layer != layer_) {
 
@@ -89,11 +89,21 @@ void TextureRenderer::DeSerializeClone(std::stringstream& data) {
     InitTextures();
 }
 
-std::shared_ptr<Component> TextureRenderer::Clone() {
+void TextureRenderer::SerializeSnapshot(CloneWriter& data) {
+
+    data << texture_name_ << layer_ << ui_ << alive_;
+}
+
+void TextureRenderer::DeSerializeSnapshot(CloneReader& data) {
+
+    DeSerializeClone(data);
+}
+
+Component* TextureRenderer::Clone() {
 
     M_DEBUG->WriteDebugMessage("Cloning TextureRenderer Component\n");
 
-    std::shared_ptr<TextureRenderer> cloned = std::make_shared<TextureRenderer>();
+    TextureRenderer* cloned = MakeComponent<TextureRenderer>();
 
     // IRenderer
     cloned->layer_ = layer_;
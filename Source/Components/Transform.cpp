@@ -77,8 +77,19 @@ void Transform::DeSerialize(std::stringstream& data) {
 	data >> position_.x >> position_.y >> rotation_ >> offset_.x >> offset_.y >> aabb_offset_.x >> aabb_offset_.y;
 }
 
-void Transform::DeSerializeClone(std::stringstream& data) {
-	DeSerialize(data);
+void Transform::DeSerializeClone(CloneReader& data) {
+
+	data >> position_.x >> position_.y >> rotation_ >> offset_.x >> offset_.y >> aabb_offset_.x >> aabb_offset_.y;
+}
+
+void Transform::SerializeSnapshot(CloneWriter& data) {
+
+	data << position_.x << position_.y << rotation_ << offset_.x << offset_.y << aabb_offset_.x << aabb_offset_.y;
+}
+
+void Transform::DeSerializeSnapshot(CloneReader& data) {
+
+	DeSerializeClone(data);
 }
 
 float Transform::GetRotation() const {
@@ -156,9 +167,9 @@ void Transform::SetRotationRange(const Vector2D& new_range) {
 }
 
 
-std::shared_ptr<Component> Transform::Clone() {
+Component* Transform::Clone() {
 	M_DEBUG->WriteDebugMessage("Cloning Transform Component\n");
-	std::shared_ptr<Transform> cloned = std::make_shared<Transform>();
+	Transform* cloned = MakeComponent<Transform>();
 
 	cloned->position_ = position_;
 	cloned->rotation_ = rotation_;
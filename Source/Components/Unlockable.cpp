@@ -68,10 +68,10 @@ void Unlockable::DeSerialize(std::stringstream& data) {
 	}
 }
 
-std::shared_ptr<Component> Unlockable::Clone() {
+Component* Unlockable::Clone() {
 
 	M_DEBUG->WriteDebugMessage("Cloning Inventory Component\n");
-	std::shared_ptr<Unlockable> cloned = std::make_shared<Unlockable>();
+	Unlockable* cloned = MakeComponent<Unlockable>();
 
 	cloned->count_ = count_;
 	cloned->required_items_ = required_items_;
@@ -0,0 +1,36 @@
+/**********************************************************************************
+*\file         ComponentPool.cpp
+*\brief        Contains definition of functions and variables used for
+*			   allocating components from per type pools
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Entity/ComponentPool.h"
+
+IComponentPool::IComponentPool(const std::string& name, size_t slot_size, size_t slots_per_chunk) :
+	name_{ name },
+	slot_size_{ slot_size },
+	slots_per_chunk_{ slots_per_chunk },
+	chunk_count_{ 0 },
+	live_count_{ 0 }
+{
+	GetPools().push_back(this);
+}
+
+IComponentPool::~IComponentPool() {
+
+	std::vector<IComponentPool*>& pools = GetPools();
+	pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+}
+
+std::vector<IComponentPool*>& IComponentPool::GetPools() {
+
+	static std::vector<IComponentPool*> pools;
+	return pools;
+}
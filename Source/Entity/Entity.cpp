@@ -22,27 +22,11 @@
 #include <functional>
 #include "Systems/Debug.h"
 
-auto ComponentSorter = [](std::shared_ptr<Component> left, std::shared_ptr<Component> right){
+auto ComponentSorter = [](Component* left, Component* right){
 	
 	return left->GetComponentTypeID() < right->GetComponentTypeID();
 };
 
-/******************************************************************************/
-/*!
-  \fn ComponentLocator()
-
-  \brief Helper function used to seach for a component in GetComponent
-*/
-/******************************************************************************/
-bool ComponentLocator(std::shared_ptr<Component> check, ComponentTypes id) {
-
-	if (check->GetComponentTypeID() == id) {
-
-		return true;
-	}
-	return false;
-};
-
 void Entity::Init() {
 
 	//inits all components owned by entity and set the component's owner
@@ -72,7 +56,11 @@ void Entity::InitArchetype() {
 	}
 };
 
-Entity::Entity() {
+Entity::Entity() :
+	component_mask_{},
+	component_index_{},
+	archetype_id_{ NameTable::invalid_ }
+{
 	// Initialise id to 0 since it will be assigned by factory
 	object_id_ = 0;
 	//entity_type_ = EntityTypes::NONE;
@@ -81,6 +69,11 @@ Entity::Entity() {
 // Destroys all components attached to an entity
 Entity::~Entity() {
 	
+	for (Component* component : components_) {
+
+		component->GetPool()->Destroy(component);
+	}
+
 	components_.clear();
 }
 
@@ -90,7 +83,7 @@ ComponentArr Entity::GetComponentArr() {
 
 // Attach a new component to the entity and sort the components according to the order in 
 // ComponentTypes.h
-void Entity::AddComponent(ComponentTypes type_id, std::shared_ptr<Component> component) {
+void Entity::AddComponent(ComponentTypes type_id, Component* component) {
 
 	//ensure pointer is not nullptr
 	DEBUG_ASSERT(component, "Component is nullptr");
@@ -101,54 +94,61 @@ void Entity::AddComponent(ComponentTypes type_id, std::shared_ptr<Component> com
 	components_.push_back(component);
 
 	std::sort(components_.begin(), components_.end(), ComponentSorter);
+	IndexComponents();
 }
 
-void Entity::RemoveComponent(std::shared_ptr<Component> component)
+void Entity::RemoveComponent(Component* component)
 {
 	for (ComponentArrIt begin = components_.begin(); begin != components_.end();) {
-		if (*begin == component)
+		if (*begin == component) {
 			begin = components_.erase(begin);
+			component->GetPool()->Destroy(component);
+		}
 		else
 			begin++;
 	}
+
+	IndexComponents();
 }
 
-bool Entity::HasComponent(ComponentTypes type_id) {
+void Entity::IndexComponents() {
+
+	DEBUG_ASSERT(components_.size() <= UINT8_MAX, "Too many components for the index table");
+
+	component_mask_.reset();
 
-	for (ComponentArrIt begin = components_.begin(); begin != components_.end(); ++begin) {
+	for (size_t i = 0; i < components_.size(); ++i) {
 
-		if (begin->get()->type_id_ == type_id)
-			return true;
+		size_t type = static_cast<size_t>(components_[i]->type_id_);
+
+		component_mask_.set(type);
+		component_index_[type] = static_cast<uint8_t>(i);
 	}
-	return false;
+}
+
+bool Entity::HasComponent(ComponentTypes type_id) {
+
+	return component_mask_.test(static_cast<size_t>(type_id));
 }
 
 // Returns a pointer to a component attached to an entity
-std::shared_ptr<Component> Entity::GetComponent(ComponentTypes type_id) {
-	
-	EntityIt result = std::find_if(components_.begin(), components_.end(), std::bind(&ComponentLocator, std::placeholders::_1, type_id));
+Component* Entity::GetComponent(ComponentTypes type_id) {
 	
-	if (result != std::end(components_)) {
+	size_t type = static_cast<size_t>(type_id);
+
+	if (component_mask_.test(type)) {
 
-		return *result;
+		return components_[component_index_[type]];
 	}
 
 	return nullptr;
 }
 
-//A more advanced type safe way of accessing components.
-//Interface becomes Transform* transform = object->has(Transform);
-template<typename return_type>
-std::shared_ptr<return_type> Entity::GetComponentType(ComponentTypes typeId) {
-
-	return std::dynamic_pointer_cast<return_type*>(GetComponent(typeId));
-}
-
 void Entity::Serialize(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer) {
 
 	writer->StartArray();
 	
-	for (std::shared_ptr<Component> component : components_) {
+	for (Component* component : components_) {
 		
 		component->Serialize(writer);
 	}
@@ -161,7 +161,7 @@ void Entity::SerializeClone(rapidjson::PrettyWriter<rapidjson::StringBuffer>* wr
 
 	writer->StartArray();
 
-	for (std::shared_ptr<Component> component : components_) {
+	for (Component* component : components_) {
 
 		component->SerializeClone(writer);
 	}
@@ -178,13 +178,25 @@ Entity* Entity::Clone() {
 	Entity* cloned = FACTORY->CreateEmptyEntity();
 	//Entity* cloned = CORE->GetManager<EntityManager>()->CreateEmptyEntity();
 
-	for (std::shared_ptr<Component> component : components_) {
+	cloned->components_.reserve(components_.size());
+
+	// Components are already sorted and unique, so they are attached in order
+	for (Component* component : components_) {
 
 		M_DEBUG->WriteDebugMessage("Begin to clone for single component\n");
-		cloned->AddComponent(component->GetComponentTypeID(), component->Clone());
+		Component* clone = component->Clone();
+		DEBUG_ASSERT(clone, "Component is nullptr");
+
+		clone->type_id_ = component->type_id_;
+		cloned->components_.push_back(clone);
 		M_DEBUG->WriteDebugMessage("Ended clone for single component\n");
 	}
 
+	// Components are in the same order, so the bitset and index table carry over
+	cloned->component_mask_ = component_mask_;
+	cloned->component_index_ = component_index_;
+	cloned->archetype_id_ = archetype_id_;
+
 	return cloned;
 }
 
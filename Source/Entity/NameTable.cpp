@@ -0,0 +1,61 @@
+/**********************************************************************************
+*\file         NameTable.cpp
+*\brief        Contains definition of functions and variables used for
+*			   interning entity and archetype names
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Entity/NameTable.h"
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+	struct Table {
+
+		std::unordered_map<std::string, NameID> ids_;
+		// Points at the keys of ids_, which never move
+		std::vector<const std::string*> names_;
+	};
+
+	Table& GetTable() {
+
+		static Table table;
+		return table;
+	}
+}
+
+NameID NameTable::Intern(const std::string& name) {
+
+	Table& table = GetTable();
+	auto result = table.ids_.emplace(name, static_cast<NameID>(table.names_.size()));
+
+	if (result.second) {
+
+		table.names_.push_back(&result.first->first);
+	}
+
+	return result.first->second;
+}
+
+NameID NameTable::Find(const std::string& name) {
+
+	Table& table = GetTable();
+	auto it = table.ids_.find(name);
+
+	return (it != table.ids_.end()) ? it->second : invalid_;
+}
+
+const std::string& NameTable::GetString(NameID id) {
+
+	static const std::string empty{};
+
+	Table& table = GetTable();
+	return (id < table.names_.size()) ? *table.names_[id] : empty;
+}
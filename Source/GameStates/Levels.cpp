@@ -33,8 +33,7 @@ void Level::DeSerialize() {
 	
 	if (path_ != "") {
 		
-		rapidjson::Document doc;
-		DeSerializeJSON(path_, doc);
+		const rapidjson::Document& doc = DeSerializeJSON(path_);
 
 		const rapidjson::Value& files_arr = doc;
 		DEBUG_ASSERT(files_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -100,8 +99,7 @@ Levels::Levels() :
 
 void Levels::DeSerialize(const std::string filepath) { //needs to directly load from doc format
 	
-	rapidjson::Document doc;
-	DeSerializeJSON(filepath, doc);
+	const rapidjson::Document& doc = DeSerializeJSON(filepath);
 
 	path_ = filepath;
 
@@ -90,8 +90,7 @@ void MenuState::Update(Game* game, float frametime)
 
 	for (LogicIt it = logic_arr_->begin(); it != logic_arr_->end(); ++it) {
 
-		std::string scr = it->second->GetLogic("Title");
-		logic_mgr_->Exec(scr, it->first);
+		it->second->GetHook(LogicHook::Title).Exec(it->first);
 	}
 }
 
@@ -120,6 +120,23 @@ void PlayState::Update(Game* game, float frametime)
 		game->ChangeState(&m_WinLoseState, "Lose");
 		return;
 	}
+
+	// Quick save and load, not while the pause menu is up
+	if (!CORE->GetCorePauseStatus()) {
+
+		InputSystem* input = &*CORE->GetSystem<InputSystem>();
+
+		if (input->IsKeyTriggered(GLFW_KEY_F5)) {
+
+			FACTORY->SaveSnapshot("QuickSave");
+		}
+		else if (input->IsKeyTriggered(GLFW_KEY_F9)) {
+
+			RestoreSnapshot("QuickSave");
+			return;
+		}
+	}
+
 	entity_mgr_->GetEntities();
 
 	// To use in play state, in menu state for testing
@@ -183,11 +200,13 @@ void PlayState::Draw(Game* game)
 
 void PlayState::SetStatus(std::string entity_name, StatusType status_type, float status_length, Game* game) {
 	
+	NameID name_id = NameTable::Find(entity_name);
+
 	for (Game::StatusIt it = game->status_arr_->begin(); it != game->status_arr_->end(); ++it) {
 		
-		std::string name = ENTITYNAME(it->second->GetOwner()); // Check for assert here potentially (JSON formatting)
+		NameID name = it->second->GetOwner()->GetComponentType<Name>(ComponentTypes::NAME)->GetNameID(); // Check for assert here potentially (JSON formatting)
 
-		if (name == entity_name && it->second->status_ == StatusType::NONE) {
+		if (name == name_id && it->second->status_ == StatusType::NONE) {
 			
 			it->second->status_ = status_type;
 			it->second->status_timer_ = status_length;
@@ -204,6 +223,23 @@ void PlayState::SetStatus(std::string entity_name, StatusType status_type, float
 	}
 }
 
+void PlayState::RestoreSnapshot(const std::string& slot) {
+
+	CORE->GetSystem<ImguiSystem>()->ResetSelectedEntity();
+
+	if (!FACTORY->LoadSnapshot(slot)) {
+
+		return;
+	}
+
+	// The dialogue box was destroyed along with every other entity
+	CORE->GetSystem<DialogueSystem>()->TempCleanup();
+
+	CORE->GetManager<AMap>()->InitAMap( CORE->GetManager<EntityManager>()->GetEntities() );
+	CORE->GetSystem<PartitioningSystem>()->InitPartition();
+	CORE->GetSystem<ParentingSystem>()->LinkParentAndChild();
+}
+
 std::string PlayState::GetStateName() {
 
 	return "Play";
@@ -250,8 +286,7 @@ void PlayState::StateInputHandler(Message* msg, Game* game) {
 
 			if (logic) {
 				// If the logic is valid, run update loop
-				std::string update = logic->GetLogic("UpdateInput");
-				logic_mgr_->Exec(update, id, msg);
+				logic->GetHook(LogicHook::UpdateInput).Exec(id, msg);
 			}
 		}
 		
@@ -178,7 +178,7 @@ std::vector<std::string> ArchetypeWindow::CheckArchetypeTexture(std::string path
 		for (EntityManager::EntityArchetypeMapTypeIt entityIT = entities_->GetArchetypes().begin(); entityIT != entities_->GetArchetypes().end(); ++entityIT) {
 
 			if (entityIT->second->GetComponent(ComponentTypes::TEXTURERENDERER)) {
-				std::shared_ptr<TextureRenderer> entitytexture = std::dynamic_pointer_cast<TextureRenderer>(entityIT->second->GetComponent(ComponentTypes::TEXTURERENDERER));
+				TextureRenderer* entitytexture = entityIT->second->GetComponentType<TextureRenderer>(ComponentTypes::TEXTURERENDERER);
 
 				if (entitytexture->GetCurrentTextureName() == path)
 					archetypes.push_back(entityIT->first);
@@ -192,7 +192,7 @@ std::vector<std::string> ArchetypeWindow::CheckArchetypeTexture(std::string path
 void ArchetypeWindow::AddArchetype(std::string archetypeName)
 {
 	std::stringstream name;
-	std::shared_ptr<Component> component;
+	Component* component;
 
 	name << archetypeName;
 
@@ -249,7 +249,7 @@ void ArchetypeWindow::AddComponent() {
 
 void ArchetypeWindow::AddSingleComponent(std::string archetype, ComponentTypes component) {
 
-	std::shared_ptr<Component> comp;
+	Component* comp;
 	IComponentCreator* creator = comp_mgr_->GetComponentCreator(archetype.c_str());
 	comp = creator->Create();
 	imgui_->GetEntity()->AddComponent(component, comp);
@@ -398,7 +398,7 @@ void ArchetypeWindow::MissingComponentPopUp() {
 
 		if (ImGui::Button("Remove Texture")) {
 
-			std::shared_ptr<TextureRenderer> entitytexture = std::dynamic_pointer_cast<TextureRenderer>(imgui_->GetEntity()->GetComponent(ComponentTypes::TEXTURERENDERER));
+			TextureRenderer* entitytexture = imgui_->GetEntity()->GetComponentType<TextureRenderer>(ComponentTypes::TEXTURERENDERER);
 			imgui_->GetEntity()->RemoveComponent(entitytexture);
 
 			b_notrans = false;
@@ -11,6 +11,7 @@
 			   written consent of DigiPen Institute of Technology is prohibited.
 **********************************************************************************/
 #include "ImguiWindows/AssetConsoleWindow.h"
+#include "Manager/FileManager.h"
 
 void AssetConsoleWindow::Init() {
 
@@ -86,10 +87,9 @@ void AssetConsoleWindow::AddTextureAnimation() {
 
 void AssetConsoleWindow::LoadTextureJson(std::string level_name) {
 
-	rapidjson::Document texture_doc;
 	std::string path = "Resources/AssetsLoading/" + level_name + "_texture.json";
 
-	DeSerializeJSON(path, texture_doc);
+	const rapidjson::Document& texture_doc = DeSerializeJSON(path);
 
 	const rapidjson::Value& files_arr = texture_doc;
 	DEBUG_ASSERT(files_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -109,9 +109,7 @@ void AssetConsoleWindow::LoadTextureJson(std::string level_name) {
 
 void AssetConsoleWindow::LoadSoundJson(std::string level_name) {
 
-	rapidjson::Document doc;
-
-	DeSerializeJSON(level_name, doc);
+	const rapidjson::Document& doc = DeSerializeJSON(level_name);
 
 	const rapidjson::Value& audio_arr = doc;
 	DEBUG_ASSERT(audio_arr.IsObject(), "Entry does not exist in JSON");
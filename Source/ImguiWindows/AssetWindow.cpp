@@ -11,6 +11,7 @@
 **********************************************************************************/
 
 #include "ImguiWindows\AssetWindow.h"
+#include "Manager/FileManager.h"
 #include <cstring>
 
 void AssetWindow::Init() {
@@ -330,9 +331,7 @@ void AssetWindow::FileDeletion() {
 				}
 				else if (fs::is_regular_file(path) && imgui_->CheckString(path, "texture") && imgui_->CheckString(path, ".json") && !fs::is_empty(path)) {
 
-					rapidjson::Document file;
-
-					DeSerializeJSON(path, file);
+					const rapidjson::Document& file = DeSerializeJSON(path);
 
 					const rapidjson::Value& files_arr = file;
 					DEBUG_ASSERT(files_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -74,6 +74,11 @@ void EntityWindow::Update() {
 
 		graphics_->EnableLighting(b_light);
 
+		bool instanced = graphics_->InstancedSprites();
+
+		if (ImGui::Checkbox("Instanced Sprites", &instanced))
+			graphics_->EnableInstancedSprites(instanced);
+
 		SelectEntityComponent();// to see the components
 		ImGui::End();
 	}
@@ -196,7 +201,7 @@ void EntityWindow::ShowEntityList() {
 
 		for (entityIT = entities_->GetEntities().begin(); entityIT != entities_->GetEntities().end(); entityIT++) {
 
-			std::shared_ptr<Name> entityname = std::dynamic_pointer_cast<Name>(entityIT->second->GetComponent(ComponentTypes::NAME));
+			Name* entityname = entityIT->second->GetComponentType<Name>(ComponentTypes::NAME);
 
 			if (filter.PassFilter(entityname->GetName().c_str())) {
 
@@ -392,7 +397,7 @@ void EntityWindow::ComponentInputInt(const char* componentLabel, const char* inp
 	ImGui::PopItemWidth();
 }
 
-void EntityWindow::RemoveComponent(const char* windowName, std::string objName, Entity* entity, std::shared_ptr<Component> component) {
+void EntityWindow::RemoveComponent(const char* windowName, std::string objName, Entity* entity, Component* component) {
 
 	if (!entity->GetID()) {
 		if (ImGui::Button(ICON_FA_MINUS_SQUARE " Delete"))
@@ -430,7 +435,7 @@ const char* EntityWindow::GetPlayerStatus(int playerState) {
 
 void EntityWindow::AABBComponent(Entity* entity) {
 
-	std::shared_ptr<AABB> entity_AABB = std::dynamic_pointer_cast<AABB>(entity->GetComponent(ComponentTypes::AABB));
+	AABB* entity_AABB = entity->GetComponentType<AABB>(ComponentTypes::AABB);
 
 	Vector2D input_AABB{ entity_AABB->GetAABBScale() };
 
@@ -447,7 +452,7 @@ void EntityWindow::AABBComponent(Entity* entity) {
 
 void EntityWindow::AIComponent(Entity* entity) {
 
-	std::shared_ptr<AI> entity_AI = std::dynamic_pointer_cast<AI>(entity->GetComponent(ComponentTypes::AI));
+	AI* entity_AI = entity->GetComponentType<AI>(ComponentTypes::AI);
 
 	const char* entity_State = GetAIState(entity_AI->GetState());
 	const char* entity_Type = GetAIType(entity_AI->GetType());
@@ -563,7 +568,7 @@ void EntityWindow::AIComponent(Entity* entity) {
 
 void EntityWindow::AnimationRendererComponent(Entity* entity) {
 
-	std::shared_ptr<AnimationRenderer> entity_animation = std::dynamic_pointer_cast<AnimationRenderer>(entity->GetComponent(ComponentTypes::ANIMATIONRENDERER));
+	AnimationRenderer* entity_animation = entity->GetComponentType<AnimationRenderer>(ComponentTypes::ANIMATIONRENDERER);
 	int input_layer = graphics_->GetLayer(&*entity_animation);
 
 	if (ImGui::CollapsingHeader("Animation Component")) {
@@ -585,7 +590,7 @@ void EntityWindow::AnimationRendererComponent(Entity* entity) {
 
 void EntityWindow::CameraComponent(Entity* entity) {
 
-	std::shared_ptr<Camera> entity_camera = std::dynamic_pointer_cast<Camera>(entity->GetComponent(ComponentTypes::CAMERA));
+	Camera* entity_camera = entity->GetComponentType<Camera>(ComponentTypes::CAMERA);
 
 	Vector2D input_cam_pos = {};
 
@@ -621,7 +626,7 @@ void EntityWindow::CameraComponent(Entity* entity) {
 
 void EntityWindow::ConeLightComponent(Entity* entity) {
 
-	std::shared_ptr<ConeLight> entity_cone_light = std::dynamic_pointer_cast<ConeLight>(entity->GetComponent(ComponentTypes::CONELIGHT));
+	ConeLight* entity_cone_light = entity->GetComponentType<ConeLight>(ComponentTypes::CONELIGHT);
 	float input_radius = entity_cone_light->GetRadius();
 	float input_intensity = entity_cone_light->GetIntensity();
 	float input_angle = entity_cone_light->GetAngle();
@@ -650,7 +655,7 @@ void EntityWindow::ConeLightComponent(Entity* entity) {
 
 void EntityWindow::EmitterComponent(Entity* entity) {
 
-	std::shared_ptr<Emitter> entity_emitter = std::dynamic_pointer_cast<Emitter>(entity->GetComponent(ComponentTypes::EMITTER));
+	Emitter* entity_emitter = entity->GetComponentType<Emitter>(ComponentTypes::EMITTER);
 
 	float input_emitterlife = entity_emitter->GetLifeTime();
 	float input_interval = entity_emitter->GetInterval();
@@ -871,7 +876,7 @@ void EntityWindow::EmitterComponent(Entity* entity) {
 
 void EntityWindow::HealthComponent(Entity* entity) {
 
-	std::shared_ptr<Health> entity_health = std::dynamic_pointer_cast<Health>(entity->GetComponent(ComponentTypes::HEALTH));
+	Health* entity_health = entity->GetComponentType<Health>(ComponentTypes::HEALTH);
 	int entity_current_health = entity_health->GetCurrentHealth();
 	int entity_max_health = entity_health->GetMaxHealth();
 
@@ -887,7 +892,7 @@ void EntityWindow::HealthComponent(Entity* entity) {
 
 void EntityWindow::MotionComponent(Entity* entity) {
 
-	std::shared_ptr<Motion> entity_motion = std::dynamic_pointer_cast<Motion>(entity->GetComponent(ComponentTypes::MOTION));
+	Motion* entity_motion = entity->GetComponentType<Motion>(ComponentTypes::MOTION);
 
 	float input_mass = entity_motion->GetMass();
 	if (ImGui::CollapsingHeader("Motion")) {
@@ -903,7 +908,7 @@ void EntityWindow::MotionComponent(Entity* entity) {
 
 void EntityWindow::NameComponent(Entity* entity) {
 
-	std::shared_ptr<Name> entity_name = std::dynamic_pointer_cast<Name>(entity->GetComponent(ComponentTypes::NAME));
+	Name* entity_name = entity->GetComponentType<Name>(ComponentTypes::NAME);
 
 	ImGui::Text("Name:"); ImGui::SameLine(0, 4);
 	ImGui::TextColored(AQUAMARINE, entity_name->GetName().c_str());
@@ -916,7 +921,7 @@ void EntityWindow::NameComponent(Entity* entity) {
 
 void EntityWindow::ParentChildComponent(Entity* entity) {
 
-	std::shared_ptr<ParentChild> entity_parent_child = std::dynamic_pointer_cast<ParentChild>(entity->GetComponent(ComponentTypes::PARENTCHILD));
+	ParentChild* entity_parent_child = entity->GetComponentType<ParentChild>(ComponentTypes::PARENTCHILD);
 	std::list<Entity*> input_child = entity_parent_child->GetChildren();
 	if (ImGui::CollapsingHeader("Parent Child")) {
 
@@ -937,7 +942,7 @@ void EntityWindow::ParentChildComponent(Entity* entity) {
 
 void EntityWindow::ParticleComponent(Entity* entity) {
 
-	std::shared_ptr<Particle> entity_particle = std::dynamic_pointer_cast<Particle>(entity->GetComponent(ComponentTypes::PARTICLE));
+	Particle* entity_particle = entity->GetComponentType<Particle>(ComponentTypes::PARTICLE);
 	if (ImGui::CollapsingHeader("Particle Component")) {
 
 		ImGui::Text("Particle Status: "); ImGui::SameLine(0, 4);
@@ -954,7 +959,7 @@ void EntityWindow::ParticleComponent(Entity* entity) {
 
 void EntityWindow::PointLightComponent(Entity* entity) {
 
-	std::shared_ptr<PointLight> entity_point_light = std::dynamic_pointer_cast<PointLight>(entity->GetComponent(ComponentTypes::POINTLIGHT));
+	PointLight* entity_point_light = entity->GetComponentType<PointLight>(ComponentTypes::POINTLIGHT);
 
 	float input_radius = entity_point_light->GetRadius();
 	float input_intensity = entity_point_light->GetIntensity();
@@ -978,7 +983,7 @@ void EntityWindow::PointLightComponent(Entity* entity) {
 
 void EntityWindow::ScaleComponent(Entity* entity) {
 
-	std::shared_ptr<Scale> entity_scale = std::dynamic_pointer_cast<Scale>(entity->GetComponent(ComponentTypes::SCALE));
+	Scale* entity_scale = entity->GetComponentType<Scale>(ComponentTypes::SCALE);
 
 	Vector2D input_obj_scale = { entity_scale->GetScale() };
 
@@ -991,7 +996,7 @@ void EntityWindow::ScaleComponent(Entity* entity) {
 
 void EntityWindow::SoundEmitterComponent(Entity* entity) {
 
-	std::shared_ptr<SoundEmitter> entity_sound = std::dynamic_pointer_cast<SoundEmitter>(entity->GetComponent(ComponentTypes::SOUNDEMITTER));
+	SoundEmitter* entity_sound = entity->GetComponentType<SoundEmitter>(ComponentTypes::SOUNDEMITTER);
 
 	std::string input_sound_name = entity_sound->GetSoundName();
 	size_t input_num_sound = entity_sound->GetSoundLines().size();
@@ -1078,7 +1083,7 @@ void EntityWindow::SoundEmitterComponent(Entity* entity) {
 
 void EntityWindow::StatusComponent(Entity* entity) {
 
-	std::shared_ptr<Status> entity_status = std::dynamic_pointer_cast<Status>(entity->GetComponent(ComponentTypes::STATUS));
+	Status* entity_status = entity->GetComponentType<Status>(ComponentTypes::STATUS);
 
 	const char* input_state = GetPlayerStatus(static_cast<int>(entity_status->GetStatus()));
 
@@ -1118,7 +1123,7 @@ void EntityWindow::StatusComponent(Entity* entity) {
 
 void EntityWindow::TextureRendererComponent(Entity* entity) {
 
-	std::shared_ptr<TextureRenderer> entity_texture = std::dynamic_pointer_cast<TextureRenderer>(entity->GetComponent(ComponentTypes::TEXTURERENDERER));
+	TextureRenderer* entity_texture = entity->GetComponentType<TextureRenderer>(ComponentTypes::TEXTURERENDERER);
 
 	if (ImGui::CollapsingHeader("Texture Component")) {
 
@@ -1171,7 +1176,7 @@ void EntityWindow::TextureRendererComponent(Entity* entity) {
 
 void EntityWindow::TransformComponent(Entity* entity) {
 
-	std::shared_ptr<Transform> entity_transform = std::dynamic_pointer_cast<Transform>(entity->GetComponent(ComponentTypes::TRANSFORM));
+	Transform* entity_transform = entity->GetComponentType<Transform>(ComponentTypes::TRANSFORM);
 
 	float input_rot = entity_transform->GetRotation();
 	Vector2D input_pos = { entity_transform->GetPosition() };
@@ -2,6 +2,7 @@
 *\file         SystemWindow.cpp
 *\brief        Contains definition of functions and variables used for
 *			   the SystemWindow class to display percentages used by each system
+*			   and the memory used by each component type
 
 *\author	   Ee Ling Adele, Sim, 100% Code Contribution
 *
@@ -13,6 +14,7 @@
 #include "ImguiWindows/SystemWindow.h"
 #include "Engine/Core.h"
 #include "Systems/FrameRateController.h"
+#include "Entity/ComponentPool.h"
 
 void SystemWindow::Init(){
 
@@ -32,6 +34,14 @@ void SystemWindow::Update(){
 		for (std::map<std::string, float>::iterator it = PE_FrameRate.GetSystemPerformance().begin(); it != PE_FrameRate.GetSystemPerformance().end(); ++it) {
 			ImGui::Text(it->first.c_str()); ImGui::SameLine(0, 2); ImGui::Text(": %.4f", (it->second / total_time_ * 100.0f));
 		}
+
+		if (ImGui::CollapsingHeader("Component Memory")) {
+
+			for (IComponentPool* pool : IComponentPool::GetPools()) {
+				ImGui::Text("%s : %zu / %zu, %.1f / %.1f KB", pool->GetName().c_str(), pool->GetLiveCount(), pool->GetCapacity(),
+							pool->GetLiveBytes() / 1024.0f, pool->GetReservedBytes() / 1024.0f);
+			}
+		}
 		ImGui::End();
 	}
 }
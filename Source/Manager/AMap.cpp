@@ -17,6 +17,7 @@
 #include "Systems/Collision.h"
 #include "Components/AABB.h"
 #include "Engine/Core.h"
+#include <algorithm>
 
 void AMap::Init() {
 	
@@ -128,7 +129,6 @@ void AMap::SetNodeNeighbours() {
 		for (int j = 0; j < node_map_[0].size(); ++j) {
 		
 			node_map_[i][j].obstacle_ = false;
-			node_map_[i][j].visited_ = false;
 			node_map_[i][j].nodepos_ = {static_cast<float>(j), static_cast<float>(i)};
 			
 			for (int y = -1; y < 2; ++y) {
@@ -192,39 +192,23 @@ AMap::AMapTypeY AMap::GetNodeMap()
 	return node_map_;
 }
 
-void AMap::InitializeNodes()
+bool AMap::Pathing(std::vector<Vector2D>&  path,Vector2D start, Vector2D des) const
 {
-	for (int i = static_cast<int>(node_map_.size() - 1); i >= 0; --i) {
-		for (int j = 0; j < static_cast<int>(node_map_[0].size()); ++j) {
-			node_map_[i][j].start_ = false;
-			node_map_[i][j].des_ = false;
-			node_map_[i][j].visited_ = false;
-			node_map_[i][j].path_ = false;
-			node_map_[i][j].parent_ = nullptr;
-			node_map_[i][j].F = 0;
-			node_map_[i][j].G = 0;
-			node_map_[i][j].H = 0;
-		}
-	}
-}
+	path.clear();
 
-bool AMap::inlist(std::list<node> L, node N)
-{
-	for (std::list<node>::iterator it = L.begin();
-		it != L.end(); ++it)
-	{
-		if (it->nodepos_.x == N.nodepos_.x && it->nodepos_.y == N.nodepos_.y)
-			return true;
-	}
-	return false;
-}
+	if (node_map_.empty())
+		return false;
 
-bool AMap::Pathing(std::vector<Vector2D>&  path,Vector2D start, Vector2D des)
-{
-	// Reset nodes
-	InitializeNodes();
+	// Search state lives apart from the nodes, one per thread, so searches
+	// can run on several threads at once
+	thread_local std::vector<search_node> search;
+	search.assign(node_map_.size() * node_map_[0].size(), search_node{});
 
-	path.clear();
+	size_t width = node_map_[0].size();
+
+	auto index_of = [width](const node* n) {
+		return static_cast<size_t>(n->nodepos_.y) * width + static_cast<size_t>(n->nodepos_.x);
+	};
 
 	// Localize coordinates
 	Vector2D abs_min;
@@ -232,84 +216,88 @@ bool AMap::Pathing(std::vector<Vector2D>&  path,Vector2D start, Vector2D des)
 	abs_min.y = bottom_left_.y < 0 ? -bottom_left_.y : bottom_left_.y;
 
 	// Set start and destination nodes
-	node* startnode = &node_map_[static_cast<size_t>((start + abs_min).y)][static_cast<size_t>((start + abs_min).x)];
-	node* desnode = &node_map_[static_cast<size_t>((des + abs_min).y)][static_cast<size_t>((des + abs_min).x)];
-	node* currentnode = nullptr;
-
-	// Set for Drawing on map
-	startnode->start_ = true;
-	desnode->des_ = true;
+	const node* startnode = &node_map_[static_cast<size_t>((start + abs_min).y)][static_cast<size_t>((start + abs_min).x)];
+	const node* desnode = &node_map_[static_cast<size_t>((des + abs_min).y)][static_cast<size_t>((des + abs_min).x)];
+	const node* currentnode = nullptr;
 
 	if (desnode->obstacle_)
 		return false;
 
-	std::list<node> openlist;
-	std::list<node> closedlist;
+	// Open nodes keep the costs they were opened with, they are sorted by those
+	std::list<open_node> openlist;
 	// Push starting node into front of the list
-	openlist.push_front(*startnode);
+	openlist.push_front({ startnode, 0.0f, 0.0f });
+	search[index_of(startnode)].open_ = true;
 
 	while (!openlist.empty())
 	{
 		// Set current node as node with lowest F or H cost
-		openlist.sort([](const node lhs, const node rhs) { return (lhs.F < rhs.F || lhs.F == rhs.F && lhs.H < rhs.H); });
-		
+		openlist.sort([](const open_node& lhs, const open_node& rhs) { return (lhs.F < rhs.F || lhs.F == rhs.F && lhs.H < rhs.H); });
+
 		// Set current node to start of the list
-		currentnode = &node_map_[static_cast<size_t>(openlist.front().nodepos_.y)][static_cast<size_t>(openlist.front().nodepos_.x)];
+		currentnode = openlist.front().node_;
 
 		// Remove node from openlist and add to closed list
-		closedlist.push_front(openlist.front());
+		search_node& current = search[index_of(currentnode)];
+		current.open_ = false;
+		current.closed_ = true;
 		openlist.pop_front();
 
 		// If des reached exit
 		if (currentnode == desnode)
 		{
-			while (currentnode->parent_)
+			while (search[index_of(currentnode)].parent_)
 			{
-				currentnode->path_ = true;
 				path.push_back(currentnode->nodepos_ - abs_min);
-				currentnode = currentnode->parent_;
+				currentnode = search[index_of(currentnode)].parent_;
 			}
 			return true;
 		}
 
 		for (auto nnode : currentnode->neighbour_)
 		{
+			search_node& neighbour = search[index_of(nnode)];
 
-			if (nnode->obstacle_ || inlist(closedlist, *nnode))
+			if (nnode->obstacle_ || neighbour.closed_)
 				continue;
 
-			int newNeighbourCost = static_cast<int>(currentnode->G +
+			int newNeighbourCost = static_cast<int>(current.G +
 				Vector2DDistance(currentnode->nodepos_, nnode->nodepos_));
-			if (newNeighbourCost < nnode->G || !inlist(openlist, *nnode)) {
-				nnode->G = static_cast<float>(newNeighbourCost);
-				nnode->H = Vector2DDistance(nnode->nodepos_, desnode->nodepos_);
-				nnode->F = nnode->G + nnode->H;
-				nnode->parent_ = currentnode;
-				nnode->visited_ = true;
+			if (newNeighbourCost < neighbour.G || !neighbour.open_) {
+				neighbour.G = static_cast<float>(newNeighbourCost);
+				neighbour.H = Vector2DDistance(nnode->nodepos_, desnode->nodepos_);
+				neighbour.F = neighbour.G + neighbour.H;
+				neighbour.parent_ = currentnode;
 
 				// Insert node into open list if not in list
-				if (!inlist(openlist, *nnode))
-					openlist.push_front(*nnode);
+				if (!neighbour.open_) {
+					openlist.push_front({ nnode, neighbour.F, neighbour.H });
+					neighbour.open_ = true;
+				}
 			}
 		}
 	}
 	return false;
 }
 
-void AMap::DrawMap()
+void AMap::DrawMap(const std::vector<Vector2D>& path) const
 {
+	Vector2D abs_min;
+	abs_min.x = bottom_left_.x < 0 ? -bottom_left_.x : bottom_left_.x;
+	abs_min.y = bottom_left_.y < 0 ? -bottom_left_.y : bottom_left_.y;
+
 	std::cout << "---------------------------" << std::endl;
 	for (int i = static_cast<int>(node_map_.size()-1); i >= 0; --i) {
 		for (int j = 0; j < static_cast<int>(node_map_[0].size()); ++j) {
 			std::cout << "|";
-			if(node_map_[i][j].start_)
-				std::cout << "S";
-			else if (node_map_[i][j].des_)
-				std::cout << "D";
-			else if (node_map_[i][j].path_)
+
+			Vector2D pos = node_map_[i][j].nodepos_ - abs_min;
+			bool on_path = std::find_if(path.begin(), path.end(), [&pos](const Vector2D& p) {
+				return p.x == pos.x && p.y == pos.y;
+			}) != path.end();
+
+			if (on_path)
 				std::cout << "*";
-			else if (node_map_[i][j].visited_)
-				std::cout << ".";
 			else if (node_map_[i][j].obstacle_)
 				std::cout << "X";
 			else
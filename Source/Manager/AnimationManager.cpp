@@ -13,6 +13,7 @@
 
 
 #include "Manager/AnimationManager.h"
+#include "Manager/FileManager.h"
 #include "Systems/GraphicsSystem.h"
 #include "Systems/Debug.h"
 #include "Engine/Core.h"
@@ -61,12 +62,17 @@ std::vector<glm::vec2>* Animation::GetTexVtx() {
 }
 
 AnimationSet::AnimationSet(GLuint animation_frames,
-						   std::vector<std::pair<std::string, int>>* animation_names_frames) :
+						   std::vector<std::pair<std::string, int>> animation_names_frames) :
 	animation_frames_{ animation_frames },
 	animation_names_frames_{ animation_names_frames } {
 
 }
 
+GLuint AnimationSet::GetAnimationFramesHandle() {
+
+	return animation_frames_;
+}
+
 void AnimationSet::UnloadAnimationSet() {
 
 	glDeleteTextures(1, &animation_frames_);
@@ -81,10 +87,9 @@ void AnimationManager::Init() {
 
 void AnimationManager::AnimationBatchLoad(std::string level_name) {
 
-	rapidjson::Document animations_to_load;
 	std::string path = "Resources/AssetsLoading/" + level_name + "_animation.json";
 
-	DeSerializeJSON(path, animations_to_load);
+	const rapidjson::Document& animations_to_load = DeSerializeJSON(path);
 
 	const rapidjson::Value& files_arr = animations_to_load;
 	DEBUG_ASSERT(files_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -92,49 +97,53 @@ void AnimationManager::AnimationBatchLoad(std::string level_name) {
 	//handle sorting of information into the map
 	for (rapidjson::Value::ConstMemberIterator file_it = files_arr.MemberBegin(); file_it != files_arr.MemberEnd(); ++file_it) {
 
-		std::string path_name{ file_it->value.GetString() };
+		LoadAnimationSet(file_it->value.GetString());
+	}
+}
 
-		rapidjson::Document animation_set_data;
-		DeSerializeJSON(path_name, animation_set_data);
+std::string AnimationManager::LoadAnimationSet(std::string path_name) {
 
-		//Only one element in this array
-		const rapidjson::Value& animation_set_arr = animation_set_data;
-		DEBUG_ASSERT(animation_set_arr.IsObject(), "Level JSON does not exist in proper format");
+	const rapidjson::Document& animation_set_data = DeSerializeJSON(path_name);
 
+	//Only one element in this array
+	const rapidjson::Value& animation_set_arr = animation_set_data;
+	DEBUG_ASSERT(animation_set_arr.IsObject(), "Level JSON does not exist in proper format");
 
-		const rapidjson::Value& animation_set_param = *animation_set_arr.MemberBegin()->value.Begin();
 
-		rapidjson::Value::ConstMemberIterator animation_set_param_it = animation_set_param.MemberBegin();
+	const rapidjson::Value& animation_set_param = *animation_set_arr.MemberBegin()->value.Begin();
 
-		std::string texture_pathname = std::string{ "Resources/Sprites/" } + (animation_set_param_it++)->value.GetString() +
-											"/" + animation_set_arr.MemberBegin()->name.GetString();
+	rapidjson::Value::ConstMemberIterator animation_set_param_it = animation_set_param.MemberBegin();
 
-		std::string animation_set_name = (animation_set_param_it++)->value.GetString();
-		int columns = std::stoi((animation_set_param_it++)->value.GetString());
-		int rows = std::stoi((animation_set_param_it++)->value.GetString());
+	std::string texture_pathname = std::string{ "Resources/Sprites/" } + (animation_set_param_it++)->value.GetString() +
+										"/" + animation_set_arr.MemberBegin()->name.GetString();
 
-		std::vector<std::pair<std::string, int>> animation_names_frames;
-		std::vector<GLfloat> frame_durations;
+	std::string animation_set_name = (animation_set_param_it++)->value.GetString();
+	int columns = std::stoi((animation_set_param_it++)->value.GetString());
+	int rows = std::stoi((animation_set_param_it++)->value.GetString());
 
-		for (; animation_set_param_it != animation_set_param.MemberEnd(); ++animation_set_param_it) {
+	std::vector<std::pair<std::string, int>> animation_names_frames;
+	std::vector<GLfloat> frame_durations;
 
-			std::stringstream stream;
-			stream << animation_set_param_it->value.GetString();
+	for (; animation_set_param_it != animation_set_param.MemberEnd(); ++animation_set_param_it) {
 
-			std::string animation_name;
-			int number_of_frames;
-			float frame_duration;
+		std::stringstream stream;
+		stream << animation_set_param_it->value.GetString();
 
-			stream >> animation_name >> number_of_frames >> frame_duration;
+		std::string animation_name;
+		int number_of_frames;
+		float frame_duration;
 
-			animation_names_frames.push_back({animation_name, number_of_frames});
-			frame_durations.push_back(frame_duration);
-		}
+		stream >> animation_name >> number_of_frames >> frame_duration;
 
-		CreateAnimation(texture_pathname.c_str(), animation_set_name,
-						columns, rows,
-						&animation_names_frames, frame_durations);
+		animation_names_frames.push_back({animation_name, number_of_frames});
+		frame_durations.push_back(frame_duration);
 	}
+
+	CreateAnimation(texture_pathname.c_str(), animation_set_name,
+					columns, rows,
+					&animation_names_frames, frame_durations);
+
+	return animation_set_name;
 }
 
 void AnimationManager::CreateAnimation(const char* filename,
@@ -144,7 +153,20 @@ void AnimationManager::CreateAnimation(const char* filename,
 									   std::vector<std::pair<std::string, int>>* animation_names_frames,
 									   std::vector<GLfloat> frame_durations) {
 	
-	GLuint image_handle = texture_manager_->LoadImageFile(filename)[2];
+	bool atlas = texture_manager_->IsCollectingAtlas();
+	size_t atlas_image = 0;
+	GLuint image_handle = 0;
+
+	//while collecting, the handle is only known once the atlas is packed
+	if (atlas) {
+
+		atlas_image = texture_manager_->AddAtlasImage(filename);
+	}
+	else {
+
+		image_handle = texture_manager_->LoadImageFile(filename)[2];
+	}
+
 	float offset_x = 1.0f / columns;
 
 	for (int i = 0; i < rows; ++i) {
@@ -160,24 +182,42 @@ void AnimationManager::CreateAnimation(const char* filename,
 									 { offset_x, 1 - (i * 1.0f / rows) } };
 
 		int num_frames = (*animation_names_frames)[i].second;
-		animations_[(*animation_names_frames)[i].first] = Animation{ num_frames, image_handle, frame_durations[i], offset_x,  temp };
+		Animation& animation = animations_[(*animation_names_frames)[i].first];
+		animation = Animation{ num_frames, image_handle, frame_durations[i], offset_x,  temp };
+
+		if (atlas) {
+
+			texture_manager_->AddAtlasUser(atlas_image, &animation.animation_frames_,
+										   &animation.tex_vtx_, &animation.offset_x_);
+		}
 	}
 
-	animation_sets_[animation_set_name] = AnimationSet{ image_handle, animation_names_frames };
+	AnimationSet& animation_set = animation_sets_[animation_set_name];
+	animation_set = AnimationSet{ image_handle, *animation_names_frames };
+
+	if (atlas) {
+
+		texture_manager_->AddAtlasUser(atlas_image, &animation_set.animation_frames_);
+	}
 }
 
-bool AnimationManager::UnloadAnimationSet(std::vector<std::pair<std::string, int>>* animation_name) {
+bool AnimationManager::UnloadAnimationSet(std::string animation_set_name) {
 	
-	auto it = animation_sets_.find((*animation_name)[0].first);
+	auto it = animation_sets_.find(animation_set_name);
 
 	if (it != animation_sets_.end()) {
 
-		for (int i = 1; i < animation_name->size(); ++i) {
+		for (const std::pair<std::string, int>& animation_name : it->second.animation_names_frames_) {
 
-			animations_.erase((*animation_name)[i].first);
+			animations_.erase(animation_name.first);
+		}
+
+		//atlas pages are shared with other animation sets and tilesets
+		if (!texture_manager_->IsAtlasPage(it->second.animation_frames_)) {
+
+			it->second.UnloadAnimationSet();
 		}
 
-		it->second.UnloadAnimationSet();
 		animation_sets_.erase(it);
 		return true;
 	}
@@ -189,7 +229,10 @@ void AnimationManager::UnloadAllAnimationSets()
 {
 	for (auto it = animation_sets_.begin(); it != animation_sets_.end(); ++it) {
 
-		it->second.UnloadAnimationSet();
+		if (!texture_manager_->IsAtlasPage(it->second.animation_frames_)) {
+
+			it->second.UnloadAnimationSet();
+		}
 	}
 
 	animations_.clear();
@@ -206,6 +249,13 @@ void AnimationManager::ChangeAnimationFrameDuration(std::string animation_name,
 	animations_[animation_name].ChangeFrameDuration(new_frame_duration);
 }
 
+AnimationSet* AnimationManager::GetAnimationSet(std::string animation_set_name) {
+
+	auto it = animation_sets_.find(animation_set_name);
+
+	return (it != animation_sets_.end()) ? &it->second : nullptr;
+}
+
 std::map<std::string, Animation>& AnimationManager::GetAnimationMap() {
 
 	return animations_;
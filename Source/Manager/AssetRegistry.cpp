@@ -0,0 +1,392 @@
+/**********************************************************************************
+*\file         AssetRegistry.cpp
+*\brief        Contains definition of functions and variables used for
+*			   the Asset Registry
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Manager/AssetRegistry.h"
+#include "Manager/TextureManager.h"
+#include "Manager/AnimationManager.h"
+#include "Manager/FontManager.h"
+#include "Manager/FileManager.h"
+#include "Systems/SoundSystem.h"
+#include "Systems/Debug.h"
+#include "Engine/Core.h"
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+
+namespace {
+
+	const std::string manifest_directory = "Resources/AssetsLoading/";
+
+	bool EndsWith(const std::string& name, const std::string& suffix) {
+
+		return name.size() >= suffix.size() &&
+			   name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+	}
+
+	size_t GetTextureSize(GLuint handle, size_t bytes_per_pixel) {
+
+		GLint width = 0, height = 0;
+
+		glBindTexture(GL_TEXTURE_2D, handle);
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		return static_cast<size_t>(width) * height * bytes_per_pixel;
+	}
+}
+
+AssetRegistry::AssetRegistry() :
+	resident_size_{ 0 },
+	budget_{ 0 },
+	texture_manager_{ nullptr },
+	animation_manager_{ nullptr },
+	font_manager_{ nullptr },
+	sound_system_{ nullptr } {
+
+}
+
+void AssetRegistry::Init() {
+
+	texture_manager_ = &*CORE->GetManager<TextureManager>();
+	animation_manager_ = &*CORE->GetManager<AnimationManager>();
+	font_manager_ = &*CORE->GetManager<FontManager>();
+	sound_system_ = &*CORE->GetSystem<SoundSystem>();
+
+	const rapidjson::Document& doc = DeSerializeJSON(manifest_directory + "levels.json");
+
+	const rapidjson::Value& levels_arr = doc;
+	DEBUG_ASSERT(levels_arr.IsObject(), "Level manifests JSON does not exist in proper format");
+
+	for (rapidjson::Value::ConstMemberIterator level_it = levels_arr.MemberBegin(); level_it != levels_arr.MemberEnd(); ++level_it) {
+
+		std::string level_name{ level_it->name.GetString() };
+		std::stringstream stream;
+		stream << level_it->value.GetString();
+
+		// The budget is given in megabytes
+		if (level_name == "Budget") {
+
+			size_t megabytes = 0;
+			stream >> megabytes;
+			SetBudget(megabytes * 1024 * 1024);
+			continue;
+		}
+
+		std::vector<std::string>& manifests = levels_[level_name];
+
+		for (std::string manifest; stream >> manifest;) {
+
+			manifests.push_back(manifest);
+		}
+	}
+
+	M_DEBUG->WriteDebugMessage("Asset Registry Init\n");
+}
+
+const std::vector<AssetRegistry::Asset*>& AssetRegistry::GetManifest(const std::string& manifest) {
+
+	auto it = manifests_.find(manifest);
+
+	if (it != manifests_.end()) {
+
+		return it->second;
+	}
+
+	std::vector<Asset*>& assets = manifests_[manifest];
+	std::string path = manifest_directory + manifest + ".json";
+
+	if (!std::filesystem::exists(path)) {
+
+		M_DEBUG->WriteDebugMessage("Asset manifest does not exist: " + path + "\n");
+		return assets;
+	}
+
+	AssetType type = EndsWith(manifest, "_texture") ? AssetType::TILESET :
+					 EndsWith(manifest, "_animation") ? AssetType::ANIMATION_SET :
+					 EndsWith(manifest, "_font") ? AssetType::FONT : AssetType::SOUND;
+
+	const rapidjson::Document& doc = DeSerializeJSON(path);
+
+	const rapidjson::Value& files_arr = doc;
+	DEBUG_ASSERT(files_arr.IsObject(), "Asset manifest JSON does not exist in proper format");
+
+	for (rapidjson::Value::ConstMemberIterator file_it = files_arr.MemberBegin(); file_it != files_arr.MemberEnd(); ++file_it) {
+
+		std::string name{ file_it->name.GetString() };
+		std::stringstream source;
+
+		switch (type) {
+
+		case AssetType::ANIMATION_SET:
+		case AssetType::FONT:
+		{
+			// Keyed by the file loaded, the entry names only label the entries
+			name = file_it->value.GetString();
+			break;
+		}
+		case AssetType::TILESET:
+		{
+			source << file_it->value.GetString();
+			break;
+		}
+		case AssetType::SOUND:
+		{
+			for (rapidjson::Value::ConstValueIterator value_it = file_it->value.Begin(); value_it != file_it->value.End(); ++value_it) {
+
+				for (rapidjson::Value::ConstMemberIterator it = value_it->MemberBegin(); it != value_it->MemberEnd(); ++it) {
+
+					source << it->value.GetString() << " ";
+				}
+			}
+			break;
+		}
+		}
+
+		Asset& asset = assets_[{ type, name }];
+
+		// An asset listed by several manifests is the same asset
+		if (asset.name_.empty()) {
+
+			asset = Asset{ type, name, name, source.str(), 0, 0, false, false, false, {} };
+		}
+
+		assets.push_back(&asset);
+	}
+
+	return assets;
+}
+
+void AssetRegistry::Acquire(Asset& asset) {
+
+	if (asset.unused_) {
+
+		unused_.erase(asset.unused_it_);
+		asset.unused_ = false;
+	}
+
+	if (!asset.resident_) {
+
+		Load(asset);
+	}
+
+	++asset.references_;
+}
+
+void AssetRegistry::Release(Asset& asset) {
+
+	if (--asset.references_ > 0 || asset.pinned_) {
+
+		return;
+	}
+
+	asset.unused_ = true;
+	asset.unused_it_ = unused_.insert(unused_.end(), &asset);
+}
+
+void AssetRegistry::Load(Asset& asset) {
+
+	// Atlas pages are shared, unloading one of their users frees nothing
+	bool atlas = texture_manager_->IsCollectingAtlas() &&
+				 (asset.type_ == AssetType::TILESET || asset.type_ == AssetType::ANIMATION_SET);
+
+	switch (asset.type_) {
+
+	case AssetType::TILESET:
+	{
+		std::stringstream source{ asset.source_ };
+		std::string texture_path;
+		size_t columns = 1, rows = 1;
+		source >> texture_path >> columns >> rows;
+
+		texture_manager_->CreateTileset(texture_path.c_str(), columns, rows, asset.name_);
+
+		auto it = texture_manager_->GetTextureMap().find(asset.name_ + "_0");
+
+		asset.size_ = (atlas || it == texture_manager_->GetTextureMap().end()) ? 0 :
+					  it->second.GetWidth() * it->second.GetHeight() * 4;
+		break;
+	}
+	case AssetType::ANIMATION_SET:
+	{
+		asset.loaded_name_ = animation_manager_->LoadAnimationSet(asset.name_);
+
+		AnimationSet* animation_set = animation_manager_->GetAnimationSet(asset.loaded_name_);
+
+		asset.size_ = (atlas || !animation_set) ? 0 :
+					  GetTextureSize(animation_set->GetAnimationFramesHandle(), 4);
+		break;
+	}
+	case AssetType::FONT:
+	{
+		font_manager_->LoadFont(asset.name_);
+
+		Font* font = font_manager_->GetFont(asset.name_);
+
+		if (!font) {
+
+			M_DEBUG->WriteDebugMessage("Font failed to load: " + asset.name_ + "\n");
+		}
+
+		// Glyph atlases hold a single channel
+		asset.size_ = !font ? 0 : GetTextureSize(font->GetAtlasHandle(), 1);
+		break;
+	}
+	case AssetType::SOUND:
+	{
+		std::stringstream source{ asset.source_ };
+		sound_system_->LoadSound(asset.name_, source);
+
+		asset.size_ = sound_system_->GetSoundSize(asset.name_);
+		break;
+	}
+	}
+
+	asset.resident_ = true;
+	asset.pinned_ = asset.pinned_ || atlas;
+
+	if (!asset.pinned_) {
+
+		resident_size_ += asset.size_;
+	}
+
+	M_DEBUG->WriteDebugMessage("Asset loaded: " + asset.loaded_name_ + "\n");
+}
+
+void AssetRegistry::Unload(Asset& asset) {
+
+	switch (asset.type_) {
+
+	case AssetType::TILESET:
+	{
+		texture_manager_->UnloadTileset(asset.loaded_name_);
+		break;
+	}
+	case AssetType::ANIMATION_SET:
+	{
+		animation_manager_->UnloadAnimationSet(asset.loaded_name_);
+		break;
+	}
+	case AssetType::FONT:
+	{
+		font_manager_->UnloadFont(asset.loaded_name_);
+		break;
+	}
+	case AssetType::SOUND:
+	{
+		sound_system_->RemoveSound(asset.loaded_name_);
+		break;
+	}
+	}
+
+	asset.resident_ = false;
+	resident_size_ -= asset.size_;
+
+	M_DEBUG->WriteDebugMessage("Asset unloaded: " + asset.loaded_name_ + "\n");
+}
+
+void AssetRegistry::Pin(const std::string& manifest) {
+
+	for (Asset* asset : GetManifest(manifest)) {
+
+		if (asset->unused_) {
+
+			unused_.erase(asset->unused_it_);
+			asset->unused_ = false;
+		}
+
+		if (!asset->resident_) {
+
+			Load(*asset);
+		}
+
+		if (!asset->pinned_) {
+
+			asset->pinned_ = true;
+			resident_size_ -= asset->size_;
+		}
+	}
+}
+
+void AssetRegistry::BeginTransition() {
+
+	levels_leaving_.insert(levels_leaving_.end(), levels_held_.begin(), levels_held_.end());
+	levels_held_.clear();
+}
+
+void AssetRegistry::AcquireLevel(const std::string& level_name) {
+
+	if (std::find(levels_held_.begin(), levels_held_.end(), level_name) != levels_held_.end()) {
+
+		return;
+	}
+
+	auto level_it = levels_.find(level_name);
+
+	if (level_it == levels_.end()) {
+
+		M_DEBUG->WriteDebugMessage("No asset manifests listed for level: " + level_name + "\n");
+		return;
+	}
+
+	levels_held_.push_back(level_name);
+
+	for (const std::string& manifest : level_it->second) {
+
+		for (Asset* asset : GetManifest(manifest)) {
+
+			Acquire(*asset);
+		}
+	}
+}
+
+void AssetRegistry::EndTransition() {
+
+	for (const std::string& level_name : levels_leaving_) {
+
+		auto level_it = levels_.find(level_name);
+
+		for (const std::string& manifest : level_it->second) {
+
+			for (Asset* asset : GetManifest(manifest)) {
+
+				Release(*asset);
+			}
+		}
+	}
+
+	levels_leaving_.clear();
+	Trim();
+}
+
+void AssetRegistry::Trim() {
+
+	while (resident_size_ > budget_ && !unused_.empty()) {
+
+		Asset* asset = unused_.front();
+		unused_.pop_front();
+		asset->unused_ = false;
+
+		Unload(*asset);
+	}
+}
+
+void AssetRegistry::SetBudget(size_t budget) {
+
+	budget_ = budget;
+}
+
+size_t AssetRegistry::GetResidentSize() const {
+
+	return resident_size_;
+}
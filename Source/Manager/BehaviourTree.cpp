@@ -11,50 +11,234 @@
 **********************************************************************************/
 
 #include "Manager/BehaviourTree.h"
+#include "Manager/ComponentManager.h"
+#include "Systems/GraphicsSystem.h"
+#include "Systems/Message.h"
+#include "Engine/Core.h"
+
+Behaviour::Tree::Tree() : collision_(nullptr) {
 
-const std::vector<Behaviour::Node*>& Behaviour::CompositeNode::getChildren() const {
-	return children;
 }
 
-void Behaviour::CompositeNode::addChild(Node* child) {
-	children.emplace_back(child);
+void Behaviour::Tree::Open(NodeType type) {
+
+	DEBUG_ASSERT((type != NodeType::Action), "Actions are added through Leaf");
+
+	open_.push_back(static_cast<uint16_t>(nodes_.size()));
+	nodes_.push_back({ nullptr, 0.0f, 0, SentrySlot, type });
 }
 
-Behaviour::CompositeNode::~CompositeNode(){
-	for (Node* child : getChildren()) {
-		if (child)
-			delete child;
-	}
+void Behaviour::Tree::Leaf(Action action, float param, DestinationSlot slot) {
+
+	DEBUG_ASSERT((action != nullptr), "Leaf requires an action");
+
+	uint16_t index = static_cast<uint16_t>(nodes_.size());
+	nodes_.push_back({ action, param, static_cast<uint16_t>(index + 1), slot, NodeType::Action });
 }
 
-bool Behaviour::Selector::run(){
-	for (Node* child : getChildren()) {
-		if (child->run())
-			return true;
+void Behaviour::Tree::Close() {
+
+	DEBUG_ASSERT((!open_.empty()), "Close called without a matching Open");
+
+	uint16_t index = open_.back();
+	Node& node = nodes_[index];
+	node.end_ = static_cast<uint16_t>(nodes_.size());
+	open_.pop_back();
+
+	DEBUG_ASSERT((node.type_ != NodeType::Inverter ||
+				 (node.end_ > index + 1 && nodes_[index + 1].end_ == node.end_)), "Inverter requires exactly one child");
+}
+
+void Behaviour::Tree::CollisionResponse(Agent& agent, EntityID obj) const {
+
+	if (collision_)
+		collision_(agent, obj);
+}
+
+bool Behaviour::Tree::Tick(Agent& agent, const Context& context) const {
+
+	DEBUG_ASSERT((open_.empty()), "Tree has an unclosed composite");
+
+	if (nodes_.empty())
+		return false;
+
+	return Run(0, agent, context);
+}
+
+bool Behaviour::Tree::Run(uint16_t index, Agent& agent, const Context& context) const {
+
+	const Node& node = nodes_[index];
+
+	switch (node.type_)
+	{
+	case NodeType::Action:
+	{
+		agent.cursor_ = index;
+		return node.action_(agent, context, node);
+	}
+	case NodeType::Sequence:
+	{
+		// Fails on the first child that fails
+		for (uint16_t child = index + 1; child < node.end_; child = nodes_[child].end_) {
+			if (!Run(child, agent, context))
+				return false;
+		}
+		return true;
+	}
+	case NodeType::Selector:
+	{
+		// Succeeds on the first child that succeeds
+		for (uint16_t child = index + 1; child < node.end_; child = nodes_[child].end_) {
+			if (Run(child, agent, context))
+				return true;
+		}
+		return false;
+	}
+	case NodeType::Inverter:
+	{
+		return !Run(index + 1, agent, context);
+	}
 	}
+
 	return false;
 }
 
-bool Behaviour::Sequence::run() {
-	for (Node* child : getChildren()) {
-		if (!child->run())
-			return false;
-	}
-	return true;
+Behaviour::Commands::Commands() :
+	deferred_{ false },
+	graphics_{ nullptr },
+	forces_{ nullptr },
+	map_{ nullptr }
+{  }
+
+void Behaviour::Commands::Bind(GraphicsSystem* graphics, ForcesManager* forces, AMap* map) {
+
+	graphics_ = graphics;
+	forces_ = forces;
+	map_ = map;
 }
 
-void Behaviour::Root::setChild(Node* newchild) {
-	child = newchild;
+void Behaviour::Commands::AddForce(EntityID id, ForcesManager::ForceID force, float age, const Vector2D& direction) {
+
+	Command command{ Type::AddForce, id, force, age, direction };
+
+	if (deferred_)
+		commands_.push_back(command);
+	else
+		Execute(command);
 }
 
-bool Behaviour::Root::run() {
-	return child->run();
+void Behaviour::Commands::ChangeAnimation(AnimationRenderer* renderer, const char* name) {
+
+	Command command{ Type::ChangeAnimation };
+	command.renderer_ = renderer;
+	command.name_ = name;
+
+	if (deferred_)
+		commands_.push_back(command);
+	else
+		Execute(command);
+}
+
+void Behaviour::Commands::FlipTexture(AnimationRenderer* renderer) {
+
+	Command command{ Type::FlipTexture };
+	command.renderer_ = renderer;
+
+	if (deferred_)
+		commands_.push_back(command);
+	else
+		Execute(command);
+}
+
+void Behaviour::Commands::PlayBGM(const char* name) {
+
+	Command command{ Type::PlayBGM };
+	command.name_ = name;
+
+	if (deferred_)
+		commands_.push_back(command);
+	else
+		Execute(command);
+}
+
+bool Behaviour::Commands::FindPath(AI* ai, const Vector2D& start, const Vector2D& des) {
+
+	Command command{ Type::FindPath };
+	command.ai_ = ai;
+	command.a_ = start;
+	command.b_ = des;
+
+	// Searches are answered right away in both modes so the leaves after it
+	// see the path. Pathing only reads the map, so batches search together
+	return Execute(command);
+}
+
+void Behaviour::Commands::Flush() {
+
+	for (const Command& command : commands_)
+		Execute(command);
+
+	commands_.clear();
 }
 
-void Behaviour::Inverter::setChild(Node* newchild) {
-	child = newchild;
+bool Behaviour::Commands::Execute(const Command& command) {
+
+	switch (command.type_)
+	{
+	case Type::AddForce:
+	{
+		forces_->AddForce(command.id_, command.force_, command.age_, command.a_);
+		break;
+	}
+	case Type::ChangeAnimation:
+	{
+		graphics_->ChangeAnimation(command.renderer_, command.name_);
+		break;
+	}
+	case Type::FlipTexture:
+	{
+		graphics_->FlipTextureY(command.renderer_);
+		break;
+	}
+	case Type::PlayBGM:
+	{
+		MessageBGM_Play msg{ command.name_ };
+		CORE->BroadcastMessage(&msg);
+		break;
+	}
+	case Type::FindPath:
+	{
+		return map_->Pathing(command.ai_->GetPath(), command.a_, command.b_);
+	}
+	}
+
+	return true;
 }
 
-bool Behaviour::Inverter::run() {
-	return !child->run();
-}
\ No newline at end of file
+void Behaviour::BindAgent(Agent& agent, EntityID id) {
+
+	ComponentManager* component_mgr = &*CORE->GetManager<ComponentManager>();
+	Blackboard& board = agent.board_;
+
+	agent.id_ = id;
+	agent.cursor_ = 0;
+	agent.lod_ = NearLod;
+	// Scheduled by the LogicSystem on the first step it sees the agent
+	agent.last_tick_ = UINT32_MAX;
+	agent.tick_delta_ = 0.0f;
+
+	board.ai_ = component_mgr->GetComponent<AI>(id);
+	board.transform_ = component_mgr->GetComponent<Transform>(id);
+	board.motion_ = component_mgr->GetComponent<Motion>(id);
+	board.renderer_ = component_mgr->GetComponent<AnimationRenderer>(id);
+	board.point_light_ = component_mgr->GetComponent<PointLight>(id);
+	board.cone_light_ = component_mgr->GetComponent<ConeLight>(id);
+	board.animated_ = board.ai_ && board.motion_ && board.renderer_ &&
+					  component_mgr->GetComponent<Name>(id);
+
+	for (Vector2D& destination : board.destination_)
+		destination = Vector2D{};
+
+	board.respawn_timer_.TimerStop();
+	board.respawn_timer_.TimerReset();
+}
@@ -12,6 +12,7 @@
 
 
 #include "Manager/DialogueManager.h"
+#include "Manager/FileManager.h"
 #include "Systems/Game.h"
 
 DialogueContent::DialogueContent(std::string portrait, std::string name, std::string speech)
@@ -40,10 +41,9 @@ void DialogueManager::Init()
 
 void DialogueManager::LoadDialogueSet(std::string level_name)
 {
-    rapidjson::Document dialogueset_to_load;
     std::string dialogueset_path = "Resources/Dialogue/" + level_name + "_dialogue.json";
 
-    DeserializeJSON(dialogueset_path, dialogueset_to_load);
+    const rapidjson::Document& dialogueset_to_load = DeSerializeJSON(dialogueset_path);
 
     const rapidjson::Value& files_arr = dialogueset_to_load;
     DEBUG_ASSERT(files_arr.IsObject(), "Dialogue JSON does not exist in proper format");
@@ -60,9 +60,7 @@ void DialogueManager::LoadDialogueSet(std::string level_name)
 
 void DialogueManager::LoadDialogue(std::string dialogue_name, std::string path)
 {
-    rapidjson::Document dialogue_to_load;
-
-    DeserializeJSON(path, dialogue_to_load);
+    const rapidjson::Document& dialogue_to_load = DeSerializeJSON(path);
 
     const rapidjson::Value& files_arr = dialogue_to_load;
     DEBUG_ASSERT(files_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -83,27 +81,6 @@ void DialogueManager::LoadDialogue(std::string dialogue_name, std::string path)
     dialogues_[dialogue_name] = { contents };
 }
 
-void DialogueManager::DeserializeJSON(const std::string& filename, rapidjson::Document& doc)
-{
-    std::ifstream input_file(filename.c_str());
-    DEBUG_ASSERT(input_file.is_open(), "File does not exist");
-
-    // Read each line separated by a '\n' into a stringstream
-    std::stringstream json_doc_buffer;
-    std::string input;
-
-    while (std::getline(input_file, input)) {
-
-        json_doc_buffer << input << "\n";
-    }
-
-    // Close the file (.json) after
-    input_file.close();
-
-    // Parse the stringstream into document (DOM) format
-    doc.Parse(json_doc_buffer.str().c_str());
-}
-
 Dialogue* DialogueManager::GetDialogue(std::string dialogue_name)
 {
     return &dialogues_[dialogue_name];
@@ -19,7 +19,8 @@
 
 EntityManager::EntityManager() :
 	last_entity_id_{},
-	player_ptr_{ nullptr }
+	player_ptr_{ nullptr },
+	player_name_{ NameTable::Intern("Player") }
 {	}
 
 void EntityManager::Init() {
@@ -64,6 +65,53 @@ Entity* EntityManager::CloneArchetype(const std::string& archetype_name) {
 	return cloned;
 }
 
+EntityIDRange EntityManager::InstantiateArchetype(const std::string& archetype_name, size_t count,
+												  const std::function<void(Entity*, size_t)>& initializer) {
+
+	EntityArchetypeMapTypeIt it = entity_archetype_map_.find(archetype_name);
+	DEBUG_ASSERT((it != entity_archetype_map_.end()), "Archetype was not found!");
+
+	M_DEBUG->WriteDebugMessage("Preparing to instantiate " + std::to_string(count) + " of archetype " + archetype_name + "\n");
+
+	Entity* archetype = it->second;
+	ComponentManager* comp_mgr = &*CORE->GetManager<ComponentManager>();
+
+	// Each pool and component map grows at most once for the whole batch, so
+	// the batch's components of a type fill a pool's free slots in order
+	for (Component* component : archetype->components_) {
+
+		component->GetPool()->Reserve(count);
+		comp_mgr->Reserve(component, count);
+	}
+
+	std::vector<Entity*> batch;
+	batch.reserve(count);
+
+	EntityIDRange ids{ last_entity_id_ + 1, last_entity_id_ + 1 };
+
+	for (size_t i = 0; i < count; ++i) {
+
+		batch.push_back(archetype->Clone());
+	}
+
+	ids.end_ = last_entity_id_ + 1;
+
+	for (Entity* entity : batch) {
+
+		entity->Init();
+	}
+
+	if (initializer) {
+
+		for (size_t i = 0; i < batch.size(); ++i) {
+
+			initializer(batch[i], i);
+		}
+	}
+
+	return ids;
+}
+
 void EntityManager::StoreEntityID(Entity* entity) {
 
 	entity->object_id_ = ++last_entity_id_;
@@ -90,6 +138,7 @@ Entity* EntityManager::GetPlayerEntities() const {
 
 void EntityManager::AddNewArchetype(std::string archetype_name, Entity* archetype) {
 	
+	archetype->archetype_id_ = NameTable::Intern(archetype_name);
 	entity_archetype_map_[archetype_name] = archetype;
 }
 
@@ -168,7 +217,7 @@ void EntityManager::UpdateArchetypeMap() {
   for (EntityIDSetDeleteIt begin = archetypes_to_delete_.begin(); begin != archetypes_to_delete_.end(); ++begin) {
 
 	  Entity* entity = *begin;
-	  std::shared_ptr<Name> name = std::dynamic_pointer_cast<Name>(entity->GetComponent(ComponentTypes::NAME));
+	  Name* name = entity->GetComponentType<Name>(ComponentTypes::NAME);
 	  EntityArchetypeMapTypeIt check_it = entity_archetype_map_.find(name->GetName());
 
 	  if (check_it != entity_archetype_map_.end()) {
@@ -206,15 +255,40 @@ void EntityManager::UpdateEntityMap() {
 // Private helper function to search for player entities
 void EntityManager::SortPlayerEntities() {
 	
-	ComponentManager* manager = &*CORE->GetManager<ComponentManager>();
-	CMap<Name>* name = manager->GetComponentArray<Name>();
+	const EntityIdMapType& players = GetNamedEntities(player_name_);
 
-	for (CMap<Name>::MapTypeIt it = name->begin(); it != name->end(); ++it) {
-		
-		if (it->second->GetEntityName() == "Player") {
+	if (!players.empty()) {
 
-			player_ptr_ = it->second->GetOwner();
-			break;
-		}
+		player_ptr_ = players.begin()->second;
+	}
+}
+
+void EntityManager::AddNamedEntity(NameID name, Entity* entity) {
+
+	if (name == NameTable::invalid_) {
+
+		return;
+	}
+
+	if (name >= named_entities_.size()) {
+
+		named_entities_.resize(name + 1);
 	}
+
+	named_entities_[name][entity->GetID()] = entity;
+}
+
+void EntityManager::RemoveNamedEntity(NameID name, Entity* entity) {
+
+	if (name < named_entities_.size()) {
+
+		named_entities_[name].erase(entity->GetID());
+	}
+}
+
+const EntityManager::EntityIdMapType& EntityManager::GetNamedEntities(NameID name) const {
+
+	static const EntityIdMapType none{};
+
+	return (name < named_entities_.size()) ? named_entities_[name] : none;
 }
\ No newline at end of file
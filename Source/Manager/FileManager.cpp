@@ -0,0 +1,78 @@
+/**********************************************************************************
+*\file         FileManager.cpp
+*\brief        Contains definition of functions and variables used for
+*			   the File Manager
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Manager/FileManager.h"
+#include "Engine/Core.h"
+#include "Systems/Debug.h"
+#include <fstream>
+
+void FileManager::Init() {
+
+	M_DEBUG->WriteDebugMessage("File Manager Init\n");
+}
+
+bool FileManager::ReadFile(const std::string& filename, std::vector<char>& buffer) {
+
+	std::ifstream file{ filename, std::ios::binary | std::ios::ate };
+
+	if (!file.is_open()) {
+
+		buffer.assign(1, '\0');
+		return false;
+	}
+
+	std::streamsize size = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	buffer.resize(static_cast<size_t>(size) + 1);
+	file.read(buffer.data(), size);
+	buffer[static_cast<size_t>(size)] = '\0';
+
+	return true;
+}
+
+const rapidjson::Document& FileManager::GetJSON(const std::string& filename) {
+
+	std::error_code error;
+	std::filesystem::file_time_type write_time = std::filesystem::last_write_time(filename, error);
+
+	auto it = json_files_.find(filename);
+
+	// Files edited since, e.g. by the editor, are read again
+	if (it != json_files_.end() && !error && it->second->write_time_ == write_time) {
+
+		return it->second->doc_;
+	}
+
+	std::unique_ptr<JSONFile> file = std::make_unique<JSONFile>();
+	file->write_time_ = write_time;
+
+	bool opened = ReadFile(filename, file->buffer_);
+	DEBUG_ASSERT(opened, "File does not exist");
+
+	file->doc_.ParseInsitu(file->buffer_.data());
+
+	std::unique_ptr<JSONFile>& kept = json_files_[filename];
+	kept = std::move(file);
+	return kept->doc_;
+}
+
+void FileManager::ClearJSON() {
+
+	json_files_.clear();
+}
+
+const rapidjson::Document& DeSerializeJSON(const std::string& filename) {
+
+	return CORE->GetManager<FileManager>()->GetJSON(filename);
+}
@@ -12,16 +12,23 @@
 
 
 #include "Manager/FontManager.h"
+#include "Manager/FileManager.h"
+#include "Manager/TextureAtlas.h"
 #include "Systems/Debug.h"
+#include <cstring>
 
 Character::Character(unsigned int textureID,
                      glm::ivec2 size,
                      glm::ivec2 bearing,
-                     unsigned int advance) :
+                     unsigned int advance,
+                     glm::vec2 uv_min,
+                     glm::vec2 uv_max) :
     textureID_ {textureID},
     size_ {size},
     bearing_ {bearing},
-    advance_ {advance}
+    advance_ {advance},
+    uv_min_ {uv_min},
+    uv_max_ {uv_max}
 {
 
 }
@@ -47,20 +54,43 @@ unsigned int Character::GetAdvance()
 }
 
 
-Font::Font(std::map<char, Character> characters) :
-    characters_{characters}
+glm::vec2 Character::GetUVMin()
 {
+    return uv_min_;
+}
+
+glm::vec2 Character::GetUVMax()
+{
+    return uv_max_;
+}
+
+
+Font::Font(std::vector<Character> characters, GLuint atlas_handle) :
+    characters_{characters},
+    atlas_handle_{atlas_handle}
+{
+
 
+}
 
+const Character& Font::GetCharacter(char c) const
+{
+    unsigned char code = static_cast<unsigned char>(c);
+    return characters_[code < glyph_count_ ? code : ' '];
 }
 
-std::map<char, Character>* Font::GetCharacters()
+GLuint Font::GetAtlasHandle() const
 {
-    return &characters_;
+    return atlas_handle_;
 }
 
 FontManager::~FontManager()
 {
+    for (auto it = fonts_.begin(); it != fonts_.end(); ++it) {
+
+        GLuint atlas_handle = it->second.GetAtlasHandle();
+        glDeleteTextures(1, &atlas_handle);
+    }
 
     FT_Done_FreeType(ft);
 }
@@ -76,15 +106,32 @@ void FontManager::Init() {
 
 Font* FontManager::GetFont(std::string name)
 {
-    return &(fonts_.find(name)->second);
+    auto it = fonts_.find(name);
+
+    return (it == fonts_.end()) ? nullptr : &it->second;
+}
+
+bool FontManager::UnloadFont(std::string font_name)
+{
+    auto it = fonts_.find(font_name);
+
+    if (it == fonts_.end()) {
+
+        return false;
+    }
+
+    GLuint atlas_handle = it->second.GetAtlasHandle();
+    glDeleteTextures(1, &atlas_handle);
+
+    fonts_.erase(it);
+    return true;
 }
 
 void FontManager::FontBatchLoad(std::string level_name)
 {
-    rapidjson::Document fonts_to_load;
     std::string path = "Resources/AssetsLoading/" + level_name + "_font.json";
 
-    DeSerializeJSON(path, fonts_to_load);
+    const rapidjson::Document& fonts_to_load = DeSerializeJSON(path);
 
     const rapidjson::Value& fonts_arr = fonts_to_load;
     DEBUG_ASSERT(fonts_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -121,9 +168,11 @@ void FontManager::LoadFont(std::string font_name)
         DEBUG_ASSERT(!(1), "Failed to load Glyph!");
     }
 
-    std::map<char, Character> temp;
+    // render every glyph once, they are packed into a single atlas afterwards
+    std::vector<Character> characters(Font::glyph_count_);
+    std::vector<std::vector<unsigned char>> bitmaps(Font::glyph_count_);
 
-    for (unsigned char c = 0; c < 128; c++) {
+    for (unsigned char c = 0; c < Font::glyph_count_; c++) {
 
         // load character glyph 
         if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
@@ -132,59 +181,104 @@ void FontManager::LoadFont(std::string font_name)
             continue;
         }
 
-        // generate texture
-        unsigned int texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_RED,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer
-        );
-
-        // set texture options
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        // now store character for later use
-        Character character = { texture,
-                                glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-                                glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
-                                static_cast<unsigned int>(face->glyph->advance.x)
-                              };
-
-        temp.insert(std::pair<char, Character>(c, character));
+        const FT_Bitmap& bitmap = face->glyph->bitmap;
+        bitmaps[c].resize(static_cast<size_t>(bitmap.width) * bitmap.rows);
+
+        for (unsigned int row = 0; row < bitmap.rows; ++row) {
+
+            std::memcpy(bitmaps[c].data() + static_cast<size_t>(row) * bitmap.width,
+                        bitmap.buffer + static_cast<size_t>(row) * bitmap.pitch, bitmap.width);
+        }
+
+        characters[c] = { 0,
+                          glm::ivec2(bitmap.width, bitmap.rows),
+                          glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
+                          static_cast<unsigned int>(face->glyph->advance.x),
+                          {}, {}
+                        };
     }
 
-    fonts_[font_name] = Font(temp);
     FT_Done_Face(face);
-}
 
-void FontManager::DeSerializeJSON(const std::string& filename, rapidjson::Document& doc) {
+    // grow the atlas until every glyph fits, glyphs are kept a pixel apart
+    const int glyph_padding = 1;
+    std::vector<glm::ivec2> origins(Font::glyph_count_);
+    SkylinePacker packer;
+    int atlas_size = 64;
+
+    auto pack = [&]() {
+
+        packer.Init(atlas_size, atlas_size);
+
+        for (size_t c = 0; c < Font::glyph_count_; ++c) {
+
+            glm::ivec2 size = characters[c].GetSize();
+
+            if (size.x == 0 || size.y == 0) {
+
+                continue;
+            }
+
+            if (!packer.Insert(size.x + glyph_padding, size.y + glyph_padding, origins[c].x, origins[c].y)) {
 
-    std::ifstream input_file(filename.c_str());
-    DEBUG_ASSERT(input_file.is_open(), "File does not exist");
+                return false;
+            }
+        }
 
-    // Read each line separated by a '\n' into a stringstream
-    std::stringstream json_doc_buffer;
-    std::string input;
+        return true;
+    };
 
-    while (std::getline(input_file, input)) {
+    while (!pack()) {
 
-        json_doc_buffer << input << "\n";
+        atlas_size *= 2;
     }
 
-    // Close the file (.json) after
-    input_file.close();
+    std::vector<unsigned char> pixels(static_cast<size_t>(atlas_size) * atlas_size, 0);
+
+    for (size_t c = 0; c < Font::glyph_count_; ++c) {
+
+        glm::ivec2 size = characters[c].GetSize();
+
+        for (int row = 0; row < size.y; ++row) {
+
+            std::memcpy(pixels.data() + static_cast<size_t>(origins[c].y + row) * atlas_size + origins[c].x,
+                        bitmaps[c].data() + static_cast<size_t>(row) * size.x, size.x);
+        }
+    }
+
+    // generate texture
+    GLuint atlas_handle;
+    glGenTextures(1, &atlas_handle);
+    glBindTexture(GL_TEXTURE_2D, atlas_handle);
+    glTexImage2D(
+        GL_TEXTURE_2D,
+        0,
+        GL_RED,
+        atlas_size,
+        atlas_size,
+        0,
+        GL_RED,
+        GL_UNSIGNED_BYTE,
+        pixels.data()
+    );
+
+    // set texture options
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // now store characters for later use, rows are top down in the atlas
+    for (size_t c = 0; c < Font::glyph_count_; ++c) {
+
+        Character& character = characters[c];
+        glm::vec2 origin = glm::vec2(origins[c]) / static_cast<float>(atlas_size);
+        glm::vec2 extent = glm::vec2(character.GetSize()) / static_cast<float>(atlas_size);
+
+        character = { atlas_handle, character.GetSize(), character.GetBearing(), character.GetAdvance(),
+                      origin, origin + extent };
+    }
+
+    fonts_[font_name] = Font(characters, atlas_handle);
+}
 
-    // Parse the stringstream into document (DOM) format
-    doc.Parse(json_doc_buffer.str().c_str());
-}
\ No newline at end of file
@@ -20,10 +20,9 @@
 #include <algorithm>
 #include <functional>
 
-void RemoveExpiredCollectibles(std::map<EntityID, ForcesManager::EntityForces>::iterator it) {
+void RemoveExpiredCollectibles(EntityID id) {
 	
 	ComponentManager* component_mgr = &*CORE->GetManager<ComponentManager>();
-	auto& [id, ptr] = *it;
 
 	Collectible* collectible = component_mgr->GetComponent<Collectible>(id);
 
@@ -45,25 +44,15 @@ void RemoveExpiredCollectibles(std::map<EntityID, ForcesManager::EntityForces>::
 	}
 }
 
-auto RemoveVecCheck = [](ForcesManager::ForceVecIt it) {
-	if (it->age_ >= it->lifespan_) {
-		return true;
-	}
-	return false;
-};
-
-auto RemoveEntryCheck = [](ForcesManager::ForceMapIt it) {
-	if (it->second.vec_.empty()) {
-		return true;
-	}
-	return false;
-};
+// Tolerance for the accumulated clock, so a force lasting n steps expires on
+// the nth step like the previous per-force age counter did
+constexpr double expiry_epsilon = 1e-7;
 
-bool ForcesManager::EntityForces::VerifyForce(const std::string& name) {
+bool ForcesManager::EntityForces::VerifyForce(const ForceID& id) {
 
 	for (ForceVecIt begin = vec_.begin(); begin != vec_.end(); ++begin) {
 		
-		if (begin->name_ == name) {
+		if (begin->id_ == id) {
 
 			return false;
 		}
@@ -72,71 +61,129 @@ bool ForcesManager::EntityForces::VerifyForce(const std::string& name) {
 	return true;
 }
 
-ForcesManager::Force::Force(const std::string& name, const float& lifespan, const Vector2D& force) :
-	name_{ name },
-	age_{ },
-	lifespan_{ lifespan },
+ForcesManager::Force::Force(const ForceID& id, const double& expiry, const Vector2D& force) :
+	id_{ id },
+	expiry_{ expiry },
 	force_{ force }
 {
 }
 
-void ForcesManager::AddForce(EntityID id, const std::string& name, const float& lifespan, const Vector2D& force) {
+ForcesManager::ForcesManager() :
+	clock_{}
+{
+}
+
+ForcesManager::ForceID ForcesManager::GetForceID(const std::string& name) {
+
+	auto it = force_ids_.find(name);
+
+	if (it != force_ids_.end())
+		return it->second;
+
+	ForceID id = static_cast<ForceID>(force_ids_.size());
+	force_ids_.emplace(name, id);
+	return id;
+}
+
+ForcesManager::ForceSlot ForcesManager::FindSlot(EntityID id) {
+
+	auto it = slot_map_.find(id);
+	return it != slot_map_.end() ? it->second : invalid_slot;
+}
+
+ForcesManager::ForceSlot ForcesManager::GetSlot(EntityID id) {
+
+	auto it = slot_map_.find(id);
+
+	if (it != slot_map_.end())
+		return it->second;
+
+	ForceSlot slot = accumulators_.size();
+	accumulators_.push_back({ id, {}, {} });
+	slot_map_.emplace(id, slot);
+
+	// Cache the slot so the integrator can read the sum directly
+	Motion* motion = CORE->GetManager<ComponentManager>()->GetComponent<Motion>(id);
+
+	if (motion)
+		motion->force_slot_ = slot;
+
+	return slot;
+}
+
+void ForcesManager::AddForce(EntityID id, const ForceID& force_id, const float& lifespan, const Vector2D& force) {
 	
-	//access vector
-	EntityForces* entity = &force_map_[id];
+	//access accumulator
+	ForceSlot slot = GetSlot(id);
+	EntityForces* entity = &accumulators_[slot];
 	
 	//ensure that force does not already exist
-	if (entity->VerifyForce(name)) {
+	if (entity->VerifyForce(force_id)) {
 		//create new entry
-		entity->vec_.push_back({ name, lifespan, force });
+		double expiry = clock_ + lifespan;
+		entity->vec_.push_back({ force_id, expiry, force });
+		expiry_heap_.push({ expiry, slot, force_id });
 	}
 }
 
+void ForcesManager::AddForce(EntityID id, const std::string& name, const float& lifespan, const Vector2D& force) {
+
+	AddForce(id, GetForceID(name), lifespan, force);
+}
+
 void ForcesManager::Init() {
 	// Empty body
 }
 
 void ForcesManager::Update(float frametime) {
-	for (ForceMapIt begin_map = force_map_.begin(); begin_map != force_map_.end();) {
-		// Reset forces for entity
+
+	clock_ += frametime;
+
+	// Recompute forces for every entity, forces expiring this step still apply
+	for (EntityForces& entity : accumulators_) {
+
 		Vector2D sum{};
 
-		for (ForceVecIt begin = begin_map->second.vec_.begin(); begin != begin_map->second.vec_.end();) {
+		for (const Force& force : entity.vec_) {
+
+			sum += force.force_;
+		}
 
-			begin->age_ += frametime;
+		entity.sum_of_forces_ = sum;
+	}
 
-			// Recompute forces for entity
-			sum += begin->force_;
+	// Remove all forces that have reached the end of their lifetime
+	while (!expiry_heap_.empty() && expiry_heap_.top().expiry_ <= clock_ + expiry_epsilon) {
 
-			if (RemoveVecCheck(begin)) {
+		ForceExpiry expired = expiry_heap_.top();
+		expiry_heap_.pop();
 
-				RemoveExpiredCollectibles(begin_map); // This might crash when removing expired moving Spores
-				begin = begin_map->second.vec_.erase(begin);
-				continue;
-			}
+		EntityForces& entity = accumulators_[expired.slot_];
 
-			++begin;
-		}
+		for (ForceVecIt begin = entity.vec_.begin(); begin != entity.vec_.end(); ++begin) {
 
-		begin_map->second.sum_of_forces_ = sum;
-		
-		/*if (RemoveEntryCheck(begin_map)) {
-			begin_map = force_map_.erase(begin_map);
-			continue;
-		}*/
+			if (begin->id_ == expired.id_) {
 
-		++begin_map;
+				entity.vec_.erase(begin);
+				break;
+			}
+		}
+
+		RemoveExpiredCollectibles(entity.owner_); // This might crash when removing expired moving Spores
 	}
 }
 
 Vector2D ForcesManager::GetForce(EntityID id) {
 
-	ForceMapIt it = force_map_.find(id);
+	ForceSlot slot = FindSlot(id);
+	return GetForce(slot, id);
+}
+
+Vector2D ForcesManager::GetForce(ForceSlot slot, EntityID id) const {
 
-	if (it != force_map_.end()) {
+	if (slot < accumulators_.size() && accumulators_[slot].owner_ == id) {
 
-		M_DEBUG->WriteDebugMessage("Force obtained: " + std::to_string(it->second.sum_of_forces_.x) + "\n");
-		return it->second.sum_of_forces_;
+		return accumulators_[slot].sum_of_forces_;
 	}
 
 	return Vector2D{};
@@ -144,5 +191,8 @@ Vector2D ForcesManager::GetForce(EntityID id) {
 
 void ForcesManager::Purge() {
 
-	force_map_.clear();
+	accumulators_.clear();
+	slot_map_.clear();
+	expiry_heap_ = {};
+	clock_ = 0.0;
 }
\ No newline at end of file
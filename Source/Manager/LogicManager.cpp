@@ -70,4 +70,14 @@ void LogicManager::Init() {
 
 	// For Dialogue triggers
 	RegisterLogic("TriggerDialogue", &DialogueTrigger_Script::TriggerDialogue);
+}
+
+LogicHandle LogicManager::GetHandle(const std::string& name) const {
+
+	auto it = handles_.find(name);
+
+	if (it != handles_.end())
+		return it->second;
+
+	return {};
 }
\ No newline at end of file
@@ -0,0 +1,169 @@
+/**********************************************************************************
+*\file         MappedFile.cpp
+*\brief        Contains definition of functions and variables used for
+*			   reading cooked files through memory mapping
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Manager/MappedFile.h"
+#include <windows.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	constexpr uint64_t fnv_offset = 14695981039346656037ull;
+	constexpr uint64_t fnv_prime = 1099511628211ull;
+}
+
+MappedFile::MappedFile() :
+	file_{ INVALID_HANDLE_VALUE },
+	mapping_{ nullptr },
+	view_{ nullptr },
+	size_{ 0 }
+{}
+
+bool MappedFile::Map(const std::string& path) {
+
+	Unmap();
+
+	file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+						OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (file_ == INVALID_HANDLE_VALUE) {
+
+		return false;
+	}
+
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) {
+
+		Unmap();
+		return false;
+	}
+
+	mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (!mapping_) {
+
+		Unmap();
+		return false;
+	}
+
+	view_ = static_cast<const unsigned char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+
+	if (!view_) {
+
+		Unmap();
+		return false;
+	}
+
+	size_ = static_cast<size_t>(size.QuadPart);
+	return true;
+}
+
+void MappedFile::Unmap() {
+
+	if (view_) {
+
+		UnmapViewOfFile(view_);
+	}
+
+	if (mapping_) {
+
+		CloseHandle(mapping_);
+	}
+
+	if (file_ != INVALID_HANDLE_VALUE) {
+
+		CloseHandle(file_);
+	}
+
+	file_ = INVALID_HANDLE_VALUE;
+	mapping_ = nullptr;
+	view_ = nullptr;
+	size_ = 0;
+}
+
+MappedFile::~MappedFile() {
+
+	Unmap();
+}
+
+uint64_t HashFileContents(const std::string& filename) {
+
+	std::ifstream file{ filename, std::ios::binary };
+
+	if (!file) {
+
+		return 0;
+	}
+
+	// FNV-1a, reading the file is far cheaper than decoding or parsing it
+	uint64_t hash = fnv_offset;
+	std::vector<char> buffer(1 << 16);
+
+	while (file) {
+
+		file.read(buffer.data(), buffer.size());
+		std::streamsize count = file.gcount();
+
+		for (std::streamsize i = 0; i < count; ++i) {
+
+			hash ^= static_cast<unsigned char>(buffer[i]);
+			hash *= fnv_prime;
+		}
+	}
+
+	return hash;
+}
+
+bool WriteFileAtomic(const std::string& path, std::initializer_list<FileBlock> blocks) {
+
+	// Named per thread, as the same file may be written from several
+	std::stringstream temp_path;
+	temp_path << path << "." << std::this_thread::get_id() << ".tmp";
+
+	std::error_code error;
+
+	{
+		std::ofstream file{ temp_path.str(), std::ios::binary | std::ios::trunc };
+
+		if (!file) {
+
+			return false;
+		}
+
+		for (const FileBlock& block : blocks) {
+
+			file.write(static_cast<const char*>(block.data_), block.size_);
+		}
+
+		if (!file) {
+
+			file.close();
+			std::filesystem::remove(temp_path.str(), error);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(temp_path.str(), path, error);
+
+	if (error) {
+
+		std::filesystem::remove(temp_path.str(), error);
+		return false;
+	}
+
+	return true;
+}
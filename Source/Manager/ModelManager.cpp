@@ -12,14 +12,19 @@
 
 
 #include "Manager/ModelManager.h"
+#include "Manager/FontManager.h"
 #include "Systems/Debug.h"
+#include "Systems/SpriteBatch.h"
+#include "Systems/UIBatch.h"
+#include "Systems/LightBatch.h"
+#include <cstddef>
 
 void ModelManager::Init() {
 
     M_DEBUG->WriteDebugMessage("Model Manager Init\n");
 }
 
-Model* ModelManager::AddTristripsBatchModel(int batch_size, std::string model_name)
+Model* ModelManager::AddTristripsBatchModel(int batch_size, int segments, std::string model_name)
 {
     GLuint vao_batch_;
     GLuint vbo_batch_;
@@ -52,63 +57,50 @@ Model* ModelManager::AddTristripsBatchModel(int batch_size, std::string model_na
         }
     }
 
+    // Static corner positions, followed by a ring of interleaved sprite vertices
+    size_t pos_bytes = sizeof(glm::vec2) * pos_vtx_sent.size();
+    size_t ring_bytes = sizeof(SpriteBatch::Vertex) * 4 * batch_size * segments;
+
     glCreateBuffers(1, &vbo_batch_);
 
-    //Render 500 objects at once
-    glNamedBufferStorage(vbo_batch_, (sizeof(glm::vec2) * 5 + sizeof(float)) * 4 * batch_size,
-        nullptr, GL_DYNAMIC_STORAGE_BIT);
+    glNamedBufferStorage(vbo_batch_, pos_bytes + ring_bytes, nullptr, GL_DYNAMIC_STORAGE_BIT);
 
-    glNamedBufferSubData(vbo_batch_, 0,
-        sizeof(glm::vec2) * pos_vtx_sent.size(),
-        pos_vtx_sent.data());
+    glNamedBufferSubData(vbo_batch_, 0, pos_bytes, pos_vtx_sent.data());
 
     glCreateVertexArrays(1, &vao_batch_);
 
-    size_t offset = 0;
-
     glEnableVertexArrayAttrib(vao_batch_, 0);
-    glVertexArrayVertexBuffer(vao_batch_, 0, vbo_batch_, offset, sizeof(glm::vec2));
+    glVertexArrayVertexBuffer(vao_batch_, 0, vbo_batch_, 0, sizeof(glm::vec2));
     glVertexArrayAttribFormat(vao_batch_, 0, 2, GL_FLOAT, GL_FALSE, 0);
     glVertexArrayAttribBinding(vao_batch_, 0, 0);
 
-    offset += sizeof(glm::vec2) * 4 * batch_size;
+    // Binding 1 is pointed at the segment being drawn before every draw
+    glVertexArrayVertexBuffer(vao_batch_, 1, vbo_batch_, pos_bytes, sizeof(SpriteBatch::Vertex));
 
+    //texture coordinates
     glEnableVertexArrayAttrib(vao_batch_, 1);
-    glVertexArrayVertexBuffer(vao_batch_, 1, vbo_batch_, offset, sizeof(glm::vec2));
-    glVertexArrayAttribFormat(vao_batch_, 1, 2, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribFormat(vao_batch_, 1, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Vertex, tex_vtx_));
     glVertexArrayAttribBinding(vao_batch_, 1, 1);
 
-    offset += sizeof(glm::vec2) * 4 * batch_size;
-
     //scaling
     glEnableVertexArrayAttrib(vao_batch_, 2);
-    glVertexArrayVertexBuffer(vao_batch_, 2, vbo_batch_, offset, sizeof(glm::vec2));
-    glVertexArrayAttribFormat(vao_batch_, 2, 2, GL_FLOAT, GL_FALSE, 0);
-    glVertexArrayAttribBinding(vao_batch_, 2, 2);
-
-    offset += sizeof(glm::vec2) * 4 * batch_size;
+    glVertexArrayAttribFormat(vao_batch_, 2, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Vertex, scaling_));
+    glVertexArrayAttribBinding(vao_batch_, 2, 1);
 
     //rotation
     glEnableVertexArrayAttrib(vao_batch_, 3);
-    glVertexArrayVertexBuffer(vao_batch_, 3, vbo_batch_, offset, sizeof(glm::vec2));
-    glVertexArrayAttribFormat(vao_batch_, 3, 2, GL_FLOAT, GL_FALSE, 0);
-    glVertexArrayAttribBinding(vao_batch_, 3, 3);
-
-    offset += sizeof(glm::vec2) * 4 * batch_size;
+    glVertexArrayAttribFormat(vao_batch_, 3, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Vertex, rotation_));
+    glVertexArrayAttribBinding(vao_batch_, 3, 1);
 
     //translation
     glEnableVertexArrayAttrib(vao_batch_, 4);
-    glVertexArrayVertexBuffer(vao_batch_, 4, vbo_batch_, offset, sizeof(glm::vec2));
-    glVertexArrayAttribFormat(vao_batch_, 4, 2, GL_FLOAT, GL_FALSE, 0);
-    glVertexArrayAttribBinding(vao_batch_, 4, 4);
-
-    offset += sizeof(glm::vec2) * 4 * batch_size;
+    glVertexArrayAttribFormat(vao_batch_, 4, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Vertex, position_));
+    glVertexArrayAttribBinding(vao_batch_, 4, 1);
 
     //texture id
     glEnableVertexArrayAttrib(vao_batch_, 5);
-    glVertexArrayVertexBuffer(vao_batch_, 5, vbo_batch_, offset, sizeof(float));
-    glVertexArrayAttribFormat(vao_batch_, 5, 1, GL_FLOAT, GL_FALSE, 0);
-    glVertexArrayAttribBinding(vao_batch_, 5, 5);
+    glVertexArrayAttribFormat(vao_batch_, 5, 1, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Vertex, texture_id_));
+    glVertexArrayAttribBinding(vao_batch_, 5, 1);
 
     glCreateBuffers(1, &ebo_batch_);
     glNamedBufferStorage(ebo_batch_,
@@ -122,7 +114,7 @@ Model* ModelManager::AddTristripsBatchModel(int batch_size, std::string model_na
     mdl.vaoid_ = vao_batch_;
     mdl.vboid_ = vbo_batch_;
 
-    //mdl.vbo_tex_offset_ = sizeof(glm::vec2) * pos_vtx.size(); NOT USED
+    mdl.vbo_tex_offset_ = pos_bytes;      // start of the sprite vertex ring
     mdl.primitive_type_ = GL_TRIANGLE_STRIP;
     mdl.draw_cnt_ = static_cast<GLint>(idx_vtx_sent.size());     // number of vertices
     //mdl.primitive_cnt_ = count;          NOT USED              // number of triangles
@@ -131,6 +123,243 @@ Model* ModelManager::AddTristripsBatchModel(int batch_size, std::string model_na
     return &models_[model_name];
 }
 
+Model* ModelManager::AddInstancedBatchModel(int batch_size, int segments, std::string model_name)
+{
+    GLuint vao_batch_;
+    GLuint vbo_batch_;
+
+    // Corners are generated from gl_VertexID, the buffer only holds the ring of instances
+    glCreateBuffers(1, &vbo_batch_);
+
+    glNamedBufferStorage(vbo_batch_, sizeof(SpriteBatch::Instance) * batch_size * segments,
+        nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    glCreateVertexArrays(1, &vao_batch_);
+
+    glVertexArrayVertexBuffer(vao_batch_, 0, vbo_batch_, 0, sizeof(SpriteBatch::Instance));
+    glVertexArrayBindingDivisor(vao_batch_, 0, 1);
+
+    //texture coordinates of corner 0 and 3
+    glEnableVertexArrayAttrib(vao_batch_, 1);
+    glVertexArrayAttribFormat(vao_batch_, 1, 4, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Instance, tex_rect_));
+    glVertexArrayAttribBinding(vao_batch_, 1, 0);
+
+    //scaling
+    glEnableVertexArrayAttrib(vao_batch_, 2);
+    glVertexArrayAttribFormat(vao_batch_, 2, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Instance, scaling_));
+    glVertexArrayAttribBinding(vao_batch_, 2, 0);
+
+    //rotation
+    glEnableVertexArrayAttrib(vao_batch_, 3);
+    glVertexArrayAttribFormat(vao_batch_, 3, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Instance, rotation_));
+    glVertexArrayAttribBinding(vao_batch_, 3, 0);
+
+    //translation
+    glEnableVertexArrayAttrib(vao_batch_, 4);
+    glVertexArrayAttribFormat(vao_batch_, 4, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Instance, position_));
+    glVertexArrayAttribBinding(vao_batch_, 4, 0);
+
+    //texture id
+    glEnableVertexArrayAttrib(vao_batch_, 5);
+    glVertexArrayAttribFormat(vao_batch_, 5, 1, GL_FLOAT, GL_FALSE, offsetof(SpriteBatch::Instance, texture_id_));
+    glVertexArrayAttribBinding(vao_batch_, 5, 0);
+
+    glBindVertexArray(0);
+
+    Model mdl;
+    mdl.vaoid_ = vao_batch_;
+    mdl.vboid_ = vbo_batch_;
+
+    mdl.vbo_tex_offset_ = 0;
+    mdl.primitive_type_ = GL_TRIANGLE_STRIP;
+    mdl.draw_cnt_ = 4;                    // vertices per instance
+    models_[model_name] = mdl;
+
+    return &models_[model_name];
+}
+
+Model* ModelManager::AddInstancedLightModel(int max_lights, int segments, std::string model_name)
+{
+    GLuint vao_batch_;
+    GLuint vbo_batch_;
+
+    // Corners are generated from gl_VertexID, the buffer only holds the light instances
+    glCreateBuffers(1, &vbo_batch_);
+
+    glNamedBufferStorage(vbo_batch_, sizeof(LightBatch::Instance) * max_lights * segments,
+        nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    glCreateVertexArrays(1, &vao_batch_);
+
+    glVertexArrayVertexBuffer(vao_batch_, 0, vbo_batch_, 0, sizeof(LightBatch::Instance));
+    glVertexArrayBindingDivisor(vao_batch_, 0, 1);
+
+    //center
+    glEnableVertexArrayAttrib(vao_batch_, 0);
+    glVertexArrayAttribFormat(vao_batch_, 0, 2, GL_FLOAT, GL_FALSE, offsetof(LightBatch::Instance, center_));
+    glVertexArrayAttribBinding(vao_batch_, 0, 0);
+
+    //direction
+    glEnableVertexArrayAttrib(vao_batch_, 1);
+    glVertexArrayAttribFormat(vao_batch_, 1, 2, GL_FLOAT, GL_FALSE, offsetof(LightBatch::Instance, direction_));
+    glVertexArrayAttribBinding(vao_batch_, 1, 0);
+
+    //color
+    glEnableVertexArrayAttrib(vao_batch_, 2);
+    glVertexArrayAttribFormat(vao_batch_, 2, 3, GL_FLOAT, GL_FALSE, offsetof(LightBatch::Instance, color_));
+    glVertexArrayAttribBinding(vao_batch_, 2, 0);
+
+    //intensity
+    glEnableVertexArrayAttrib(vao_batch_, 3);
+    glVertexArrayAttribFormat(vao_batch_, 3, 1, GL_FLOAT, GL_FALSE, offsetof(LightBatch::Instance, intensity_));
+    glVertexArrayAttribBinding(vao_batch_, 3, 0);
+
+    //radius
+    glEnableVertexArrayAttrib(vao_batch_, 4);
+    glVertexArrayAttribFormat(vao_batch_, 4, 1, GL_FLOAT, GL_FALSE, offsetof(LightBatch::Instance, radius_));
+    glVertexArrayAttribBinding(vao_batch_, 4, 0);
+
+    //angle
+    glEnableVertexArrayAttrib(vao_batch_, 5);
+    glVertexArrayAttribFormat(vao_batch_, 5, 1, GL_FLOAT, GL_FALSE, offsetof(LightBatch::Instance, angle_));
+    glVertexArrayAttribBinding(vao_batch_, 5, 0);
+
+    glBindVertexArray(0);
+
+    Model mdl;
+    mdl.vaoid_ = vao_batch_;
+    mdl.vboid_ = vbo_batch_;
+
+    mdl.vbo_tex_offset_ = 0;
+    mdl.primitive_type_ = GL_TRIANGLE_STRIP;
+    mdl.draw_cnt_ = 4;                    // vertices per instance
+    models_[model_name] = mdl;
+
+    return &models_[model_name];
+}
+
+Model* ModelManager::AddTextBatchModel(int max_glyphs, std::string model_name)
+{
+    GLuint vao_batch_;
+    GLuint vbo_batch_;
+    GLuint ebo_batch_;
+
+    // Two triangles per glyph quad, corners are top left, top right, bottom left, bottom right
+    std::vector<GLushort> idx_vtx;
+
+    for (int i = 0; i < max_glyphs; ++i) {
+
+        idx_vtx.push_back(static_cast<GLushort>(0 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(2 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(1 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(1 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(2 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(3 + 4 * i));
+    }
+
+    glCreateBuffers(1, &vbo_batch_);
+    glNamedBufferStorage(vbo_batch_, sizeof(GlyphVertex) * 4 * max_glyphs, nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    glCreateVertexArrays(1, &vao_batch_);
+    glVertexArrayVertexBuffer(vao_batch_, 0, vbo_batch_, 0, sizeof(GlyphVertex));
+
+    //position
+    glEnableVertexArrayAttrib(vao_batch_, 0);
+    glVertexArrayAttribFormat(vao_batch_, 0, 2, GL_FLOAT, GL_FALSE, offsetof(GlyphVertex, position_));
+    glVertexArrayAttribBinding(vao_batch_, 0, 0);
+
+    //texture coordinates
+    glEnableVertexArrayAttrib(vao_batch_, 1);
+    glVertexArrayAttribFormat(vao_batch_, 1, 2, GL_FLOAT, GL_FALSE, offsetof(GlyphVertex, tex_coord_));
+    glVertexArrayAttribBinding(vao_batch_, 1, 0);
+
+    //color
+    glEnableVertexArrayAttrib(vao_batch_, 2);
+    glVertexArrayAttribFormat(vao_batch_, 2, 3, GL_FLOAT, GL_FALSE, offsetof(GlyphVertex, color_));
+    glVertexArrayAttribBinding(vao_batch_, 2, 0);
+
+    glCreateBuffers(1, &ebo_batch_);
+    glNamedBufferStorage(ebo_batch_,
+        sizeof(GLushort) * idx_vtx.size(),
+        idx_vtx.data(),
+        GL_DYNAMIC_STORAGE_BIT);
+    glVertexArrayElementBuffer(vao_batch_, ebo_batch_);
+    glBindVertexArray(0);
+
+    Model mdl;
+    mdl.vaoid_ = vao_batch_;
+    mdl.vboid_ = vbo_batch_;
+
+    mdl.vbo_tex_offset_ = 0;
+    mdl.primitive_type_ = GL_TRIANGLES;
+    mdl.draw_cnt_ = static_cast<GLuint>(idx_vtx.size());       // number of indices when full
+    mdl.primitive_cnt_ = static_cast<GLuint>(max_glyphs * 2);  // number of triangles
+    models_[model_name] = mdl;
+
+    return &models_[model_name];
+}
+
+Model* ModelManager::AddUIBatchModel(int max_quads, int bands, std::string model_name)
+{
+    GLuint vao_batch_;
+    GLuint vbo_batch_;
+    GLuint ebo_batch_;
+
+    // Two triangles per quad, corners are bottom left, bottom right, top left, top right
+    std::vector<GLushort> idx_vtx;
+
+    for (int i = 0; i < max_quads; ++i) {
+
+        idx_vtx.push_back(static_cast<GLushort>(0 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(2 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(1 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(1 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(2 + 4 * i));
+        idx_vtx.push_back(static_cast<GLushort>(3 + 4 * i));
+    }
+
+    glCreateBuffers(1, &vbo_batch_);
+    glNamedBufferStorage(vbo_batch_, sizeof(UIBatch::Vertex) * 4 * max_quads * bands, nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    glCreateVertexArrays(1, &vao_batch_);
+    glVertexArrayVertexBuffer(vao_batch_, 0, vbo_batch_, 0, sizeof(UIBatch::Vertex));
+
+    //position
+    glEnableVertexArrayAttrib(vao_batch_, 0);
+    glVertexArrayAttribFormat(vao_batch_, 0, 2, GL_FLOAT, GL_FALSE, offsetof(UIBatch::Vertex, position_));
+    glVertexArrayAttribBinding(vao_batch_, 0, 0);
+
+    //texture coordinates
+    glEnableVertexArrayAttrib(vao_batch_, 1);
+    glVertexArrayAttribFormat(vao_batch_, 1, 2, GL_FLOAT, GL_FALSE, offsetof(UIBatch::Vertex, tex_coord_));
+    glVertexArrayAttribBinding(vao_batch_, 1, 0);
+
+    //texture id
+    glEnableVertexArrayAttrib(vao_batch_, 2);
+    glVertexArrayAttribFormat(vao_batch_, 2, 1, GL_FLOAT, GL_FALSE, offsetof(UIBatch::Vertex, texture_id_));
+    glVertexArrayAttribBinding(vao_batch_, 2, 0);
+
+    glCreateBuffers(1, &ebo_batch_);
+    glNamedBufferStorage(ebo_batch_,
+        sizeof(GLushort) * idx_vtx.size(),
+        idx_vtx.data(),
+        GL_DYNAMIC_STORAGE_BIT);
+    glVertexArrayElementBuffer(vao_batch_, ebo_batch_);
+    glBindVertexArray(0);
+
+    Model mdl;
+    mdl.vaoid_ = vao_batch_;
+    mdl.vboid_ = vbo_batch_;
+
+    mdl.vbo_tex_offset_ = 0;
+    mdl.primitive_type_ = GL_TRIANGLES;
+    mdl.draw_cnt_ = static_cast<GLuint>(idx_vtx.size());      // number of indices when a band is full
+    mdl.primitive_cnt_ = static_cast<GLuint>(max_quads * 2);  // number of triangles in a band
+    models_[model_name] = mdl;
+
+    return &models_[model_name];
+}
+
 Model* ModelManager::AddTristripsModel(int slices, int stacks, std::string model_name) {
 
     // Generates the vertices required to render triangle strips
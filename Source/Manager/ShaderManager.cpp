@@ -136,6 +136,45 @@ void Shader::Link() {
     DEBUG_ASSERT(!(lnk_status == GL_FALSE), "Failed to link shader program!");
 
     is_linked = GL_TRUE;
+
+    ReflectUniforms();
+}
+
+void Shader::ReflectUniforms() {
+
+    uniforms_.clear();
+
+    GLint max_length, num_uniforms;
+    glGetProgramiv(pgm_handle, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+    glGetProgramiv(pgm_handle, GL_ACTIVE_UNIFORMS, &num_uniforms);
+
+    std::vector<GLchar> pname(max_length);
+
+    for (GLint i = 0; i < num_uniforms; ++i) {
+
+        GLsizei written;
+        GLint size;
+        GLenum type;
+        glGetActiveUniform(pgm_handle, i, max_length, &written, &size, &type, pname.data());
+
+        // members of uniform blocks have no location of their own
+        GLint loc = glGetUniformLocation(pgm_handle, pname.data());
+
+        if (loc < 0) {
+
+            continue;
+        }
+
+        std::string name(pname.data(), written);
+
+        // arrays are reported as their first element
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0) {
+
+            name.erase(name.size() - 3);
+        }
+
+        uniforms_[name] = loc;
+    }
 }
 
 void Shader::Use() {
@@ -170,84 +209,138 @@ GLboolean Shader::IsLinked() const {
     return is_linked;
 }
 
-void Shader::SetUniform(GLchar const *name, GLboolean val) {
+UniformHandle Shader::GetUniform(GLchar const* name) const {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
+    std::unordered_map<std::string, GLint>::const_iterator it = uniforms_.find(name);
 
-    glUniform1i(loc, val);
+    return UniformHandle{ it != uniforms_.end() ? it->second : -1 };
 }
 
-void Shader::SetUniform(GLchar const *name, GLint val) {
+void Shader::SetUniform(GLchar const *name, GLboolean val) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
+    SetUniform(GetUniform(name), val);
+}
 
-    glUniform1i(loc, val);
+void Shader::SetUniform(GLchar const *name, GLint val) {
 
+    SetUniform(GetUniform(name), val);
 }
 
 void Shader::SetUniform(GLchar const *name, GLfloat val) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT(loc >= 0, "Uniform variable name does not exist!");
-    glUniform1f(loc, val);
+    SetUniform(GetUniform(name), val);
 }
 
 void Shader::SetUniform(GLchar const *name, GLfloat x, GLfloat y) {
-  
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT(loc >= 0, "Uniform variable name does not exist!");
-    glUniform2f(loc, x, y);
+
+    SetUniform(GetUniform(name), x, y);
 }
 
 void Shader::SetUniform(GLchar const *name, GLfloat x, GLfloat y, GLfloat z) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
-    glUniform3f(loc, x, y, z);
+    SetUniform(GetUniform(name), x, y, z);
 }
 
 void Shader::SetUniform(GLchar const *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
-    glUniform4f(loc, x, y, z, w);
+    SetUniform(GetUniform(name), x, y, z, w);
 }
 
 void Shader::SetUniform(GLchar const *name, glm::vec2 val) {
-    
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!"); 
-    glUniform2f(loc, val.x, val.y);
+
+    SetUniform(GetUniform(name), val);
 }
 
 void Shader::SetUniform(GLchar const *name, glm::vec3 val) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
-    glUniform3f(loc, val.x, val.y, val.z);
+    SetUniform(GetUniform(name), val);
 }
 
 void Shader::SetUniform(GLchar const *name, glm::vec4 val) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
-    glUniform4f(loc, val.x, val.y, val.z, val.w);
+    SetUniform(GetUniform(name), val);
 }
 
 void Shader::SetUniform(GLchar const *name, glm::mat3 &val) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
-    glUniformMatrix3fv(loc, 1, GL_FALSE, &val[0][0]);
+    SetUniform(GetUniform(name), val);
 }
 
 void Shader::SetUniform(GLchar const *name, glm::mat4 &val) {
 
-    GLint loc = glGetUniformLocation(pgm_handle, name);
-    DEBUG_ASSERT((loc >= 0), "Uniform variable name does not exist!");
-    glUniformMatrix4fv(loc, 1, GL_FALSE, &val[0][0]);
+    SetUniform(GetUniform(name), val);
+}
+
+void Shader::SetUniform(UniformHandle handle, GLboolean val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform1i(handle.location_, val);
+}
+
+void Shader::SetUniform(UniformHandle handle, GLint val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform1i(handle.location_, val);
+}
+
+void Shader::SetUniform(UniformHandle handle, GLfloat val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform1f(handle.location_, val);
+}
+
+void Shader::SetUniform(UniformHandle handle, GLfloat x, GLfloat y) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform2f(handle.location_, x, y);
+}
+
+void Shader::SetUniform(UniformHandle handle, GLfloat x, GLfloat y, GLfloat z) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform3f(handle.location_, x, y, z);
+}
+
+void Shader::SetUniform(UniformHandle handle, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform4f(handle.location_, x, y, z, w);
+}
+
+void Shader::SetUniform(UniformHandle handle, glm::vec2 val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform2f(handle.location_, val.x, val.y);
+}
+
+void Shader::SetUniform(UniformHandle handle, glm::vec3 val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform3f(handle.location_, val.x, val.y, val.z);
+}
+
+void Shader::SetUniform(UniformHandle handle, glm::vec4 val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform4f(handle.location_, val.x, val.y, val.z, val.w);
+}
+
+void Shader::SetUniform(UniformHandle handle, glm::mat3 &val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniformMatrix3fv(handle.location_, 1, GL_FALSE, &val[0][0]);
+}
+
+void Shader::SetUniform(UniformHandle handle, glm::mat4 &val) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniformMatrix4fv(handle.location_, 1, GL_FALSE, &val[0][0]);
+}
+
+void Shader::SetUniform(UniformHandle handle, GLint const* vals, GLsizei count) {
+
+    DEBUG_ASSERT((handle.location_ >= 0), "Uniform variable name does not exist!");
+    glUniform1iv(handle.location_, count, vals);
 }
 
 void Shader::PrintActiveAttribs() const {
@@ -326,6 +419,44 @@ Shader* ShaderManager::AddShdrpgm(std::string vtx_shdr, std::string frg_shdr, st
     return &shaders_[shader_type];
 }
 
+void ShaderManager::UploadFrameUniforms() {
+
+    if (frame_block_ == 0) {
+
+        glCreateBuffers(1, &frame_block_);
+        glNamedBufferStorage(frame_block_, sizeof(FrameUniforms), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        glBindBufferBase(GL_UNIFORM_BUFFER, frame_block_binding_, frame_block_);
+    }
+
+    glNamedBufferSubData(frame_block_, 0, sizeof(FrameUniforms), &frame_uniforms_);
+}
+
+void ShaderManager::SetScreenUniforms(const glm::mat4& projection, const glm::vec2& win_size) {
+
+    frame_uniforms_.projection_ = projection;
+    frame_uniforms_.win_size_ = win_size;
+
+    UploadFrameUniforms();
+}
+
+void ShaderManager::SetCameraUniforms(const glm::mat3& world_to_ndc_xform) {
+
+    for (int i = 0; i < 3; ++i) {
+
+        frame_uniforms_.world_to_ndc_xform_[i] = glm::vec4{ world_to_ndc_xform[i], 0.0f };
+    }
+
+    UploadFrameUniforms();
+}
+
+ShaderManager::~ShaderManager() {
+
+    if (frame_block_ != 0) {
+
+        glDeleteBuffers(1, &frame_block_);
+    }
+}
+
 Shader* ShaderManager::GetShdrpgm(std::string shader_name) {
 
     return &shaders_[shader_name];
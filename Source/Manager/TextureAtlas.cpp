@@ -0,0 +1,272 @@
+/**********************************************************************************
+*\file         TextureAtlas.cpp
+*\brief        Contains definition of functions and variables used for
+*			   packing images into texture atlases
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Manager/TextureAtlas.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace {
+
+	constexpr int bytes_per_pixel = 4;
+}
+
+void SkylinePacker::Init(int width, int height) {
+
+	width_ = width;
+	height_ = height;
+	used_height_ = 0;
+
+	skyline_.clear();
+	skyline_.push_back({ 0, 0, width });
+}
+
+int SkylinePacker::Fit(size_t index, int width, int height) const {
+
+	int x = skyline_[index].x_;
+
+	if (x + width > width_) {
+
+		return -1;
+	}
+
+	int y = 0;
+	int remaining = width;
+
+	// The rectangle rests on the highest segment it spans
+	for (size_t i = index; remaining > 0; ++i) {
+
+		y = (std::max)(y, skyline_[i].y_);
+
+		if (y + height > height_) {
+
+			return -1;
+		}
+
+		remaining -= skyline_[i].width_;
+	}
+
+	return y;
+}
+
+bool SkylinePacker::Insert(int width, int height, int& x, int& y) {
+
+	size_t best = skyline_.size();
+	int best_y = height_;
+	int best_width = width_ + 1;
+
+	for (size_t i = 0; i < skyline_.size(); ++i) {
+
+		int fit_y = Fit(i, width, height);
+
+		if (fit_y < 0) {
+
+			continue;
+		}
+
+		// Lowest placement first, narrowest segment to break ties
+		if (fit_y < best_y || (fit_y == best_y && skyline_[i].width_ < best_width)) {
+
+			best = i;
+			best_y = fit_y;
+			best_width = skyline_[i].width_;
+		}
+	}
+
+	if (best == skyline_.size()) {
+
+		return false;
+	}
+
+	x = skyline_[best].x_;
+	y = best_y;
+
+	// Raise the skyline over the rectangle and trim the segments it covers
+	skyline_.insert(skyline_.begin() + best, { x, y + height, width });
+
+	for (size_t i = best + 1; i < skyline_.size(); ) {
+
+		Segment& previous = skyline_[i - 1];
+		Segment& segment = skyline_[i];
+		int overlap = previous.x_ + previous.width_ - segment.x_;
+
+		if (overlap <= 0) {
+
+			break;
+		}
+
+		segment.x_ += overlap;
+		segment.width_ -= overlap;
+
+		if (segment.width_ > 0) {
+
+			break;
+		}
+
+		skyline_.erase(skyline_.begin() + i);
+	}
+
+	// Merge neighbours at the same height
+	for (size_t i = 0; i + 1 < skyline_.size(); ) {
+
+		if (skyline_[i].y_ == skyline_[i + 1].y_) {
+
+			skyline_[i].width_ += skyline_[i + 1].width_;
+			skyline_.erase(skyline_.begin() + i + 1);
+		}
+
+		else {
+
+			++i;
+		}
+	}
+
+	used_height_ = (std::max)(used_height_, y + height);
+	return true;
+}
+
+size_t TextureAtlas::Add(Image image) {
+
+	images_.push_back(std::move(image));
+	return images_.size() - 1;
+}
+
+void TextureAtlas::Pack(int page_size, int padding) {
+
+	padding_ = padding;
+	pages_.clear();
+	placements_.assign(images_.size(), { -1, 0, 0 });
+
+	std::vector<size_t> order(images_.size());
+	std::iota(order.begin(), order.end(), 0);
+
+	std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) {
+		return images_[lhs].height_ > images_[rhs].height_;
+	});
+
+	std::vector<SkylinePacker> packers;
+
+	for (size_t index : order) {
+
+		const Image& image = images_[index];
+		int width = image.width_ + padding_ * 2;
+		int height = image.height_ + padding_ * 2;
+
+		if (width > page_size || height > page_size) {
+
+			continue;
+		}
+
+		Placement& placement = placements_[index];
+
+		for (size_t page = 0; page < packers.size() && placement.page_ < 0; ++page) {
+
+			if (packers[page].Insert(width, height, placement.x_, placement.y_)) {
+
+				placement.page_ = static_cast<int>(page);
+			}
+		}
+
+		if (placement.page_ < 0) {
+
+			packers.emplace_back();
+			packers.back().Init(page_size, page_size);
+			packers.back().Insert(width, height, placement.x_, placement.y_);
+			placement.page_ = static_cast<int>(packers.size() - 1);
+		}
+
+		placement.x_ += padding_;
+		placement.y_ += padding_;
+	}
+
+	for (SkylinePacker& packer : packers) {
+
+		Page page{ page_size, packer.GetUsedHeight(), {} };
+		page.pixels_.assign(static_cast<size_t>(page.width_) * page.height_ * bytes_per_pixel, 0);
+		pages_.push_back(std::move(page));
+	}
+
+	for (size_t index = 0; index < images_.size(); ++index) {
+
+		if (placements_[index].page_ >= 0) {
+
+			Blit(index);
+		}
+	}
+}
+
+void TextureAtlas::Blit(size_t index) {
+
+	const Image& image = images_[index];
+	const Placement& placement = placements_[index];
+	Page& page = pages_[placement.page_];
+
+	const size_t page_pitch = static_cast<size_t>(page.width_) * bytes_per_pixel;
+	const size_t image_pitch = static_cast<size_t>(image.width_) * bytes_per_pixel;
+
+	// Rows of the padding repeat the image's first and last rows
+	for (int row = -padding_; row < image.height_ + padding_; ++row) {
+
+		int source_row = (std::min)((std::max)(row, 0), image.height_ - 1);
+		const unsigned char* source = image.pixels_.data() + source_row * image_pitch;
+		unsigned char* destination = page.pixels_.data() + (placement.y_ + row) * page_pitch +
+									 static_cast<size_t>(placement.x_) * bytes_per_pixel;
+
+		std::memcpy(destination, source, image_pitch);
+
+		// Columns of the padding repeat the row's first and last pixels
+		for (int column = 1; column <= padding_; ++column) {
+
+			std::memcpy(destination - column * bytes_per_pixel, source, bytes_per_pixel);
+			std::memcpy(destination + image_pitch + (column - 1) * bytes_per_pixel,
+						source + image_pitch - bytes_per_pixel, bytes_per_pixel);
+		}
+	}
+}
+
+void TextureAtlas::Clear() {
+
+	images_.clear();
+	placements_.clear();
+	pages_.clear();
+}
+
+glm::vec2 TextureAtlas::ToAtlasUV(size_t index, const glm::vec2& uv) const {
+
+	const Placement& placement = placements_[index];
+
+	if (placement.page_ < 0) {
+
+		return uv;
+	}
+
+	const Page& page = pages_[placement.page_];
+
+	return { (placement.x_ + uv.x * images_[index].width_) / page.width_,
+			 (placement.y_ + uv.y * images_[index].height_) / page.height_ };
+}
+
+glm::vec2 TextureAtlas::ToAtlasScale(size_t index) const {
+
+	const Placement& placement = placements_[index];
+
+	if (placement.page_ < 0) {
+
+		return { 1.0f, 1.0f };
+	}
+
+	const Page& page = pages_[placement.page_];
+
+	return { static_cast<float>(images_[index].width_) / page.width_,
+			 static_cast<float>(images_[index].height_) / page.height_ };
+}
@@ -0,0 +1,89 @@
+/**********************************************************************************
+*\file         TextureCache.cpp
+*\brief        Contains definition of functions and variables used for
+*			   caching decoded images as cooked texture files
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Manager/TextureCache.h"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+	constexpr char cooked_magic[4] = { 'P', 'B', 'T', 'X' };
+}
+
+void TextureCache::Init(const std::string& directory) {
+
+	directory_ = directory;
+
+	std::error_code error;
+	std::filesystem::create_directories(directory_, error);
+}
+
+std::string TextureCache::GetCookedPath(uint64_t hash) const {
+
+	std::stringstream path;
+	path << directory_ << "/" << std::hex << hash << ".tex";
+	return path.str();
+}
+
+bool TextureCache::Load(uint64_t hash, CookedTexture& cooked) const {
+
+	if (hash == 0 || !cooked.Map(GetCookedPath(hash))) {
+
+		return false;
+	}
+
+	if (cooked.GetSize() < sizeof(CookedTexture::Header)) {
+
+		cooked.Unmap();
+		return false;
+	}
+
+	const CookedTexture::Header& header = cooked.GetHeader();
+	size_t pixel_bytes = static_cast<size_t>(header.width_) * header.height_ * 4;
+
+	// A cook interrupted halfway or by an older version is decoded again
+	if (std::memcmp(header.magic_, cooked_magic, sizeof(cooked_magic)) != 0 ||
+		header.version_ != version_ || header.source_hash_ != hash ||
+		cooked.GetSize() != sizeof(CookedTexture::Header) + pixel_bytes) {
+
+		cooked.Unmap();
+		return false;
+	}
+
+	return true;
+}
+
+void TextureCache::Cook(uint64_t hash, const TextureAtlas::Image& image) const {
+
+	if (hash == 0 || directory_.empty()) {
+
+		return;
+	}
+
+	CookedTexture::Header header{};
+	std::memcpy(header.magic_, cooked_magic, sizeof(cooked_magic));
+	header.version_ = version_;
+	header.width_ = static_cast<uint32_t>(image.width_);
+	header.height_ = static_cast<uint32_t>(image.height_);
+	header.source_hash_ = hash;
+
+	std::string path = GetCookedPath(hash);
+
+	if (!WriteFileAtomic(path, { { &header, sizeof(header) },
+								 { image.pixels_.data(), image.pixels_.size() } })) {
+
+		std::cout << "Failed to cook texture : " << path << std::endl;
+	}
+}
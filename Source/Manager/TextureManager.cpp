@@ -12,9 +12,16 @@
 
 
 #include "Manager/TextureManager.h"
+#include "Manager/FileManager.h"
 #include "Systems/Debug.h"
 #include <FreeImage.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <thread>
 
 Texture::Texture(size_t width, size_t height, GLuint tileset_handle, std::vector<glm::vec2> tex_vtx) :
     width_ {width},
@@ -71,15 +78,18 @@ void TextureManager::Init() {
     FreeImage_Initialise();
     std::cout << "FreeImage Version " << FreeImage_GetVersion() << std::endl;
 
+    atlas_open_ = false;
+    atlas_pending_ = false;
+    texture_cache_.Init("Cache/Textures");
+
     M_DEBUG->WriteDebugMessage("Texture Manager Init\n");
 }
 
 void TextureManager::TextureBatchLoad(std::string level_name) {
 
-    rapidjson::Document textures_to_load;
     std::string path = "Resources/AssetsLoading/" + level_name + "_texture.json";
 
-    DeSerializeJSON(path, textures_to_load);
+    const rapidjson::Document& textures_to_load = DeSerializeJSON(path);
 
     const rapidjson::Value& files_arr = textures_to_load;
     DEBUG_ASSERT(files_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -100,27 +110,6 @@ void TextureManager::TextureBatchLoad(std::string level_name) {
     }
 }
 
-void TextureManager::DeSerializeJSON(const std::string& filename, rapidjson::Document& doc) {
-
-    std::ifstream input_file(filename.c_str());
-    DEBUG_ASSERT(input_file.is_open(), "File does not exist");
-
-    // Read each line separated by a '\n' into a stringstream
-    std::stringstream json_doc_buffer;
-    std::string input;
-
-    while (std::getline(input_file, input)) {
-
-        json_doc_buffer << input << "\n";
-    }
-
-    // Close the file (.json) after
-    input_file.close();
-
-    // Parse the stringstream into document (DOM) format
-    doc.Parse(json_doc_buffer.str().c_str());
-}
-
 void TextureManager::CreateQuadTexture(std::string texture_name, unsigned char red,
                                        unsigned char green, unsigned char blue, unsigned char alpha) {
 
@@ -154,7 +143,7 @@ void TextureManager::LoadMiscTextures() {
     //CreateQuadTexture("WhiteQuad", 255, 255, 255, 255);
 }
 
-std::vector<GLuint> TextureManager::LoadImageFile(const char* filename) {
+TextureAtlas::Image TextureManager::DecodeImageFile(const char* filename) {
 
     std::cout << "Tileset is being loaded : " << filename << std::endl;
 
@@ -162,8 +151,6 @@ std::vector<GLuint> TextureManager::LoadImageFile(const char* filename) {
     FREE_IMAGE_FORMAT fif = FIF_UNKNOWN;
     //pointer to the image, once loaded
     FIBITMAP* dib(0);
-    //OpenGL's image ID to map to
-    GLuint texobj_hdl;
 
     //check the file signature and deduce its format
     fif = FreeImage_GetFileType(filename, 0);
@@ -182,9 +169,11 @@ std::vector<GLuint> TextureManager::LoadImageFile(const char* filename) {
         dib = FreeImage_Load(fif, filename, PNG_DEFAULT);
 
         //convert all images to 32 bits for reading
-        if (FreeImage_GetBPP(dib) != 32) {
+        if (dib && FreeImage_GetBPP(dib) != 32) {
 
-            dib = FreeImage_ConvertTo32Bits(FreeImage_Load(fif, filename, PNG_DEFAULT));
+            FIBITMAP* converted = FreeImage_ConvertTo32Bits(dib);
+            FreeImage_Unload(dib);
+            dib = converted;
         }
     }
 
@@ -196,10 +185,49 @@ std::vector<GLuint> TextureManager::LoadImageFile(const char* filename) {
     //get the image width and height
     unsigned int width = FreeImage_GetWidth(dib);
     unsigned int height = FreeImage_GetHeight(dib);
+    unsigned int pitch = FreeImage_GetPitch(dib);
 
     DEBUG_ASSERT(!(bits == 0) || (width == 0) || (height == 0),
         (std::string{ "Bits and/or Width and/or Height of image file is zero : " } += filename).c_str());
 
+    //copy the rows out of FreeImage's copy, which may be padded
+    TextureAtlas::Image image{ static_cast<int>(width), static_cast<int>(height), {} };
+    image.pixels_.resize(static_cast<size_t>(width) * height * 4);
+
+    for (unsigned int row = 0; row < height; ++row) {
+
+        std::memcpy(image.pixels_.data() + static_cast<size_t>(row) * width * 4,
+                    bits + static_cast<size_t>(row) * pitch, static_cast<size_t>(width) * 4);
+    }
+
+    //Free FreeImage's copy of the data
+    FreeImage_Unload(dib);
+
+    return image;
+}
+
+TextureAtlas::Image TextureManager::ReadImageFile(const char* filename) {
+
+    uint64_t hash = HashFileContents(filename);
+    CookedTexture cooked;
+
+    if (texture_cache_.Load(hash, cooked)) {
+
+        const unsigned char* pixels = cooked.GetPixels();
+        size_t size = static_cast<size_t>(cooked.GetWidth()) * cooked.GetHeight() * 4;
+        return { cooked.GetWidth(), cooked.GetHeight(), { pixels, pixels + size } };
+    }
+
+    TextureAtlas::Image image = DecodeImageFile(filename);
+    texture_cache_.Cook(hash, image);
+    return image;
+}
+
+GLuint TextureManager::CreateTextureObject(int width, int height, const unsigned char* pixels) {
+
+    //OpenGL's image ID to map to
+    GLuint texobj_hdl;
+
     glGenTextures(1, &texobj_hdl);
     glBindTexture(GL_TEXTURE_2D, texobj_hdl);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -208,14 +236,262 @@ std::vector<GLuint> TextureManager::LoadImageFile(const char* filename) {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
                  width, height,
-                 0, GL_BGRA, GL_UNSIGNED_BYTE, bits);
+                 0, GL_BGRA, GL_UNSIGNED_BYTE, pixels);
 
-    //Free FreeImage's copy of the data
-    FreeImage_Unload(dib);
+    return texobj_hdl;
+}
+
+std::vector<GLuint> TextureManager::LoadImageFile(const char* filename) {
+
+    uint64_t hash = HashFileContents(filename);
+    CookedTexture cooked;
+
+    //upload straight from the mapped pages of the cooked copy
+    if (texture_cache_.Load(hash, cooked)) {
+
+        GLuint texobj_hdl = CreateTextureObject(cooked.GetWidth(), cooked.GetHeight(), cooked.GetPixels());
+        return { static_cast<GLuint>(cooked.GetWidth()), static_cast<GLuint>(cooked.GetHeight()), texobj_hdl };
+    }
+
+    TextureAtlas::Image image = DecodeImageFile(filename);
+    texture_cache_.Cook(hash, image);
+    GLuint texobj_hdl = CreateTextureObject(image.width_, image.height_, image.pixels_.data());
 
     //return success
     std::cout << "Tileset successfully loaded : " << filename << std::endl;
-    return { width, height, texobj_hdl };
+    return { static_cast<GLuint>(image.width_), static_cast<GLuint>(image.height_), texobj_hdl };
+}
+
+void TextureManager::BeginAtlas() {
+
+    if (atlas_pending_) {
+
+        EndAtlas();
+    }
+
+    atlas_open_ = true;
+}
+
+size_t TextureManager::AddAtlasImage(const char* filename) {
+
+    auto it = atlas_files_.find(filename);
+
+    if (it != atlas_files_.end()) {
+
+        return it->second;
+    }
+
+    size_t image = atlas_queue_.size();
+    atlas_queue_.push_back(filename);
+    atlas_files_[filename] = image;
+    return image;
+}
+
+void TextureManager::AddAtlasUser(size_t image, GLuint* handle,
+                                  std::vector<glm::vec2>* tex_vtx, float* offset_x,
+                                  size_t* width, size_t* height) {
+
+    //a handle registered again, e.g. by a reloaded tileset, takes the latest image
+    atlas_users_[handle] = AtlasUser{ image, handle, tex_vtx, offset_x, width, height };
+}
+
+void TextureManager::PackAtlas(int page_size) {
+
+    std::vector<TextureAtlas::Image> images(atlas_queue_.size());
+    std::atomic<size_t> next_image{ 0 };
+
+    auto decode = [this, &images, &next_image]() {
+
+        for (size_t i = next_image++; i < images.size(); i = next_image++) {
+
+            images[i] = ReadImageFile(atlas_queue_[i].c_str());
+        }
+    };
+
+    //FreeImage is only initialised once, so each file can be decoded on its own thread
+    size_t workers = (std::min)(static_cast<size_t>((std::max)(std::thread::hardware_concurrency(), 1u)),
+                                images.size());
+
+    std::vector<std::future<void>> workers_done;
+    for (size_t worker = 1; worker < workers; ++worker)
+        workers_done.push_back(std::async(std::launch::async, decode));
+
+    decode();
+
+    for (std::future<void>& done : workers_done)
+        done.get();
+
+    for (TextureAtlas::Image& image : images) {
+
+        atlas_.Add(std::move(image));
+    }
+
+    atlas_.Pack(page_size, atlas_padding_);
+
+    //images larger than a page are kept in their own texture
+    for (size_t i = 0; i < atlas_.GetImageCount(); ++i) {
+
+        if (atlas_.GetPlacement(i).page_ < 0) {
+
+            atlas_loose_.push_back(i);
+        }
+    }
+}
+
+void TextureManager::CloseAtlas() {
+
+    atlas_open_ = false;
+
+    if (atlas_queue_.empty()) {
+
+        atlas_files_.clear();
+        atlas_users_.clear();
+        return;
+    }
+
+    GLint max_size;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+
+    atlas_pending_ = true;
+    atlas_packing_ = std::async(std::launch::async, &TextureManager::PackAtlas, this,
+                                (std::min)(static_cast<int>(max_size), atlas_page_size_));
+}
+
+bool TextureManager::UploadAtlas(float budget, const std::function<void(size_t, size_t)>& progress) {
+
+    if (!atlas_pending_) {
+
+        return true;
+    }
+
+    if (atlas_packing_.valid()) {
+
+        //still decoding, check again next frame
+        if (atlas_packing_.wait_for(std::chrono::seconds::zero()) != std::future_status::ready) {
+
+            return false;
+        }
+
+        atlas_packing_.get();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    const std::vector<TextureAtlas::Page>& pages = atlas_.GetPages();
+    size_t total = pages.size() + atlas_loose_.size();
+
+    while (atlas_uploads_.size() < total) {
+
+        size_t upload = atlas_uploads_.size();
+
+        if (upload < pages.size()) {
+
+            const TextureAtlas::Page& page = pages[upload];
+            atlas_uploads_.push_back(CreateTextureObject(page.width_, page.height_, page.pixels_.data()));
+            atlas_pages_.push_back(atlas_uploads_.back());
+        }
+        else {
+
+            const TextureAtlas::Image& image = atlas_.GetImage(atlas_loose_[upload - pages.size()]);
+            atlas_uploads_.push_back(CreateTextureObject(image.width_, image.height_, image.pixels_.data()));
+        }
+
+        if (progress) {
+
+            progress(atlas_uploads_.size(), total);
+        }
+
+        std::chrono::duration<float> spent = std::chrono::steady_clock::now() - start;
+
+        if (spent.count() >= budget) {
+
+            break;
+        }
+    }
+
+    if (atlas_uploads_.size() < total) {
+
+        return false;
+    }
+
+    FinishAtlas();
+    return true;
+}
+
+void TextureManager::FinishAtlas() {
+
+    size_t page_count = atlas_.GetPages().size();
+    std::vector<GLuint> handles(atlas_.GetImageCount());
+
+    for (size_t i = 0; i < handles.size(); ++i) {
+
+        const TextureAtlas::Placement& placement = atlas_.GetPlacement(i);
+
+        if (placement.page_ >= 0) {
+
+            handles[i] = atlas_uploads_[placement.page_];
+        }
+    }
+
+    for (size_t i = 0; i < atlas_loose_.size(); ++i) {
+
+        handles[atlas_loose_[i]] = atlas_uploads_[page_count + i];
+    }
+
+    for (auto& [handle, user] : atlas_users_) {
+
+        *handle = handles[user.image_];
+
+        if (user.tex_vtx_) {
+
+            for (glm::vec2& vtx : *user.tex_vtx_) {
+
+                vtx = atlas_.ToAtlasUV(user.image_, vtx);
+            }
+        }
+
+        if (user.offset_x_) {
+
+            *user.offset_x_ *= atlas_.ToAtlasScale(user.image_).x;
+        }
+
+        if (user.width_ && user.height_) {
+
+            const TextureAtlas::Image& image = atlas_.GetImage(user.image_);
+            *user.width_ = static_cast<size_t>(image.width_);
+            *user.height_ = static_cast<size_t>(image.height_);
+        }
+    }
+
+    std::cout << atlas_.GetImageCount() << " images packed into "
+              << page_count << " atlas pages" << std::endl;
+
+    atlas_pending_ = false;
+    atlas_.Clear();
+    atlas_files_.clear();
+    atlas_queue_.clear();
+    atlas_users_.clear();
+    atlas_loose_.clear();
+    atlas_uploads_.clear();
+}
+
+void TextureManager::EndAtlas() {
+
+    if (atlas_open_) {
+
+        CloseAtlas();
+    }
+
+    if (atlas_packing_.valid()) {
+
+        atlas_packing_.wait();
+    }
+
+    UploadAtlas(std::numeric_limits<float>::infinity());
+}
+
+bool TextureManager::IsAtlasPage(GLuint handle) const {
+
+    return std::find(atlas_pages_.begin(), atlas_pages_.end(), handle) != atlas_pages_.end();
 }
 
 void TextureManager::CreateTileset(const char* filename, size_t columns, size_t rows, std::string tileset_name)
@@ -236,7 +512,21 @@ void TextureManager::CreateTileset(const char* filename, size_t columns, size_t
     }
 
     //[0] -> width, [1] -> height, [2] -> handle
-    std::vector<GLuint> image_file_data = LoadImageFile(filename);
+    std::vector<GLuint> image_file_data;
+    size_t atlas_image = 0;
+
+    //while collecting, the handle is only known once the atlas is packed
+    if (atlas_open_) {
+
+        //the size is filled in with the handle once the image is decoded
+        atlas_image = AddAtlasImage(filename);
+        image_file_data = { 0, 0, 0 };
+    }
+    else {
+
+        image_file_data = LoadImageFile(filename);
+    }
+
     GLuint tileset_handle_ = image_file_data[2];
     tilesets_[tileset_name] = { tileset_handle_, tile_names };
 
@@ -258,6 +548,18 @@ void TextureManager::CreateTileset(const char* filename, size_t columns, size_t
                            {origin.x + offset.x, origin.y + offset.y} } };
         }
     }
+
+    if (atlas_open_) {
+
+        AddAtlasUser(atlas_image, &tilesets_[tileset_name].tileset_handle_);
+
+        for (const std::string& tile_name : tile_names) {
+
+            Texture& texture = textures_[tile_name];
+            AddAtlasUser(atlas_image, &texture.tileset_handle_, &texture.tex_vtx_,
+                         nullptr, &texture.width_, &texture.height_);
+        }
+    }
 }
 
 bool TextureManager::UnloadTileset(std::string tileset_name) {
@@ -267,7 +569,12 @@ bool TextureManager::UnloadTileset(std::string tileset_name) {
     //if this texture ID is in use, unload the current texture
     if (it != tilesets_.end()) {
 
-        it->second.UnloadTileset();
+        //atlas pages are shared with other tilesets and animations
+        if (!IsAtlasPage(it->second.tileset_handle_)) {
+
+            it->second.UnloadTileset();
+        }
+
         std::vector<std::string> tile_name = it->second.GetTileNames();
 
         for (int i = 0; i < tile_name.size(); ++i) {
@@ -288,9 +595,15 @@ void TextureManager::UnloadAllTilesets() {
 
     for (auto it = tilesets_.begin(); it != tilesets_.end(); ++it) {
 
-        it->second.UnloadTileset();
+        if (!IsAtlasPage(it->second.tileset_handle_)) {
+
+            it->second.UnloadTileset();
+        }
     }
 
+    glDeleteTextures(static_cast<GLsizei>(atlas_pages_.size()), atlas_pages_.data());
+
+    atlas_pages_.clear();
     textures_.clear();
     tilesets_.clear();
 }
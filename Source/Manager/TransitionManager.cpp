@@ -15,6 +15,7 @@
 #include "Engine/Core.h"
 #include "Systems/Game.h"
 #include "Manager/TransitionManager.h"
+#include "Manager/FileManager.h"
 
 
 TransitionManager::TransitionManager() : 
@@ -152,6 +153,12 @@ void TransitionManager::CloseTransition(const float& frametime) {
 			current_transition_->dark_timer_ = current_transition_->default_dark_timer_;
 		}
 
+		// Start up textures are still being uploaded, stay dark until they are ready
+		else if (CORE->GetManager<TextureManager>()->IsAtlasPending()) {
+
+			end_ = true;
+		}
+
 		else {
 			
 			// change state
@@ -191,9 +198,8 @@ void TransitionManager::LoadTransition(std::string name, std::stringstream& data
 
 void TransitionManager::DeSerialize(const std::string& filepath) {
 
-	// Parse the stringstream into document (DOM) format
-	rapidjson::Document doc;
-	DeSerializeJSON(filepath, doc);
+	// Parse the file into document (DOM) format
+	const rapidjson::Document& doc = DeSerializeJSON(filepath);
 
 	// Treats entire filestream at index as array and ensure that it is an array
 	const rapidjson::Value& transition_arr_ = doc;
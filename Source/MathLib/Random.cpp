@@ -0,0 +1,221 @@
+/**********************************************************************************
+*\file         Random.cpp
+*\brief        Contains definition of functions and variables used for the
+*			   per-thread random number generator
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "MathLib/Random.h"
+#include <atomic>
+#include <cstring>
+
+#ifdef PE_RANDOM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+	// Seed shared by all threads, bumping the epoch forces every thread to reseed
+	std::atomic<uint64_t> global_seed_{ 0x5EEDCAFEF00DULL };
+	std::atomic<uint32_t> global_epoch_{ 0 };
+	std::atomic<uint32_t> next_stream_{ 0 };
+
+	struct ThreadRandom
+	{
+		RandomGenerator generator_;
+		uint32_t stream_;
+		uint32_t epoch_;
+		bool seeded_;
+
+		ThreadRandom() :
+			stream_{ next_stream_.fetch_add(1, std::memory_order_relaxed) },
+			epoch_{},
+			seeded_{ false }
+		{  }
+	};
+
+	thread_local ThreadRandom thread_random_;
+
+	// Expands a 64 bit seed into well mixed state words
+	uint64_t SplitMix64(uint64_t& x) {
+
+		uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+	inline uint32_t Rotl(uint32_t x, int k) {
+
+		return (x << k) | (x >> (32 - k));
+	}
+
+	// Converts the upper 23 bits into a float within [0, 1)
+	inline float ToUnitFloat(uint32_t x) {
+
+		uint32_t bits = (x >> 9) | 0x3F800000u;
+		float f;
+		std::memcpy(&f, &bits, sizeof(f));
+		return f - 1.0f;
+	}
+
+	inline uint32_t NextState(uint32_t (&s)[4]) {
+
+		const uint32_t result = s[0] + s[3];
+		const uint32_t t = s[1] << 9;
+
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = Rotl(s[3], 11);
+
+		return result;
+	}
+}
+
+RandomGenerator::RandomGenerator(uint64_t seed) {
+
+	Seed(seed);
+}
+
+void RandomGenerator::Seed(uint64_t seed) {
+
+	uint64_t x = seed;
+
+	for (int i = 0; i < 4; i += 2) {
+
+		uint64_t v = SplitMix64(x);
+		state_[i] = static_cast<uint32_t>(v);
+		state_[i + 1] = static_cast<uint32_t>(v >> 32);
+	}
+
+	// Lanes are stored as [word][lane] so each word loads as one register
+	for (int lane = 0; lane < 4; ++lane) {
+
+		for (int i = 0; i < 4; i += 2) {
+
+			uint64_t v = SplitMix64(x);
+			lanes_[i][lane] = static_cast<uint32_t>(v);
+			lanes_[i + 1][lane] = static_cast<uint32_t>(v >> 32);
+		}
+	}
+}
+
+uint32_t RandomGenerator::NextU32() {
+
+	return NextState(state_);
+}
+
+float RandomGenerator::NextFloat() {
+
+	return ToUnitFloat(NextU32());
+}
+
+float RandomGenerator::Range(float min, float max) {
+
+	return min + (max - min) * NextFloat();
+}
+
+int RandomGenerator::Range(int min, int max) {
+
+	if (max <= min)
+		return min;
+
+	return min + static_cast<int>(Index(static_cast<size_t>(max) - min + 1));
+}
+
+size_t RandomGenerator::Index(size_t count) {
+
+	if (!count)
+		return 0;
+
+	// Multiply-shift reduction, avoids the modulo bias of rand() % count
+	return static_cast<size_t>((static_cast<uint64_t>(NextU32()) * static_cast<uint32_t>(count)) >> 32);
+}
+
+void RandomGenerator::FillRange(float* out, size_t count, float min, float max) {
+
+	const float span = max - min;
+	size_t i = 0;
+
+#ifdef PE_RANDOM_SSE2
+	__m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes_[0]));
+	__m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes_[1]));
+	__m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes_[2]));
+	__m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes_[3]));
+
+	const __m128i one_bits = _mm_set1_epi32(0x3F800000);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 v_min = _mm_set1_ps(min);
+	const __m128 v_span = _mm_set1_ps(span);
+
+	for (; i + 4 <= count; i += 4) {
+
+		// xoshiro128+ step on 4 lanes
+		__m128i result = _mm_add_epi32(s0, s3);
+		__m128i t = _mm_slli_epi32(s1, 9);
+
+		s2 = _mm_xor_si128(s2, s0);
+		s3 = _mm_xor_si128(s3, s1);
+		s1 = _mm_xor_si128(s1, s2);
+		s0 = _mm_xor_si128(s0, s3);
+		s2 = _mm_xor_si128(s2, t);
+		s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+		// Map to [1, 2) through the exponent bits, then to [min, max)
+		__m128 unit = _mm_sub_ps(_mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(result, 9), one_bits)), one);
+		_mm_storeu_ps(out + i, _mm_add_ps(v_min, _mm_mul_ps(unit, v_span)));
+	}
+
+	_mm_store_si128(reinterpret_cast<__m128i*>(lanes_[0]), s0);
+	_mm_store_si128(reinterpret_cast<__m128i*>(lanes_[1]), s1);
+	_mm_store_si128(reinterpret_cast<__m128i*>(lanes_[2]), s2);
+	_mm_store_si128(reinterpret_cast<__m128i*>(lanes_[3]), s3);
+#endif
+
+	// Remainder (or everything without SSE2) is generated lane by lane
+	for (; i < count; ++i) {
+
+		uint32_t lane[4] = { lanes_[0][i & 3], lanes_[1][i & 3], lanes_[2][i & 3], lanes_[3][i & 3] };
+		out[i] = min + span * ToUnitFloat(NextState(lane));
+
+		for (int w = 0; w < 4; ++w)
+			lanes_[w][i & 3] = lane[w];
+	}
+}
+
+void SeedRandom(uint64_t seed) {
+
+	global_seed_.store(seed, std::memory_order_relaxed);
+	global_epoch_.fetch_add(1, std::memory_order_release);
+}
+
+void SetRandomStream(uint32_t stream) {
+
+	thread_random_.stream_ = stream;
+	thread_random_.seeded_ = false;
+}
+
+RandomGenerator& GetRandom() {
+
+	ThreadRandom& local = thread_random_;
+	const uint32_t epoch = global_epoch_.load(std::memory_order_acquire);
+
+	if (!local.seeded_ || local.epoch_ != epoch) {
+
+		uint64_t x = global_seed_.load(std::memory_order_relaxed) ^ (static_cast<uint64_t>(local.stream_) << 32);
+		local.generator_.Seed(SplitMix64(x));
+		local.epoch_ = epoch;
+		local.seeded_ = true;
+	}
+
+	return local.generator_;
+}
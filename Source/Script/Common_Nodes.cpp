@@ -1,221 +1,179 @@
 #include "Script/Common_Nodes.h"
 
-Common::CheckAlive::CheckAlive(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-	respawn_timer_.TimerStop();
-	respawn_timer_.TimerReset();
-}
-
-bool Common::CheckAlive::run()
+bool Common::CheckAlive(Agent& agent, const Context& context, const Node& node)
 {
-	if (ai_->GetLife()) {
+	UNREFERENCED_PARAMETER(context);
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
+
+	if (board.ai_->GetLife()) {
 		return true;
 	}
 	else
 	{
 		// If Timer has not started, start
-		if (respawn_timer_.TimeElapsed(s) == 0)
-			respawn_timer_.TimerStart();
+		if (board.respawn_timer_.TimeElapsed(s) == 0)
+			board.respawn_timer_.TimerStart();
 		// Update Timer if timer has not reached respawn time
-		if (respawn_timer_.TimeElapsed(s) < 10.0f)
+		if (board.respawn_timer_.TimeElapsed(s) < 10.0f)
 		{
-			component_mgr->GetComponent<AnimationRenderer>(id_)->SetAlive(false);
-			component_mgr->GetComponent<PointLight>(id_)->SetAlive(false);
-			component_mgr->GetComponent<ConeLight>(id_)->SetAlive(false);
-			respawn_timer_.TimerUpdate();
+			board.renderer_->SetAlive(false);
+			board.point_light_->SetAlive(false);
+			board.cone_light_->SetAlive(false);
+			board.respawn_timer_.TimerUpdate();
 		}
 		else // Stop timer and reset to 0
 		{
-			respawn_timer_.TimerStop();
-			respawn_timer_.TimerReset();
-			component_mgr->GetComponent<AnimationRenderer>(id_)->SetAlive(true);
-			component_mgr->GetComponent<PointLight>(id_)->SetAlive(true);
-			component_mgr->GetComponent<ConeLight>(id_)->SetAlive(true);
-			obj_rigidbody_->SetPosition({
-				ai_->GetDestinations().begin()->x,
-				ai_->GetDestinations().begin()->y });
-			ai_->SetState(AI::AIState::Patrol);
-			ai_->SetLife(true);
+			board.respawn_timer_.TimerStop();
+			board.respawn_timer_.TimerReset();
+			board.renderer_->SetAlive(true);
+			board.point_light_->SetAlive(true);
+			board.cone_light_->SetAlive(true);
+			board.transform_->SetPosition({
+				board.ai_->GetDestinations().begin()->x,
+				board.ai_->GetDestinations().begin()->y });
+			board.ai_->SetState(AI::AIState::Patrol);
+			board.ai_->SetLife(true);
 		}
 		return false;
 	}
 }
 
-Common::CheckSentry::CheckSentry(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-}
-
-bool Common::CheckSentry::run()
+bool Common::CheckSentry(Agent& agent, const Context& context, const Node& node)
 {
-	if (ai_->GetNumDes() == 1)
+	UNREFERENCED_PARAMETER(context);
+	UNREFERENCED_PARAMETER(node);
+
+	if (agent.board_.ai_->GetNumDes() == 1)
 		return true;
 	return false;
 }
 
-Common::SentryReturn::SentryReturn(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-}
-
-bool Common::SentryReturn::run()
+bool Common::SentryReturn(Agent& agent, const Context& context, const Node& node)
 {
-	if (ai_->GetDestinations().begin()->x == obj_rigidbody_->GetOffsetAABBPos().x &&
-		ai_->GetDestinations().begin()->y == obj_rigidbody_->GetOffsetAABBPos().y)
+	UNREFERENCED_PARAMETER(context);
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
+
+	if (board.ai_->GetDestinations().begin()->x == board.transform_->GetOffsetAABBPos().x &&
+		board.ai_->GetDestinations().begin()->y == board.transform_->GetOffsetAABBPos().y)
 		return false;
 	return true;
 }
 
-Common::AtWaypoint::AtWaypoint(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-}
+bool Common::AtWaypoint(Agent& agent, const Context& context, const Node& node) {
 
-bool Common::AtWaypoint::run() {
-	float distance = Vector2DLength(*ai_->GetCurrentDes() - obj_rigidbody_->GetOffsetAABBPos());
+	UNREFERENCED_PARAMETER(context);
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
+
+	float distance = Vector2DLength(*board.ai_->GetCurrentDes() - board.transform_->GetOffsetAABBPos());
 	// If object is at next path node
-	if (distance < 1.0f || ai_->GetPath().empty())
+	if (distance < 1.0f || board.ai_->GetPath().empty())
 		return false;
 	return true;
 }
 
-Common::ChangeWaypoint::ChangeWaypoint(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Common::ChangeWaypoint(Agent& agent, const Context& context, const Node& node) {
 
-bool Common::ChangeWaypoint::run() {
-	DestinationIt next_it = ai_->GetCurrentDes();
-	if (++next_it == std::end(ai_->GetDestinations()))
-		next_it = std::begin(ai_->GetDestinations());
-	ai_->SetCurrentDes(next_it);
+	UNREFERENCED_PARAMETER(context);
+	UNREFERENCED_PARAMETER(node);
+
+	AI* ai = agent.board_.ai_;
+
+	DestinationIt next_it = ai->GetCurrentDes();
+	if (++next_it == std::end(ai->GetDestinations()))
+		next_it = std::begin(ai->GetDestinations());
+	ai->SetCurrentDes(next_it);
 	return true;
 }
 
-Common::CheckPath::CheckPath(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-	map_ = &*CORE->GetManager<AMap>();
-}
+bool Common::CheckPath(Agent& agent, const Context& context, const Node& node) {
 
-bool Common::CheckPath::run() {
-	Vector2D CurrentDes = *ai_->GetCurrentDes();
-	if (CurrentDes.x != SetDes.x && CurrentDes.y != SetDes.y) {
-		SetDes = *ai_->GetCurrentDes();
-		ai_->GetPath().clear();
-		return map_->Pathing(ai_->GetPath(), obj_rigidbody_->GetOffsetAABBPos(), *ai_->GetCurrentDes());
+	Blackboard& board = agent.board_;
+	Vector2D& set_des = board.destination_[node.slot_];
+
+	Vector2D CurrentDes = *board.ai_->GetCurrentDes();
+	if (CurrentDes.x != set_des.x && CurrentDes.y != set_des.y) {
+		set_des = CurrentDes;
+		board.ai_->GetPath().clear();
+		return context.commands_->FindPath(board.ai_, board.transform_->GetOffsetAABBPos(), CurrentDes);
 	}
 	return true;
 }
 
-Common::Move::Move(EntityID id, float spd) : id_(id), Speed_(spd) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-	forces_ = &*CORE->GetManager<ForcesManager>();
-}
+bool Common::Move(Agent& agent, const Context& context, const Node& node) {
+
+	Blackboard& board = agent.board_;
+	std::vector<Vector2D>& path = board.ai_->GetPath();
 
-bool Common::Move::run() {
-	if (ai_->GetPath().empty())
+	if (path.empty())
 		return false;
 
 	// Calculate distance between ai and destination
-	float distance = Vector2DLength(ai_->GetPath().back() - obj_rigidbody_->GetOffsetAABBPos());
+	float distance = Vector2DLength(path.back() - board.transform_->GetOffsetAABBPos());
 
 	// If object is at next path node
 	if (distance < 1.0f)
 		// Remove node destination
-		ai_->GetPath().pop_back();
-	if (!ai_->GetPath().empty() && ai_->GetState() != AI::AIState::Attack)
+		path.pop_back();
+	if (!path.empty() && board.ai_->GetState() != AI::AIState::Attack)
 	{
 		//get directional unit vector
-		Vector2D directional = ai_->GetPath().back() - obj_rigidbody_->GetOffsetAABBPos();
+		Vector2D directional = path.back() - board.transform_->GetOffsetAABBPos();
 		directional /= Vector2DLength(directional);
 
 		//multiply by speed
-		directional *= Speed_;
+		directional *= node.param_;
 
 		// Move AI
-		forces_->AddForce(id_, "movement", PE_FrameRate.GetFixedDelta(), directional);
+		context.commands_->AddForce(agent.id_, context.movement_force_, agent.tick_delta_, directional);
 		return true;
 	}
 	return false;
 }
 
-Common::PlayerWithinDistance::PlayerWithinDistance(EntityID id, float dist)
-	: id_(id),
-	detectdistance_(dist) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-}
-
-void Common::PlayerWithinDistance::PlayerInit()
-{
-	player_id_ = CORE->GetManager<EntityManager>()->GetPlayerEntities()->GetID();
-	player_status_ = component_mgr->GetComponent<Status>(player_id_);
-	player_rigidbody_ = component_mgr->GetComponent<Transform>(player_id_);
-}
-
-bool Common::PlayerWithinDistance::run()
+bool Common::PlayerWithinDistance(Agent& agent, const Context& context, const Node& node)
 {
-	if (!player_id_)
-		PlayerInit();
-
-	if (player_status_->GetStatus() != StatusType::BURROW &&
-		player_status_->GetStatus() != StatusType::INVISIBLE)
+	if (context.player_status_->GetStatus() != StatusType::BURROW &&
+		context.player_status_->GetStatus() != StatusType::INVISIBLE)
 	{
-		ai_->SetPlayerLastPos(player_rigidbody_->GetOffsetAABBPos());
+		Blackboard& board = agent.board_;
+		board.ai_->SetPlayerLastPos(context.player_transform_->GetOffsetAABBPos());
 
 		// Find current distance of player from obj
-		float distance = Vector2DDistance(player_rigidbody_->GetOffsetAABBPos(), obj_rigidbody_->GetOffsetAABBPos());
+		float distance = Vector2DDistance(context.player_transform_->GetOffsetAABBPos(), board.transform_->GetOffsetAABBPos());
 		// If Player is very close, is detected
-		if (distance < detectdistance_) {
+		if (distance < node.param_) {
 			return true;
 		}
 	}
 	return false;
 }
 
-Common::PlayerWithinVision::PlayerWithinVision(EntityID id, float dist) 
-	: id_(id), detectdistance_(dist)
-{
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-}
-
-void Common::PlayerWithinVision::PlayerInit()
-{
-	player_id_ = CORE->GetManager<EntityManager>()->GetPlayerEntities()->GetID();
-	player_status_ = component_mgr->GetComponent<Status>(player_id_);
-	player_rigidbody_ = component_mgr->GetComponent<Transform>(player_id_);
-}
-
-bool Common::PlayerWithinVision::run() {
-	if (!player_id_)
-		PlayerInit();
+bool Common::PlayerWithinVision(Agent& agent, const Context& context, const Node& node) {
 
-	if (player_status_->GetStatus() != StatusType::BURROW &&
-		player_status_->GetStatus() != StatusType::INVISIBLE)
+	if (context.player_status_->GetStatus() != StatusType::BURROW &&
+		context.player_status_->GetStatus() != StatusType::INVISIBLE)
 	{
-		ai_->SetPlayerLastPos(player_rigidbody_->GetOffsetAABBPos());
+		Blackboard& board = agent.board_;
+		Vector2D player_pos = context.player_transform_->GetOffsetAABBPos();
+		Vector2D obj_pos = board.transform_->GetOffsetAABBPos();
+
+		board.ai_->SetPlayerLastPos(player_pos);
 
 		// Find current distance of player from obj
-		float distance = Vector2DDistance(player_rigidbody_->GetOffsetAABBPos(), obj_rigidbody_->GetOffsetAABBPos());
+		float distance = Vector2DDistance(player_pos, obj_pos);
 
-		if (distance < detectdistance_)
+		if (distance < node.param_)
 		{
 			// Get current direction of object
-			Vector2D vector1 = *ai_->GetCurrentDes() - obj_rigidbody_->GetOffsetAABBPos();
+			Vector2D vector1 = *board.ai_->GetCurrentDes() - obj_pos;
 			// Get direction of player from object
-			Vector2D vector2 = player_rigidbody_->GetOffsetAABBPos() - obj_rigidbody_->GetOffsetAABBPos();
+			Vector2D vector2 = player_pos - obj_pos;
 			// Find the angle of player from current destination
 			float angle = std::atan2f(vector2.y, vector2.x) - std::atan2f(vector1.y, vector1.x);
 			// Change angle from rad to degrees
@@ -223,9 +181,47 @@ bool Common::PlayerWithinVision::run() {
 			// If within view, return detected
 			if (angle > -45.0f && angle < 45.0f)
 				// Note: will have to check for object obstruction in the line of sight
-				ai_->GetPath().clear();
+				board.ai_->GetPath().clear();
 			return true;
 		}
 	}
 	return false;
-}
\ No newline at end of file
+}
+
+void Common::FaceVelocity(Agent& agent, const Context& context) {
+
+	Motion* motion = agent.board_.motion_;
+
+	if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
+		context.commands_->FlipTexture(agent.board_.renderer_);
+		motion->SetIsLeft(false);
+	}
+	else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
+		context.commands_->FlipTexture(agent.board_.renderer_);
+		motion->SetIsLeft(true);
+	}
+}
+
+void Common::BuildCheckWaypoint(Tree& tree) {
+
+	tree.Open(NodeType::Selector);
+		tree.Leaf(AtWaypoint);
+		tree.Leaf(ChangeWaypoint);
+	tree.Close();
+}
+
+void Common::BuildDetectPlayer(Tree& tree, int level) {
+
+	tree.Open(NodeType::Selector);
+	switch (level) {
+	case 1:
+		tree.Leaf(PlayerWithinDistance, 2.0f);
+		tree.Leaf(PlayerWithinVision, 4.0f);
+		break;
+	case 2:
+		tree.Leaf(PlayerWithinDistance, 3.0f);
+		tree.Leaf(PlayerWithinVision, 6.0f);
+		break;
+	}
+	tree.Close();
+}
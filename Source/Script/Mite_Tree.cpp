@@ -12,211 +12,194 @@
 
 #include "Script/Mite_Tree.h"
 
-void Mite_Tree::MiteRoot::CollisionResponse(EntityID obj){
-	UNREFERENCED_PARAMETER(obj);
+void Mite_Tree::Build(Tree& tree, int level) {
+
+	// MiteSequence
+	tree.Open(NodeType::Sequence);
+		tree.Leaf(Common::CheckAlive);
+
+		// ActionSelector
+		tree.Open(NodeType::Selector);
+
+			// DetectSequence
+			tree.Open(NodeType::Sequence);
+				Common::BuildDetectPlayer(tree, level);
+
+				// AttackSelector
+				tree.Open(NodeType::Selector);
+					tree.Leaf(DetectAnim);
+
+					// ChaseSequence
+					tree.Open(NodeType::Sequence);
+						tree.Open(NodeType::Inverter);
+							tree.Leaf(Common::PlayerWithinDistance, 0.5f);
+						tree.Close();
+						tree.Leaf(ChasePath, 0.0f, ChaseSlot);
+						tree.Leaf(Common::Move, 400.0f);
+						tree.Leaf(ChaseAnim);
+					tree.Close();
+
+					tree.Leaf(AttackAnim);
+				tree.Close();
+			tree.Close();
+
+			// IdleSequence
+			tree.Open(NodeType::Sequence);
+				tree.Leaf(Common::CheckSentry);
+
+				// SentrySequence
+				tree.Open(NodeType::Sequence);
+					tree.Leaf(Common::SentryReturn);
+					tree.Leaf(Common::CheckPath, 0.0f, SentrySlot);
+					tree.Leaf(Common::Move, 300.0f);
+					tree.Leaf(WalkAnim);
+				tree.Close();
+
+				tree.Leaf(SentryAnim);
+			tree.Close();
+
+			// PatrolSequence
+			tree.Open(NodeType::Sequence);
+				Common::BuildCheckWaypoint(tree);
+				tree.Leaf(Common::CheckPath, 0.0f, PatrolSlot);
+				tree.Leaf(Common::Move, 300.0f);
+				tree.Leaf(WalkAnim);
+			tree.Close();
+
+		tree.Close();
+	tree.Close();
 }
 
-Mite_Tree::SentryAnim::SentryAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai = component_mgr->GetComponent<AI>(id_);
-}
+bool Mite_Tree::SentryAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
 
-bool Mite_Tree::SentryAnim::run() {
 	// If any pointers are invalid, return
-	if (!renderer || !ai || !motion || !name)
+	if (!board.animated_)
 		return false;
-	ai->SetState(AI::AIState::Patrol);
+	board.ai_->SetState(AI::AIState::Patrol);
 	// If velocity is essentially 0, set player to idle
-	graphics->ChangeAnimation(renderer, "Mite_Idle");
+	context.commands_->ChangeAnimation(board.renderer_, "Mite_Idle");
 
-	if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(false);
-	}
-	else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(true);
-	}
+	Common::FaceVelocity(agent, context);
 	return true;
 }
 
-Mite_Tree::WalkAnim::WalkAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai = component_mgr->GetComponent<AI>(id_);
-}
+bool Mite_Tree::WalkAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
 
-bool Mite_Tree::WalkAnim::run() {
 	// If any pointers are invalid, return
-	if (!renderer || !ai || !motion || !name)
+	if (!board.animated_)
 		return false;
-	ai->SetState(AI::AIState::Patrol);
+	board.ai_->SetState(AI::AIState::Patrol);
 	// If velocity is essentially 0, set player to idle
-	if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-		graphics->ChangeAnimation(renderer, "Mite_Idle");
-	graphics->ChangeAnimation(renderer, "Mite_Walk");
+	if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+		context.commands_->ChangeAnimation(board.renderer_, "Mite_Idle");
+	context.commands_->ChangeAnimation(board.renderer_, "Mite_Walk");
 
-	if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(false);
-	}
-	else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(true);
-	}
+	Common::FaceVelocity(agent, context);
 	return true;
 }
 
-Mite_Tree::DetectAnim::DetectAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Mite_Tree::DetectAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
 
-bool Mite_Tree::DetectAnim::run() {
+	Blackboard& board = agent.board_;
 
 	// If any pointers are invalid, return
-	if (!renderer || !ai_ || !motion || !name)
+	if (!board.animated_)
 		return false;
-	if (ai_->GetState() == AI::AIState::Patrol) {
-		ai_->SetState(AI::AIState::Detected);
-		MessageBGM_Play msg{ "EnemyDetect" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Mite_Alert");
+	if (board.ai_->GetState() == AI::AIState::Patrol) {
+		board.ai_->SetState(AI::AIState::Detected);
+		context.commands_->PlayBGM("EnemyDetect");
+		context.commands_->ChangeAnimation(board.renderer_, "Mite_Alert");
 	}
 
-	if (ai_->GetState() == AI::AIState::Detected && !renderer->FinishedAnimating()) {
+	if (board.ai_->GetState() == AI::AIState::Detected && !board.renderer_->FinishedAnimating()) {
 		// If velocity is essentially 0, set player to idle
-		if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-			graphics->ChangeAnimation(renderer, "Mite_Idle");
+		if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+			context.commands_->ChangeAnimation(board.renderer_, "Mite_Idle");
 
-		if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(false);
-		}
-		else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(true);
-		}
+		Common::FaceVelocity(agent, context);
 		return true;
 	}
 	return false;
 }
 
-Mite_Tree::ChasePath::ChasePath(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-	map_ = &*CORE->GetManager<AMap>();
-}
+bool Mite_Tree::ChasePath(Agent& agent, const Context& context, const Node& node) {
 
-void Mite_Tree::ChasePath::PlayerInit() {
-	player_id_ = CORE->GetManager<EntityManager>()->GetPlayerEntities()->GetID();
-	player_rigidbody_ = component_mgr->GetComponent<Transform>(player_id_);
-}
+	Blackboard& board = agent.board_;
+	Vector2D& set_des = board.destination_[node.slot_];
 
-bool Mite_Tree::ChasePath::run() {
-	if (!player_id_)
-		PlayerInit();
-	Vector2D CurrentDes = *ai_->GetCurrentDes();
-	if (CurrentDes.x != SetDes.x || CurrentDes.y != SetDes.y || ai_->GetPath().empty()) {
-		SetDes = *ai_->GetCurrentDes();
-		ai_->GetPath().clear();
-		return map_->Pathing(ai_->GetPath(), obj_rigidbody_->GetOffsetAABBPos(), player_rigidbody_->GetOffsetAABBPos());
+	Vector2D CurrentDes = *board.ai_->GetCurrentDes();
+	if (CurrentDes.x != set_des.x || CurrentDes.y != set_des.y || board.ai_->GetPath().empty()) {
+		set_des = CurrentDes;
+		board.ai_->GetPath().clear();
+		return context.commands_->FindPath(board.ai_, board.transform_->GetOffsetAABBPos(), context.player_transform_->GetOffsetAABBPos());
 	}
 	return true;
 }
 
-Mite_Tree::ChaseAnim::ChaseAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Mite_Tree::ChaseAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
 
-bool Mite_Tree::ChaseAnim::run() {
+	Blackboard& board = agent.board_;
 
 	// If any pointers are invalid, return
-	if (!renderer || !ai_ || !motion || !name)
+	if (!board.animated_)
 		return false;
 
-	if (ai_->GetState() == AI::AIState::Detected) {
-		ai_->SetState(AI::AIState::Chase);
-		MessageBGM_Play msg{ "EnemyAttack" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Mite_Walk");
+	if (board.ai_->GetState() == AI::AIState::Detected) {
+		board.ai_->SetState(AI::AIState::Chase);
+		context.commands_->PlayBGM("EnemyAttack");
+		context.commands_->ChangeAnimation(board.renderer_, "Mite_Walk");
 	}
 
-	if (ai_->GetState() == AI::AIState::Chase) {
+	if (board.ai_->GetState() == AI::AIState::Chase) {
 		// If velocity is essentially 0, set player to idle
-		if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-			graphics->ChangeAnimation(renderer, "Mite_Idle");
+		if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+			context.commands_->ChangeAnimation(board.renderer_, "Mite_Idle");
 		else {
-			graphics->ChangeAnimation(renderer, "Mite_Walk");
+			context.commands_->ChangeAnimation(board.renderer_, "Mite_Walk");
 		}
 
-		if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(false);
-		}
-		else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(true);
-		}
+		Common::FaceVelocity(agent, context);
 	}
 	return true;
 }
 
-Mite_Tree::AttackAnim::AttackAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Mite_Tree::AttackAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
 
-bool Mite_Tree::AttackAnim::run() {
+	Blackboard& board = agent.board_;
 
 	// If any pointers are invalid, return
-	if (!renderer || !ai_ || !motion || !name)
+	if (!board.animated_)
 		return false;
 
-	if (ai_->GetState() == AI::AIState::Chase) {
-		ai_->SetState(AI::AIState::Attack);
-		MessageBGM_Play msg{ "EnemyExplode" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Mite_Explode");
+	if (board.ai_->GetState() == AI::AIState::Chase) {
+		board.ai_->SetState(AI::AIState::Attack);
+		context.commands_->PlayBGM("EnemyExplode");
+		context.commands_->ChangeAnimation(board.renderer_, "Mite_Explode");
 	}
 
-	if (ai_->GetState() == AI::AIState::Attack && !renderer->FinishedAnimating()) {
+	if (board.ai_->GetState() == AI::AIState::Attack && !board.renderer_->FinishedAnimating()) {
 		// If velocity is essentially 0, set player to idle
-		if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-			graphics->ChangeAnimation(renderer, "Mite_Idle");
+		if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+			context.commands_->ChangeAnimation(board.renderer_, "Mite_Idle");
 
-		if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(false);
-		}
-		else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(true);
-		}
+		Common::FaceVelocity(agent, context);
 	}
-	if (renderer->FinishedAnimating()) {
-		ai_->SetLife(false);
+	if (board.renderer_->FinishedAnimating()) {
+		board.ai_->SetLife(false);
 	}
 	return true;
-}
\ No newline at end of file
+}
@@ -12,202 +12,186 @@
 
 #include "Script/Stag_Tree.h"
 
-void Stag_Tree::StagRoot::CollisionResponse(EntityID obj)
-{
-	UNREFERENCED_PARAMETER(obj);
+void Stag_Tree::Build(Tree& tree, int level) {
+
+	// StagSequence
+	tree.Open(NodeType::Sequence);
+		tree.Leaf(Common::CheckAlive);
+
+		// ActionSelector
+		tree.Open(NodeType::Selector);
+
+			// DetectSequence
+			tree.Open(NodeType::Sequence);
+				Common::BuildDetectPlayer(tree, level);
+
+				// AttackSelector
+				tree.Open(NodeType::Selector);
+					tree.Leaf(DetectAnim);
+
+					// ChaseSequence
+					tree.Open(NodeType::Sequence);
+						tree.Open(NodeType::Inverter);
+							tree.Leaf(Common::PlayerWithinDistance, 1.0f);
+						tree.Close();
+						tree.Leaf(ChasePath, 0.0f, ChaseSlot);
+						tree.Leaf(Common::Move, 400.0f);
+						tree.Leaf(ChaseAnim);
+					tree.Close();
+
+					// AttackSequence
+					tree.Open(NodeType::Sequence);
+						tree.Leaf(Charge, 1000.0f);
+						tree.Leaf(AttackAnim);
+					tree.Close();
+
+					tree.Leaf(IdleAnim);
+				tree.Close();
+			tree.Close();
+
+			// IdleSequence
+			tree.Open(NodeType::Sequence);
+				tree.Leaf(Common::CheckSentry);
+
+				// SentrySequence
+				tree.Open(NodeType::Sequence);
+					tree.Leaf(Common::SentryReturn);
+					tree.Leaf(Common::CheckPath, 0.0f, SentrySlot);
+					tree.Leaf(Common::Move, 300.0f);
+					tree.Leaf(WalkAnim);
+				tree.Close();
+
+				tree.Leaf(SentryAnim);
+			tree.Close();
+
+			// PatrolSequence
+			tree.Open(NodeType::Sequence);
+				Common::BuildCheckWaypoint(tree);
+				tree.Leaf(Common::CheckPath, 0.0f, PatrolSlot);
+				tree.Leaf(Common::Move, 300.0f);
+				tree.Leaf(WalkAnim);
+			tree.Close();
+
+		tree.Close();
+	tree.Close();
 }
 
-Stag_Tree::SentryAnim::SentryAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai = component_mgr->GetComponent<AI>(id_);
-}
+bool Stag_Tree::SentryAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
 
-bool Stag_Tree::SentryAnim::run() {
 	// If any pointers are invalid, return
-	if (!renderer || !ai || !motion || !name)
+	if (!board.animated_)
 		return false;
-	ai->SetState(AI::AIState::Patrol);
+	board.ai_->SetState(AI::AIState::Patrol);
 	// If velocity is essentially 0, set player to idle
-	graphics->ChangeAnimation(renderer, "Stagbeetle_Idle");
+	context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Idle");
 
-	if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(false);
-	}
-	else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(true);
-	}
+	Common::FaceVelocity(agent, context);
 	return true;
 }
 
-Stag_Tree::WalkAnim::WalkAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai = component_mgr->GetComponent<AI>(id_);
-}
+bool Stag_Tree::WalkAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
 
-bool Stag_Tree::WalkAnim::run(){
 	// If any pointers are invalid, return
-	if (!renderer || !ai || !motion || !name)
+	if (!board.animated_)
 		return false;
-	ai->SetState(AI::AIState::Patrol);
+	board.ai_->SetState(AI::AIState::Patrol);
 	// If velocity is essentially 0, set player to idle
-	if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-		graphics->ChangeAnimation(renderer, "Stagbeetle_Idle");
+	if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+		context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Idle");
 	else
-		graphics->ChangeAnimation(renderer, "Stagbeetle_Walk");
+		context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Walk");
 
-	if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(false);
-	}
-	else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-		graphics->FlipTextureY(renderer);
-		motion->SetIsLeft(true);
-	}
+	Common::FaceVelocity(agent, context);
 	return true;
 }
 
-Stag_Tree::DetectAnim::DetectAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Stag_Tree::DetectAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
 
-bool Stag_Tree::DetectAnim::run() {
+	Blackboard& board = agent.board_;
 
 	// If any pointers are invalid, return
-	if (!renderer || !ai_ || !motion || !name)
+	if (!board.animated_)
 		return false;
 
-	if (ai_->GetState() == AI::AIState::Patrol) {
-		ai_->SetState(AI::AIState::Detected);
-		MessageBGM_Play msg{ "EnemyDetect" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Stagbeetle_Alert");
+	if (board.ai_->GetState() == AI::AIState::Patrol) {
+		board.ai_->SetState(AI::AIState::Detected);
+		context.commands_->PlayBGM("EnemyDetect");
+		context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Alert");
 	}
 
-	if (ai_->GetState() == AI::AIState::Detected && !renderer->FinishedAnimating()) {
+	if (board.ai_->GetState() == AI::AIState::Detected && !board.renderer_->FinishedAnimating()) {
 		// If velocity is essentially 0, set player to idle
-		if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-			graphics->ChangeAnimation(renderer, "Stagbeetlee_Idle");
+		if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+			context.commands_->ChangeAnimation(board.renderer_, "Stagbeetlee_Idle");
 
-		if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(false);
-		}
-		else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(true);
-		}
+		Common::FaceVelocity(agent, context);
 		return true;
 	}
 	return false;
 }
 
-Stag_Tree::ChasePath::ChasePath(EntityID id) : id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-	map_ = &*CORE->GetManager<AMap>();
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-}
+bool Stag_Tree::ChasePath(Agent& agent, const Context& context, const Node& node) {
 
-void Stag_Tree::ChasePath::PlayerInit() {
-	player_id_ = CORE->GetManager<EntityManager>()->GetPlayerEntities()->GetID();
-	player_status_ = component_mgr->GetComponent<Status>(player_id_);
-	player_rigidbody_ = component_mgr->GetComponent<Transform>(player_id_);
-}
+	Blackboard& board = agent.board_;
+	Vector2D& set_des = board.destination_[node.slot_];
 
-bool Stag_Tree::ChasePath::run() {
-	if (!player_id_)
-		PlayerInit();
-	if (player_status_->GetStatus() == StatusType::BURROW) {
-		MessageBGM_Play msg{ "EnemyLostSight" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Stagbeetle_Confused");
-		ai_->SetState(AI::AIState::Return);
+	if (context.player_status_->GetStatus() == StatusType::BURROW) {
+		context.commands_->PlayBGM("EnemyLostSight");
+		context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Confused");
+		board.ai_->SetState(AI::AIState::Return);
 	}
-	Vector2D CurrentDes = *ai_->GetCurrentDes();
-	if (CurrentDes.x != SetDes.x || CurrentDes.y != SetDes.y) {
-		SetDes = *ai_->GetCurrentDes();
-		ai_->GetPath().clear();
-		return map_->Pathing(ai_->GetPath(), obj_rigidbody_->GetOffsetAABBPos(), player_rigidbody_->GetOffsetAABBPos());
+	Vector2D CurrentDes = *board.ai_->GetCurrentDes();
+	if (CurrentDes.x != set_des.x || CurrentDes.y != set_des.y) {
+		set_des = CurrentDes;
+		board.ai_->GetPath().clear();
+		return context.commands_->FindPath(board.ai_, board.transform_->GetOffsetAABBPos(), context.player_transform_->GetOffsetAABBPos());
 	}
 	return true;
 }
 
-Stag_Tree::ChaseAnim::ChaseAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Stag_Tree::ChaseAnim(Agent& agent, const Context& context, const Node& node) {
+
+	UNREFERENCED_PARAMETER(node);
 
-bool Stag_Tree::ChaseAnim::run() {
+	Blackboard& board = agent.board_;
 
 	// If any pointers are invalid, return
-	if (!renderer || !ai_ || !motion || !name)
+	if (!board.animated_)
 		return false;
 
-	if (ai_->GetState() == AI::AIState::Detected) {
-		ai_->SetState(AI::AIState::Chase);
-		MessageBGM_Play msg{ "EnemyAttack" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Stagbeetle_Run");
+	if (board.ai_->GetState() == AI::AIState::Detected) {
+		board.ai_->SetState(AI::AIState::Chase);
+		context.commands_->PlayBGM("EnemyAttack");
+		context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Run");
 	}
 
-	if (ai_->GetState() == AI::AIState::Chase) {
+	if (board.ai_->GetState() == AI::AIState::Chase) {
 		// If velocity is essentially 0, set player to idle
-		if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-			graphics->ChangeAnimation(renderer, "Stagbeetlee_Idle");
+		if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+			context.commands_->ChangeAnimation(board.renderer_, "Stagbeetlee_Idle");
 
-		if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(false);
-		}
-		else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(true);
-		}
+		Common::FaceVelocity(agent, context);
 	}
 	return true;
 }
 
-Stag_Tree::Charge::Charge(EntityID id) :id_(id) {
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	ai_ = component_mgr->GetComponent<AI>(id_);
-	obj_rigidbody_ = component_mgr->GetComponent<Transform>(id_);
-	forces_ = &*CORE->GetManager<ForcesManager>();
-}
-
-void Stag_Tree::Charge::PlayerInit() {
-	player_id_ = CORE->GetManager<EntityManager>()->GetPlayerEntities()->GetID();
-	player_status_ = component_mgr->GetComponent<Status>(player_id_);
-	player_rigidbody_ = component_mgr->GetComponent<Transform>(player_id_);
-}
+bool Stag_Tree::Charge(Agent& agent, const Context& context, const Node& node) {
 
-bool Stag_Tree::Charge::run(){
-	if (!player_id_)
-		PlayerInit();
+	Blackboard& board = agent.board_;
 
-	if (ai_->GetState() == AI::AIState::Attack || ai_->GetState() == AI::AIState::Chase) {
+	if (board.ai_->GetState() == AI::AIState::Attack || board.ai_->GetState() == AI::AIState::Chase) {
 		// Calculate distance between ai and destination
-		float distance = Vector2DLength(player_rigidbody_->GetOffsetAABBPos() - obj_rigidbody_->GetOffsetAABBPos());
+		float distance = Vector2DLength(context.player_transform_->GetOffsetAABBPos() - board.transform_->GetOffsetAABBPos());
 
 		// If object is at dest node
 		if (distance < 1.0f)
@@ -215,95 +199,69 @@ bool Stag_Tree::Charge::run(){
 			return false;
 		}
 		//get directional unit vector
-		Vector2D directional = player_rigidbody_->GetOffsetAABBPos() - obj_rigidbody_->GetOffsetAABBPos();
+		Vector2D directional = context.player_transform_->GetOffsetAABBPos() - board.transform_->GetOffsetAABBPos();
 		directional /= Vector2DLength(directional);
 
 		//multiply by speed
-		directional *= Speed_;
+		directional *= node.param_;
 
 		// Move AI
-		forces_->AddForce(id_, "movement", PE_FrameRate.GetFixedDelta(), directional);
+		context.commands_->AddForce(agent.id_, context.movement_force_, agent.tick_delta_, directional);
 		return true;
 	}
 	return false;
 }
 
-Stag_Tree::AttackAnim::AttackAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Stag_Tree::AttackAnim(Agent& agent, const Context& context, const Node& node) {
 
-bool Stag_Tree::AttackAnim::run() {
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
 
 	// If any pointers are invalid, return
-	if (!renderer || !ai_ || !motion || !name)
+	if (!board.animated_)
 		return false;
 
-	if (ai_->GetState() == AI::AIState::Chase) {
-		ai_->SetState(AI::AIState::Attack);
-		MessageBGM_Play msg{ "EnemyAttack" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Stagbeetle_Attack");
+	if (board.ai_->GetState() == AI::AIState::Chase) {
+		board.ai_->SetState(AI::AIState::Attack);
+		context.commands_->PlayBGM("EnemyAttack");
+		context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Attack");
 	}
 
-	if (ai_->GetState() == AI::AIState::Attack) {
+	if (board.ai_->GetState() == AI::AIState::Attack) {
 		// If velocity is essentially 0, set player to idle
-		if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-			graphics->ChangeAnimation(renderer, "Stagbeetlee_Idle");
+		if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+			context.commands_->ChangeAnimation(board.renderer_, "Stagbeetlee_Idle");
 
-		if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(false);
-		}
-		else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(true);
-		}
+		Common::FaceVelocity(agent, context);
 	}
 	return true;
 }
 
-Stag_Tree::IdleAnim::IdleAnim(EntityID id) :id_(id) {
-	graphics = CORE->GetSystem<GraphicsSystem>();
-	component_mgr = &*CORE->GetManager<ComponentManager>();
-	renderer = component_mgr->GetComponent<AnimationRenderer>(id_);
-	motion = component_mgr->GetComponent<Motion>(id_);
-	name = component_mgr->GetComponent<Name>(id_);
-	ai_ = component_mgr->GetComponent<AI>(id_);
-}
+bool Stag_Tree::IdleAnim(Agent& agent, const Context& context, const Node& node) {
 
-bool Stag_Tree::IdleAnim::run() {
+	UNREFERENCED_PARAMETER(node);
+
+	Blackboard& board = agent.board_;
 
 	// If any pointers are invalid, return
-	if (!renderer || !ai_ || !motion || !name)
+	if (!board.animated_)
 		return false;
 
-	if (ai_->GetState() == AI::AIState::Attack) {
-		ai_->SetState(AI::AIState::Return);
-		MessageBGM_Play msg{ "EnemyLostSight" };
-		CORE->BroadcastMessage(&msg);
-		graphics->ChangeAnimation(renderer, "Stagbeetle_Confused");
+	if (board.ai_->GetState() == AI::AIState::Attack) {
+		board.ai_->SetState(AI::AIState::Return);
+		context.commands_->PlayBGM("EnemyLostSight");
+		context.commands_->ChangeAnimation(board.renderer_, "Stagbeetle_Confused");
 	}
 
-	if (ai_->GetState() == AI::AIState::Return && !renderer->FinishedAnimating()) {
-		motion->SetForce(0);
+	if (board.ai_->GetState() == AI::AIState::Return && !board.renderer_->FinishedAnimating()) {
+		board.motion_->SetForce(0);
 		// If velocity is essentially 0, set player to idle
-		if (VerifyZeroFloat(motion->GetVelocity().x) && VerifyZeroFloat(motion->GetVelocity().y))
-			graphics->ChangeAnimation(renderer, "Stagbeetlee_Idle");
+		if (VerifyZeroFloat(board.motion_->GetVelocity().x) && VerifyZeroFloat(board.motion_->GetVelocity().y))
+			context.commands_->ChangeAnimation(board.renderer_, "Stagbeetlee_Idle");
 
-		if (motion->GetVelocity().x > 0 && motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(false);
-		}
-		else if (motion->GetVelocity().x < 0 && !motion->IsLeft()) {
-			graphics->FlipTextureY(renderer);
-			motion->SetIsLeft(true);
-		}
+		Common::FaceVelocity(agent, context);
 		return true;
 	}
 	return false;
-}
\ No newline at end of file
+}
@@ -39,6 +39,8 @@
 #include "Manager/TransitionManager.h"
 #include "Manager/DialogueManager.h"
 #include "Manager/LogicManager.h"
+#include "Manager/FileManager.h"
+#include "Manager/AssetRegistry.h"
 
 #include "Engine/Core.h"
 #include "Systems/Physics.h"
@@ -93,6 +95,7 @@ int WINAPI WinMain(HINSTANCE currentInstance, HINSTANCE previousInstance, PSTR c
 		CORE->AddSystem<ParentingSystem>();
 
 		// Add Managers to the Core Engine
+		CORE->AddManager<FileManager>();
 		CORE->AddManager<ComponentManager>();
 		CORE->AddManager<EntityManager>();
 		CORE->AddManager<AMap>();
@@ -106,6 +109,7 @@ int WINAPI WinMain(HINSTANCE currentInstance, HINSTANCE previousInstance, PSTR c
 		CORE->AddManager<TransitionManager>();
 		CORE->AddManager<DialogueManager>();
 		CORE->AddManager<LogicManager>();
+		CORE->AddManager<AssetRegistry>();
 
 		// Initialize all Systems & Managers that
 		// were added to the Core Engine
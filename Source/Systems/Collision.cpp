@@ -30,6 +30,7 @@
 #include "Components/Status.h"
 #include "Components/Scale.h"
 #include "Components/Inventory.h"
+#include "MathLib/Random.h"
 #include "Script/Stag_Tree.h"
 #include "Script/Mite_Tree.h"
 #include <iostream>
@@ -42,7 +43,7 @@
 // Terrible...
 void PlayGrassRustle() {
 
-	int value = std::rand() % 5;
+	int value = static_cast<int>(GetRandom().Index(5));
 	std::string sound{ "GrassMoves_" };
 	sound += std::to_string(value);
 	CORE->GetSystem<SoundSystem>()->PlaySounds(sound);
@@ -275,15 +276,13 @@ void Collision::CheckClickableCollision(ButtonStates& state) {
 		// Only if clickable is set to active
 		if (clickable->active_) {
 
-			LogicManager* logic_manager = &*CORE->GetManager<LogicManager>();
 			LogicComponent* logic = component_mgr_->GetComponent<LogicComponent>(id);
+			const LogicHandle& update_texture = logic->GetHook(LogicHook::ButtonUpdateTexture);
 
 			if (CheckCursorCollision(cursor_pos, clickable)) {
 
 				// Run logic script to change texture to be "Hovered"
-				std::string UpdateTexture = logic->GetLogic("ButtonUpdateTexture");
-
-				logic_manager->Exec(UpdateTexture, id, state);
+				update_texture.Exec(id, state);
 
 				if (state == ButtonStates::CLICKED)
 					return;
@@ -292,9 +291,7 @@ void Collision::CheckClickableCollision(ButtonStates& state) {
 				
 				// Run logic script to change texture to be Default
 				ButtonStates button_state = ButtonStates::DEFAULT;
-				std::string UpdateTexture = logic->GetLogic("ButtonUpdateTexture");
-
-				logic_manager->Exec(UpdateTexture, id, button_state);
+				update_texture.Exec(id, button_state);
 			}
 		}
 	}
@@ -498,10 +495,8 @@ bool Collision::PlayerGateResponse(AABBIt aabb1, AABBIt aabb2) {
 	return true;
 }
 
-void Collision::PlayerScenarioResponse(AABBIt aabb1, AABBIt aabb2, std::string scenario) {
+void Collision::PlayerScenarioResponse(AABBIt aabb1, AABBIt aabb2, LogicHook scenario) {
 
-	LogicManager* logic = &*CORE->GetManager<LogicManager>();
-	
 	auto& [player_id, player_aabb] = *aabb1;
 	auto& [scenario_id, scenario_aabb] = *aabb2;
 
@@ -512,12 +507,9 @@ void Collision::PlayerScenarioResponse(AABBIt aabb1, AABBIt aabb2, std::string s
 	LogicComponent* player_logic = component_mgr_->GetComponent<LogicComponent>(player_id);
 	LogicComponent* scenario_logic = component_mgr_->GetComponent<LogicComponent>(scenario_id);
 
-	std::string player_scenario = player_logic->GetLogic(scenario);
-	std::string environment_scenario = scenario_logic->GetLogic(scenario);
-
 	// Execute player's logic script
-	logic->Exec(environment_scenario, scenario_id);
-	logic->Exec(player_scenario, player_id, scenario_id);
+	scenario_logic->GetHook(scenario).Exec(scenario_id);
+	player_logic->GetHook(scenario).Exec(player_id, scenario_id);
 }
 
 void Collision::CollisionResponse(const CollisionLayer& layer_a, const CollisionLayer& layer_b,
@@ -544,7 +536,7 @@ void Collision::CollisionResponse(const CollisionLayer& layer_a, const Collision
 		AI* ai_ = component_mgr_->GetComponent<AI>(aabb1->first);
 		if (!ai_->GetLife())
 			break;
-		ai_->GetRoot()->CollisionResponse(aabb2->first);
+		ai_->CollisionResponse(aabb2->first);
 
 		switch (layer_b)
 		{
@@ -589,7 +581,7 @@ void Collision::CollisionResponse(const CollisionLayer& layer_a, const Collision
 			}
 			case CollisionLayer::COLLECTIBLE:
 			{
-				PlayerScenarioResponse(aabb1, aabb2, "Collectible");
+				PlayerScenarioResponse(aabb1, aabb2, LogicHook::Collectible);
 				break;
 			}
 			case CollisionLayer::BURROWABLE:
@@ -618,7 +610,7 @@ void Collision::CollisionResponse(const CollisionLayer& layer_a, const Collision
 			}
 			case CollisionLayer::INTERACTABLE:
 			{
-				PlayerScenarioResponse(aabb1, aabb2, "Interactable");
+				PlayerScenarioResponse(aabb1, aabb2, LogicHook::Interactable);
 				break;
 			}
 			case CollisionLayer::BIGKUSA:
@@ -970,8 +962,7 @@ void Collision::Update(float frametime) {
 		for (auto& [id, boulder_collider] : boulder_layer->second) {
 
 			LogicComponent* logic = component_mgr_->GetComponent<LogicComponent>(id);
-			std::string update = logic->GetLogic("UpdateAnimation");
-			logic_mgr_->Exec(update, id);
+			logic->GetHook(LogicHook::UpdateAnimation).Exec(id);
 		}
 	}
 
@@ -13,6 +13,7 @@
 
 #include "Systems/DialogueSystem.h"
 #include "Engine/Core.h"
+#include "Manager/EntityManager.h"
 
 void DialogueSystem::Init()
 {
@@ -130,13 +131,16 @@ void DialogueSystem::SetCurrentDialogue(std::string dialogue_name)
 {
 	if (dialogue_box_renderer_ == nullptr)
 	{
-		CMap<TextureRenderer>* texture_renderer_arr_ = component_manager_->GetComponentArray<TextureRenderer>();
+		const EntityManager::EntityIdMapType& dialogue_boxes =
+			CORE->GetManager<EntityManager>()->GetNamedEntities(NameTable::Intern("DialogueBox"));
 
-		for (auto it = texture_renderer_arr_->begin(); it != texture_renderer_arr_->end(); ++it)
+		for (auto it = dialogue_boxes.begin(); it != dialogue_boxes.end(); ++it)
 		{
-			if (component_manager_->GetComponent<Name>(it->first)->GetName() == "DialogueBox")
+			TextureRenderer* texture_renderer = component_manager_->GetComponent<TextureRenderer>(it->first);
+
+			if (texture_renderer)
 			{
-				dialogue_box_renderer_ = it->second;
+				dialogue_box_renderer_ = texture_renderer;
 				dialogue_box_scale_ = component_manager_->GetComponent<Scale>(it->first);
 				std::list<Entity*> children = component_manager_->GetComponent<ParentChild>(it->first)->GetChildren();
 				dialogue_text_renderer_ = component_manager_->GetComponent<TextRenderer>((*children.begin())->GetID());
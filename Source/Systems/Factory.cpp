@@ -20,9 +20,12 @@
 #include <fstream>
 #include <sstream>
 #include <assert.h>
+#include <cstring>
 #include "Systems/Debug.h"
 
 #include "Manager/ForcesManager.h"
+#include "Manager/AssetRegistry.h"
+#include "Systems/SoundSystem.h"
 
 #include "Components/Scale.h"
 #include "Components/Status.h"
@@ -50,10 +53,57 @@
 
 #include "Components/AI.h"
 
+#include "MathLib/Random.h"
 #include "prettywriter.h"
 
 EntityFactory* FACTORY = NULL;
 
+namespace {
+
+	// Reads the blocks of an entity's components, passing each one to the
+	// component it was recorded from. Blocks of components the entity does not
+	// have, or of a null entity, are skipped
+	void DeSerializeBlocks(Entity* entity, CloneReader& reader, void (Component::*deserialize)(CloneReader&)) {
+
+		uint32_t component_count = 0;
+		reader >> component_count;
+
+		for (uint32_t k = 0; k < component_count; ++k) {
+
+			uint32_t comp_type = 0, size = 0;
+			reader >> comp_type >> size;
+
+			// Each component only sees its own block, even if it reads less of it
+			CloneReader block = reader.Split(size);
+			Component* component = entity ? entity->GetComponent(static_cast<ComponentTypes>(comp_type)) : nullptr;
+
+			if (component) {
+
+				(component->*deserialize)(block);
+			}
+		}
+	}
+
+	// Writes a count into a block at an offset it was reserved at
+	void WriteCountAt(std::vector<unsigned char>& block, size_t offset, uint32_t count) {
+
+		std::memcpy(block.data() + offset, &count, sizeof(count));
+	}
+
+	// FNV-1a, so a level always starts from the same random seed
+	uint64_t GetLevelSeed(const std::string& level_name) {
+
+		uint64_t hash = 0xCBF29CE484222325ULL;
+
+		for (unsigned char c : level_name) {
+
+			hash = (hash ^ c) * 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+}
+
 EntityFactory::EntityFactory() {
 
 	FACTORY = this;
@@ -158,6 +208,9 @@ void EntityFactory::Init() {
 	comp_mgr_->AddComponentCreator("DialogueTrigger", new ComponentCreator<DialogueTrigger>(ComponentTypes::DIALOGUETRIGGER));
 	comp_mgr_->AddComponentCreator("Child", new ComponentCreator<Child>(ComponentTypes::CHILD));
 
+	level_cache_.Init("Cache/Levels");
+	snapshots_.Init("Saves");
+
 	//load the levels json here
 	levels_.DeSerialize("Resources/EntityConfig/levels.json");
 	levels_.DeSerializeLevels();
@@ -187,6 +240,7 @@ void EntityFactory::DestroyAllEntities() {
 	entity_mgr_->DeletePlayerEntities();
 	entity_mgr_->DeleteAllEntities();
 	CORE->GetManager<ForcesManager>()->Purge();
+	CORE->GetSystem<SoundSystem>()->ResetPlayer();
 }
 
 void EntityFactory::DestroyAllArchetypes() {
@@ -204,6 +258,12 @@ Entity* EntityFactory::CloneArchetype(const std::string& archetype_name) {
 	return entity_mgr_->CloneArchetype(archetype_name);
 }
 
+EntityIDRange EntityFactory::InstantiateArchetype(const std::string& archetype_name, size_t count,
+												  const std::function<void(Entity*, size_t)>& initializer) {
+
+	return entity_mgr_->InstantiateArchetype(archetype_name, count, initializer);
+}
+
 
 
 
@@ -213,8 +273,7 @@ void EntityFactory::CreateAllArchetypes(const std::string& filename) {
 
 	M_DEBUG->WriteDebugMessage("Beginning loading of all archetypes\n");
 
-	rapidjson::Document doc;
-	DeSerializeJSON(filename, doc);
+	const rapidjson::Document& doc = DeSerializeJSON(filename);
 
 	// Treats entire filestream at index as array and ensure that it is an array
 	const rapidjson::Value& entity_arr = doc;
@@ -242,7 +301,7 @@ void EntityFactory::CreateAllArchetypes(const std::string& filename) {
 			DEBUG_ASSERT(member.IsObject(), "Entry does not exist in JSON");
 
 			IComponentCreator* creator;
-			std::shared_ptr<Component> component;
+			Component* component;
 
 			// For every new component in the "Entity"s body
 			if (member.MemberBegin()->name == "component") {
@@ -281,25 +340,25 @@ void EntityFactory::CreateAllArchetypes(const std::string& filename) {
 	}
 }
 
-void EntityFactory::CloneLevelEntities(const std::string& filename, const std::string& archetype_name) {
+void EntityFactory::CloneLevelEntities(const std::string& filename, const std::string& archetype_name, LevelCook& cook) {
 
 	// In this case, we'll be loading multiple entries of entities, each one expected to have 
 	// the same components but different values
 	M_DEBUG->WriteDebugMessage("Beginning cloning and serializing of " + archetype_name + "\n");
 
-	rapidjson::Document doc;
-	DeSerializeJSON(filename, doc);
+	const rapidjson::Document& doc = DeSerializeJSON(filename);
 
 	const rapidjson::Value& ent_arr = doc;
 	DEBUG_ASSERT(ent_arr.IsObject(), "Entity JSON does not exist in proper format");
 
-	// Iterate through each prefab
-	for (rapidjson::Value::ConstMemberIterator var_it = ent_arr.MemberBegin(); var_it != ent_arr.MemberEnd(); ++var_it) {
+	cook.BeginArchetype(archetype_name);
 
-		const rapidjson::Value& value_arr = var_it->value;
+	// Every entity of the archetype is cloned in one batch, then filled in
+	InstantiateArchetype(archetype_name, ent_arr.MemberCount(), [&](Entity* cloned, size_t index) {
 
-		// Create an empty entity
-		Entity* cloned = CloneArchetype(archetype_name);
+		const rapidjson::Value& value_arr = (ent_arr.MemberBegin() + index)->value;
+
+		cook.BeginEntity();
 
 		// Iterate through the body of the prefab that contains components
 		for (rapidjson::Value::ConstValueIterator it = value_arr.Begin(); it != value_arr.End(); ++it) {
@@ -322,20 +381,32 @@ void EntityFactory::CloneLevelEntities(const std::string& filename, const std::s
 					stream << it2->value.GetString() << " ";
 				}
 
-				cloned->GetComponent(comp_type)->DeSerializeClone(stream);
+				// The values are recorded as they are read for the cooked level
+				CloneReader reader{ stream, cook.BeginComponent(comp_type) };
+				cloned->GetComponent(comp_type)->DeSerializeClone(reader);
+				cook.EndComponent();
 			}
 		}
-	}
+	});
 }
 
 void EntityFactory::LoadLevel(const std::string& level_name) {
 
 	std::string filename = GetLevelPath(level_name);
 
-	if (level_name != "Pause")
+	// The pause overlay is loaded over a level that is already running
+	if (level_name != "Pause") {
+
 		levels_.current_state_ = GetLevel(level_name);
+		SeedRandom(GetLevelSeed(level_name));
+	}
+
+	CORE->GetManager<AssetRegistry>()->AcquireLevel(level_name);
 
 	DeSerializeLevelEntities(filename);
+
+	// Documents read during a load are not needed again until the next one
+	CORE->GetManager<FileManager>()->ClearJSON();
 }
 
 //serialises level
@@ -343,9 +414,18 @@ void EntityFactory::DeSerializeLevelEntities(const std::string& filename) {
 
 	M_DEBUG->WriteDebugMessage("Beginning loading of level entities\n");
 
-	// Parse the stringstream into document (DOM) format
-	rapidjson::Document doc;
-	DeSerializeJSON(filename, doc);
+	// A cooked level is read without parsing any JSON
+	if (CloneCookedLevel(filename)) {
+
+		entity_mgr_->SortPlayerEntities();
+		return;
+	}
+
+	LevelCook cook;
+	cook.AddSource(filename);
+
+	// Parse the file into document (DOM) format
+	const rapidjson::Document& doc = DeSerializeJSON(filename);
 
 	// Treats entire filestream at index as array and ensure that it is an array
 	const rapidjson::Value& files_arr = doc;
@@ -359,10 +439,184 @@ void EntityFactory::DeSerializeLevelEntities(const std::string& filename) {
 
 		M_DEBUG->WriteDebugMessage("Cloning archetype: " + archetype_name + "\n");
 
-		CloneLevelEntities(file_name, archetype_name);
+		cook.AddSource(file_name);
+		CloneLevelEntities(file_name, archetype_name, cook);
+	}
+
+	level_cache_.Save(filename, cook);
+
+	entity_mgr_->SortPlayerEntities();
+}
+
+bool EntityFactory::CloneCookedLevel(const std::string& filename) {
+
+	MappedFile cooked;
+	CloneReader reader{ nullptr, 0 };
+
+	if (!level_cache_.Load(filename, cooked, reader)) {
+
+		return false;
+	}
+
+	M_DEBUG->WriteDebugMessage("Cloning cooked level: " + filename + "\n");
+
+	uint32_t archetype_count = 0;
+	reader >> archetype_count;
+
+	for (uint32_t i = 0; i < archetype_count; ++i) {
+
+		std::string archetype_name;
+		uint32_t entity_count = 0;
+		reader >> archetype_name >> entity_count;
+
+		InstantiateArchetype(archetype_name, entity_count, [&reader](Entity* cloned, size_t) {
+
+			DeSerializeBlocks(cloned, reader, &Component::DeSerializeClone);
+		});
+	}
+
+	return true;
+}
+
+void EntityFactory::SaveSnapshot(const std::string& slot) {
+
+	// Entities marked for deletion are not part of the world any more
+	entity_mgr_->UpdateEntityMap();
+
+	std::vector<unsigned char> contents;
+	CloneWriter writer{ contents };
+
+	// The game goes on from a new seed that a restore starts from as well,
+	// so both play out the same
+	RandomGenerator& random = GetRandom();
+	uint64_t seed = (static_cast<uint64_t>(random.NextU32()) << 32) | random.NextU32();
+	SeedRandom(seed);
+
+	writer << static_cast<uint64_t>(entity_mgr_->GetLastEntityID()) << seed;
+
+	size_t run_count_at = contents.size();
+	uint32_t run_count = 0;
+	writer << run_count;
+
+	// Entities are grouped into runs of the same archetype with consecutive
+	// ids, which are cloned back in one batch each
+	size_t entity_count_at = 0;
+	uint32_t entity_count = 0;
+	NameID run_archetype = NameTable::invalid_;
+	EntityID next_id = 0;
+	size_t skipped_count = 0;
+
+	for (auto& [id, entity] : entity_mgr_->GetEntities()) {
+
+		// A snapshot only holds what changed since an entity was cloned, an
+		// entity made without an archetype has nothing to be cloned from
+		if (entity->GetArchetypeID() == NameTable::invalid_) {
+
+			++skipped_count;
+			continue;
+		}
+
+		if (entity->GetArchetypeID() != run_archetype || id != next_id) {
+
+			if (run_count) {
+
+				WriteCountAt(contents, entity_count_at, entity_count);
+			}
+
+			++run_count;
+			run_archetype = entity->GetArchetypeID();
+			writer << NameTable::GetString(run_archetype) << static_cast<uint64_t>(id);
+
+			entity_count_at = contents.size();
+			entity_count = 0;
+			writer << entity_count;
+		}
+
+		++entity_count;
+		next_id = id + 1;
+
+		writer << static_cast<uint32_t>(entity->components_.size());
+
+		for (Component* component : entity->components_) {
+
+			writer << static_cast<uint32_t>(component->GetComponentTypeID());
+
+			size_t block_size_at = contents.size();
+			writer << uint32_t{ 0 };
+
+			component->SerializeSnapshot(writer);
+			WriteCountAt(contents, block_size_at, static_cast<uint32_t>(contents.size() - block_size_at - sizeof(uint32_t)));
+		}
+	}
+
+	if (run_count) {
+
+		WriteCountAt(contents, entity_count_at, entity_count);
+	}
+
+	WriteCountAt(contents, run_count_at, run_count);
+
+	if (skipped_count) {
+
+		M_DEBUG->WriteDebugMessage("Snapshot " + slot + " leaves out " + std::to_string(skipped_count) +
+								   " entities with no archetype, they are not restored\n");
+	}
+
+	snapshots_.Save(slot, std::move(contents));
+}
+
+bool EntityFactory::LoadSnapshot(const std::string& slot) {
+
+	SnapshotStore::Snapshot snapshot;
+	CloneReader reader{ nullptr, 0 };
+
+	if (!snapshots_.Load(slot, snapshot, reader)) {
+
+		return false;
 	}
 
+	M_DEBUG->WriteDebugMessage("Restoring snapshot: " + slot + "\n");
+
+	// Entities marked for deletion are deleted before everything else is
+	entity_mgr_->UpdateEntityMap();
+	DestroyAllEntities();
+
+	uint64_t last_entity_id = 0, seed = 0;
+	uint32_t run_count = 0;
+	reader >> last_entity_id >> seed >> run_count;
+
+	for (uint32_t i = 0; i < run_count; ++i) {
+
+		std::string archetype_name;
+		uint64_t first_id = 0;
+		uint32_t entity_count = 0;
+		reader >> archetype_name >> first_id >> entity_count;
+
+		// Entities of archetypes removed since the save are skipped
+		if (entity_mgr_->GetArchetypes().find(archetype_name) == entity_mgr_->GetArchetypes().end()) {
+
+			for (uint32_t j = 0; j < entity_count; ++j) {
+
+				DeSerializeBlocks(nullptr, reader, &Component::DeSerializeSnapshot);
+			}
+
+			continue;
+		}
+
+		entity_mgr_->SetLastEntityID(static_cast<EntityID>(first_id - 1));
+
+		InstantiateArchetype(archetype_name, entity_count, [&reader](Entity* cloned, size_t) {
+
+			DeSerializeBlocks(cloned, reader, &Component::DeSerializeSnapshot);
+		});
+	}
+
+	entity_mgr_->SetLastEntityID(static_cast<EntityID>(last_entity_id));
 	entity_mgr_->SortPlayerEntities();
+
+	SeedRandom(seed);
+
+	return true;
 }
 
 void EntityFactory::SerializeArchetypes(const std::string& filename) {
@@ -413,18 +667,15 @@ void EntityFactory::SerializeCurrentLevelEntities() {
 			// Start the formatting for JSON
 			writer.StartObject();
 
-			EntityIdMapType map = entity_mgr_->GetEntities();
+			// only log the entities named the same as the current entity path key
+			const EntityIdMapType& named = entity_mgr_->GetNamedEntities(NameTable::Find(it->first));
 
-			for (EntityIdMapTypeIt begin = map.begin(); begin != map.end(); ++begin) {
+			for (EntityIdMapType::const_iterator begin = named.begin(); begin != named.end(); ++begin) {
 
-				// only log if the name of the entity is the same as the current entity path key
-				if (ENTITYNAME(begin->second) == it->first) {
-					
-					// Begin entity
-					writer.Key(it->first.c_str());
+				// Begin entity
+				writer.Key(it->first.c_str());
 
-					begin->second->SerializeClone(&writer);
-				}
+				begin->second->SerializeClone(&writer);
 			}
 
 			// Closing json
@@ -471,23 +722,3 @@ void EntityFactory::SendMessageD(Message* msg) {
 	}
 }
 
-void DeSerializeJSON(const std::string& filename, rapidjson::Document& doc) {
-
-	std::ifstream input_file(filename.c_str());
-	DEBUG_ASSERT(input_file.is_open(), "File does not exist");
-
-	// Read each line separated by a '\n' into a stringstream
-	std::stringstream json_doc_buffer;
-	std::string input;
-
-	while (std::getline(input_file, input)) {
-
-		json_doc_buffer << input << "\n";
-	}
-
-	// Close the file (.json) after
-	input_file.close();
-
-	// Parse the stringstream into document (DOM) format
-	doc.Parse(json_doc_buffer.str().c_str());
-}
\ No newline at end of file
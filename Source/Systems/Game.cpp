@@ -20,6 +20,9 @@
 #include "GameStates/MenuState.h"
 #include "GameStates/PlayState.h"
 #include "Systems/Debug.h"
+#include "Manager/FileManager.h"
+#include "Manager/AssetRegistry.h"
+#include "MathLib/Random.h"
 #include <algorithm>
 
 bool Game::CheckExist(GameState* compare) {
@@ -31,13 +34,17 @@ bool Game::CheckExist(GameState* compare) {
 }
 
 Game::Game() :
-	debug_{ false }
+	debug_{ false },
+	asset_upload_budget_{ 0.004f }
 {}
 
 void Game::Init()
 {
 	b_running_ = true;
 
+	// Worker threads that draw random numbers take the streams after this one
+	SetRandomStream(0);
+
 	//CORE->GetManager<TextureManager>()->TempTextureBatchLoad();
 	//CORE->GetManager<AnimationManager>()->TempAnimationBatchLoad();
 	FACTORY->CreateAllArchetypes("Resources/EntityConfig/archetypes.json");
@@ -50,28 +57,37 @@ void Game::Init()
 
 	files_to_load_ = LoadAllTextureJson();
 
-	//CORE->GetManager<TextureManager>()->TextureBatchLoad("Menu");
-	CORE->GetManager<AnimationManager>()->AnimationBatchLoad("Menu");
-	CORE->GetManager<FontManager>()->FontBatchLoad("Menu");
+	AssetRegistry* assets = &*CORE->GetManager<AssetRegistry>();
 
-	//CORE->GetManager<TextureManager>()->TextureBatchLoad("Play");
-	CORE->GetManager<AnimationManager>()->AnimationBatchLoad("Play");
-	CORE->GetManager<FontManager>()->FontBatchLoad("Play");
+	// Sprites loaded at start up share atlas pages so batches rarely break on textures,
+	// and are kept for the whole game. The splash screen, drawn while the atlas uploads,
+	// is loaded with its level like the fonts and sounds
+	CORE->GetManager<TextureManager>()->BeginAtlas();
 
-	//CORE->GetManager<TextureManager>()->TextureBatchLoad("UIProps");
+	assets->Pin("Menu_animation");
+	assets->Pin("Play_animation");
 
 	// to load all the files for textures
 	for (int i = 0; i < files_to_load_.size(); ++i)
-		CORE->GetManager<TextureManager>()->TextureBatchLoad(files_to_load_[i]);
+		if (files_to_load_[i] != "SplashScreen")
+			assets->Pin(files_to_load_[i] + "_texture");
+
+	CORE->GetManager<TextureManager>()->CloseAtlas();
 
 	ChangeState(&m_SplashState);
 
+	CORE->GetManager<FileManager>()->ClearJSON();
+
 	M_DEBUG->WriteDebugMessage("Game System Init\n");
 }
 
 // takes a pointer to a gamestate
 void Game::ChangeState(GameState* state, std::string level_name)
 {
+	// Assets of the current state are only released once the next state holds its own
+	AssetRegistry* assets = &*CORE->GetManager<AssetRegistry>();
+	assets->BeginTransition();
+
 	// Remove current state
 	if (!states_.empty()) {
 	
@@ -81,6 +97,8 @@ void Game::ChangeState(GameState* state, std::string level_name)
 
 	states_.push_back(state);
 	states_.back()->Init(level_name);
+
+	assets->EndTransition();
 }
 
 void Game::PushState(GameState* state)
@@ -100,6 +118,12 @@ void Game::PopState()
 
 void Game::Update(float frametime)
 {
+	// Upload a little of the start up atlas each frame so the splash screen keeps animating
+	CORE->GetManager<TextureManager>()->UploadAtlas(asset_upload_budget_, [](size_t uploaded, size_t total) {
+
+		M_DEBUG->WriteDebugMessage("Start up textures uploaded: " + std::to_string(uploaded) +
+								   " / " + std::to_string(total) + "\n");
+	});
 
 	if (CORE->GetGamePauseStatus() && !CORE->GetCorePauseStatus()) {
 
@@ -15,9 +15,11 @@
 
 #include "Systems/GraphicsSystem.h"
 #include "Engine/Core.h"
+#include "Manager/FileManager.h"
 #include <FreeImage.h>
 #include <cmath>
 #include <string>
+#include <sstream>
 #include <set>
 #include "Manager/ModelManager.h"
 #include "Entity/ComponentTypes.h"
@@ -25,24 +27,12 @@
 #include "Systems/Debug.h"
 #include "Systems/Message.h"
 #include "Systems/LightingSystem.h"
+#include "Systems/Partitioning.h"
 #include "Components/Scale.h"
 #include "Components/Clickable.h"
 #include "Components/Transform.h"
 #include <glm/gtc/type_ptr.hpp>
 
-// temporary function for checking
-bool HasClickableAndActive(ComponentManager& mgr, EntityID id) {
-
-    Clickable* clickable = mgr.GetComponent<Clickable>(id);
-
-    if (clickable) {
-
-        return (clickable->GetActive()) ? true : false;
-    }
-    //no clickable but active for rendering
-    return true;
-}
-
 int GraphicsSystem::GetBatchSize()
 {
     return batch_size_;
@@ -71,6 +61,7 @@ void GraphicsSystem::Init() {
 
     windows_system_ = CORE->GetSystem<WindowsSystem>();
     camera_system_ = CORE->GetSystem<CameraSystem>();
+    partitioning_ = &*CORE->GetSystem<PartitioningSystem>();
 
     // Set up viewports
     win_size_.x = static_cast<float>(windows_system_->GetWinWidth());
@@ -111,30 +102,47 @@ void GraphicsSystem::Init() {
     animation_manager_ = CORE->GetManager<AnimationManager>();
     component_manager_ = CORE->GetManager<ComponentManager>();
 
-    batch_size_ = 500;
+    LoadBatchSettings();
 
-    graphic_models_["DebugModel"] = model_manager_->AddLinesModel("DebugModel", batch_size_);
-    graphic_models_["BoxModel"] = model_manager_->AddTristripsModel(1, 1, "BoxModel");
-    graphic_models_["TextModel"] = model_manager_->AddTristripsModel(1, 1, "TextModel");
-    graphic_models_["UIModel"] = model_manager_->AddTristripsModel(1, 1, "UIModel");
-    graphic_models_["BatchModel"] = model_manager_->AddTristripsBatchModel(batch_size_, "BatchModel");
+    text_batch_.reserve(max_text_glyphs_ * 4);
+    text_batch_texture_ = 0;
 
-    graphic_shaders_["ObjectShader"] =
+    for (int band = 0; band < UIBandCount; ++band) {
+
+        ui_batches_[band].Init(ui_batch_size_, max_batch_textures_);
+    }
+
+    ui_entries_dirty_ = true;
+    LoadUIFills();
+
+    graphic_models_[DebugModel] = model_manager_->AddLinesModel("DebugModel", batch_size_);
+    graphic_models_[BoxModel] = model_manager_->AddTristripsModel(1, 1, "BoxModel");
+    graphic_models_[TextModel] = model_manager_->AddTextBatchModel(max_text_glyphs_, "TextModel");
+    graphic_models_[UIBatchModel] =
+        model_manager_->AddUIBatchModel(static_cast<int>(ui_batch_size_), UIBandCount, "UIBatchModel");
+    graphic_models_[BatchModel] = model_manager_->AddTristripsBatchModel(batch_size_, batch_segments_, "BatchModel");
+    graphic_models_[InstancedBatchModel] =
+        model_manager_->AddInstancedBatchModel(batch_size_, batch_segments_, "InstancedBatchModel");
+
+    graphic_shaders_[ObjectShader] =
         shader_manager_->AddShdrpgm("Shaders/world_object.vert","Shaders/world_object.frag", "ObjectShader");
 
-    graphic_shaders_["TextShader"] =
+    graphic_shaders_[InstancedObjectShader] =
+        shader_manager_->AddShdrpgm("Shaders/world_object_instanced.vert","Shaders/world_object.frag", "InstancedObjectShader");
+
+    graphic_shaders_[TextShader] =
         shader_manager_->AddShdrpgm("Shaders/text.vert", "Shaders/text.frag", "TextShader");
 
-    graphic_shaders_["UIShader"] =
-        shader_manager_->AddShdrpgm("Shaders/ui_object.vert", "Shaders/ui_object.frag", "UIShader");
+    graphic_shaders_[UIShader] =
+        shader_manager_->AddShdrpgm("Shaders/ui_batch.vert", "Shaders/ui_batch.frag", "UIShader");
 
-    graphic_shaders_["FinalShader"] =
+    graphic_shaders_[FinalShader] =
         shader_manager_->AddShdrpgm("Shaders/final.vert", "Shaders/final.frag", "FinalShader");
 
-    graphic_shaders_["VignetteShader"] =
+    graphic_shaders_[VignetteShader] =
         shader_manager_->AddShdrpgm("Shaders/vignette.vert", "Shaders/vignette.frag", "VignetteShader");
 
-    graphic_shaders_["DebugShader"] =
+    graphic_shaders_[DebugShader] =
         shader_manager_->AddShdrpgm("Shaders/debug.vert", "Shaders/debug.frag", "DebugShader");
 
     lighting_texture_ = CORE->GetSystem<LightingSystem>()->GetLightingTexture();
@@ -142,6 +150,32 @@ void GraphicsSystem::Init() {
 
     //For UI and text
     projection = glm::ortho(0.0f, win_size_.x, 0.0f, win_size_.y);
+    shader_manager_->SetScreenUniforms(projection, win_size_);
+
+    //Samplers never change, so they are set once instead of per draw
+    int texture_samplers[max_batch_textures_]{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+
+    for (GraphicShader batch_shader : { ObjectShader, InstancedObjectShader, UIShader }) {
+
+        Shader* shader = graphic_shaders_[batch_shader];
+        shader->Use();
+        shader->SetUniform(shader->GetUniform("uTex2d"), texture_samplers, static_cast<GLsizei>(max_batch_textures_));
+    }
+
+    for (GraphicShader single_shader : { TextShader, FinalShader }) {
+
+        graphic_shaders_[single_shader]->Use();
+        graphic_shaders_[single_shader]->SetUniform("uTex2d", 0);
+    }
+
+    graphic_shaders_[FinalShader]->UnUse();
+
+    final_opacity_ = graphic_shaders_[FinalShader]->GetUniform("opacity");
+    vignette_center_ = graphic_shaders_[VignetteShader]->GetUniform("center");
+    vignette_clear_size_ = graphic_shaders_[VignetteShader]->GetUniform("clear_size");
+    vignette_max_size_ = graphic_shaders_[VignetteShader]->GetUniform("max_size");
+    vignette_opacity_ = graphic_shaders_[VignetteShader]->GetUniform("opacity");
+    debug_color_ = graphic_shaders_[DebugShader]->GetUniform("color");
 
     M_DEBUG->WriteDebugMessage("Graphics System Init\n");
 }
@@ -169,6 +203,10 @@ void GraphicsSystem::Update(float frametime) {
         if (!it->second->alive_)
             continue;
 
+        // Off screen world animations are paused until they are visible again
+        if (!it->second->ui_ && !partitioning_->IsRendererVisible(it->first))
+            continue;
+
         if (debug_) {
             // Log id of entity and it's updated components that are being updated
             M_DEBUG->WriteDebugMessage("Updating entity: " + std::to_string(it->first) +
@@ -204,21 +242,26 @@ void GraphicsSystem::Draw() {
     glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_);
     glClear(GL_COLOR_BUFFER_BIT);
 
-    glm::mat3 world_to_ndc_xform = *camera_system_->GetMainCamera()->GetCameraWorldToNDCTransform();
+    shader_manager_->SetCameraUniforms(*camera_system_->GetMainCamera()->GetCameraWorldToNDCTransform());
 
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    graphic_shaders_["ObjectShader"]->Use();
-    glBindVertexArray(graphic_models_["BatchModel"]->vaoid_);
-    GLuint vbo_hdl = graphic_models_["BatchModel"]->vboid_;
+    Shader* batch_shader = graphic_shaders_[sprite_batch_.Instanced() ? InstancedObjectShader : ObjectShader];
+    Model* batch_model = graphic_models_[sprite_batch_.Instanced() ? InstancedBatchModel : BatchModel];
 
-    std::multimap<float, IRenderer*> y_sorted {};
+    batch_shader->Use();
+    glBindVertexArray(batch_model->vaoid_);
+
+    const float global_scale = CORE->GetGlobalScale();
+    render_queue_.Clear();
 
-    //draws all the world textures/animations
+    //queues all the world textures/animations by draw key
     for (IRenderOrderIt it = worldobj_renderers_in_order_.begin();
-         it != worldobj_renderers_in_order_.end() ; ) {
+         it != worldobj_renderers_in_order_.end(); ++it) {
+
+        EntityID id = it->second->GetOwner()->GetID();
+
+        if (!it->second->alive_ || !partitioning_->IsRendererVisible(id)) {
 
-        if (!it->second->alive_) {
-            ++it;
             continue;
         }
 
@@ -228,33 +271,38 @@ void GraphicsSystem::Draw() {
                 std::to_string(it->first) + "\n");
 		}
 
-        float y_position =
-            component_manager_->GetComponent<Transform>(it->second->GetOwner()->GetID())->GetPosition().y * CORE->GetGlobalScale() -
-            component_manager_->GetComponent<Scale>(it->second->GetOwner()->GetID())->GetScale().y / 2.0f;
+        Transform* transform = component_manager_->GetComponent<Transform>(id);
+        Scale* scale = component_manager_->GetComponent<Scale>(id);
 
-        y_sorted.insert({ y_position, it->second });
-        
-        int current_layer = it->second->layer_;
-        auto next_object = ++it;
+        float y_position = transform->GetPosition().y * global_scale - scale->GetScale().y / 2.0f;
 
-        if (tex_vtx_sent.size() == static_cast<size_t>(batch_size_) * 4 ||
-            next_object == worldobj_renderers_in_order_.end() ||
-            next_object->second->layer_ != current_layer) {
+        render_queue_.Push(RenderQueue::MakeKey(it->second->layer_, y_position, it->second->texture_handle_),
+                           it->second, transform, scale);
+    }
 
-            for (auto y_it = y_sorted.rbegin();
-                y_it != y_sorted.rend(); ++y_it ) {
+    render_queue_.Sort();
 
-                BatchWorldObject(y_it->second);
-            }
+    //draws all the world textures/animations, layers no longer split batches
+    for (const RenderQueue::Item& item : render_queue_) {
+
+        bool new_texture = texture_handles.find(item.renderer_->texture_handle_) == texture_handles.end();
+
+        if (sprite_batch_.Full() ||
+            (new_texture && texture_handles.size() == max_batch_textures_)) {
 
-            DrawBatch(vbo_hdl, world_to_ndc_xform);
-            y_sorted.clear();
+            DrawBatch(batch_model);
         }
-    
+
+        BatchWorldObject(item);
+    }
+
+    if (!sprite_batch_.Empty()) {
+
+        DrawBatch(batch_model);
     }
 
-    graphic_shaders_["TextShader"]->Use();
-    glBindVertexArray(graphic_models_["TextModel"]->vaoid_);
+    graphic_shaders_[TextShader]->Use();
+    glBindVertexArray(graphic_models_[TextModel]->vaoid_);
 
     //draws all the world text
     for (TextRenderOrderIt it = worldtext_renderers_in_order_.begin();
@@ -270,9 +318,11 @@ void GraphicsSystem::Draw() {
             M_DEBUG->WriteDebugMessage("Drawing entity: " + std::to_string(it->first) + "\n");
         }
 
-        DrawTextObject(graphic_shaders_["TextShader"], graphic_models_["TextModel"], it->second);
+        BatchTextObject(graphic_models_[TextModel], it->second);
     }
 
+    DrawTextBatch(graphic_models_[TextModel]);
+
     if (lighting_enabled_)
     {
         glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA);
@@ -287,31 +337,11 @@ void GraphicsSystem::Draw() {
     DrawFinalTexture(&final_texture_, 1.0f);
 
     //draw all the UI textures
-    graphic_shaders_["UIShader"]->Use();
-    glBindVertexArray(graphic_models_["UIModel"]->vaoid_);
-
-    for (IRenderOrderIt it = uirenderers_in_order_.begin();
-        it != uirenderers_in_order_.end(); ++it) {
-
-        if (!it->second->alive_ || it->second->layer_ >= 10) {
-
-            continue;
-        }
-
-        if (debug_) {
-            // Log id of entity and its updated components that are being updated
-            M_DEBUG->WriteDebugMessage("Drawing entity: " + std::to_string(it->first) + "\n");
-        }
-
-        if (!HasClickableAndActive(*component_manager_, it->second->GetOwner()->GetID()))
-            continue;
-
-        DrawUIObject(graphic_shaders_["UIShader"], graphic_models_["UIModel"], it->second);
-    }
+    DrawUIBand(UIBandBase, graphic_shaders_[UIShader], graphic_models_[UIBatchModel]);
 
     //draws all the UI text
-    graphic_shaders_["TextShader"]->Use();
-    glBindVertexArray(graphic_models_["TextModel"]->vaoid_);
+    graphic_shaders_[TextShader]->Use();
+    glBindVertexArray(graphic_models_[TextModel]->vaoid_);
 
     for (TextRenderOrderIt it = uitext_renderers_in_order_.begin();
          it != uitext_renderers_in_order_.end(); ++it) {
@@ -326,43 +356,19 @@ void GraphicsSystem::Draw() {
             M_DEBUG->WriteDebugMessage("Drawing entity: " + std::to_string(it->first) + "\n");
         }
 
-        DrawTextObject(graphic_shaders_["TextShader"], graphic_models_["TextModel"], it->second);
+        BatchTextObject(graphic_models_[TextModel], it->second);
     }
 
+    DrawTextBatch(graphic_models_[TextModel]);
+
     DrawVignette(1.0f);
 
     //Temporary way to draw things above the vignette for now, will make proper use of layering in the future
-    graphic_shaders_["UIShader"]->Use();
-    glBindVertexArray(graphic_models_["UIModel"]->vaoid_);
-
-    for (IRenderOrderIt it = uirenderers_in_order_.begin();
-        it != uirenderers_in_order_.end(); ++it) {
-
-        if (!it->second->alive_ || it->second->layer_ < 10 || it->second->layer_ >= 20) {
-
-            continue;
-        }
-
-        if (debug_) {
-            // Log id of entity and its updated components that are being updated
-            M_DEBUG->WriteDebugMessage("Drawing entity: " + std::to_string(it->first) + "\n");
-        }
-
-        if (component_manager_->GetComponent<Name>(it->second->GetOwner()->GetID())->GetName() == "Watergauge") {
-
-            DrawHealthbar(graphic_shaders_["UIShader"], graphic_models_["UIModel"], it->second);
-            continue;
-        }
-
-        if (!HasClickableAndActive(*component_manager_, it->second->GetOwner()->GetID()))
-            continue;
-
-        DrawUIObject(graphic_shaders_["UIShader"], graphic_models_["UIModel"], it->second);
-    }
+    DrawUIBand(UIBandOverlay, graphic_shaders_[UIShader], graphic_models_[UIBatchModel]);
 
     //Temporary way to draw things above the vignette for now, will make proper use of layering in the future
-    graphic_shaders_["TextShader"]->Use();
-    glBindVertexArray(graphic_models_["TextModel"]->vaoid_);
+    graphic_shaders_[TextShader]->Use();
+    glBindVertexArray(graphic_models_[TextModel]->vaoid_);
 
     for (TextRenderOrderIt it = uitext_renderers_in_order_.begin();
          it != uitext_renderers_in_order_.end(); ++it) {
@@ -377,63 +383,44 @@ void GraphicsSystem::Draw() {
             M_DEBUG->WriteDebugMessage("Drawing entity: " + std::to_string(it->first) + "\n");
         }
 
-        DrawTextObject(graphic_shaders_["TextShader"], graphic_models_["TextModel"], it->second);
+        BatchTextObject(graphic_models_[TextModel], it->second);
     }
 
-    //Temporary way to draw things above the dialogue text for now, will make proper use of layering in the future
-    graphic_shaders_["UIShader"]->Use();
-    glBindVertexArray(graphic_models_["UIModel"]->vaoid_);
-
-    for (IRenderOrderIt it = uirenderers_in_order_.begin();
-        it != uirenderers_in_order_.end(); ++it) {
+    DrawTextBatch(graphic_models_[TextModel]);
 
-        if (!it->second->alive_ || it->second->layer_ < 20) {
-
-            continue;
-        }
-
-        if (debug_) {
-            // Log id of entity and its updated components that are being updated
-            M_DEBUG->WriteDebugMessage("Drawing entity: " + std::to_string(it->first) + "\n");
-        }
-
-        if (!HasClickableAndActive(*component_manager_, it->second->GetOwner()->GetID()))
-            continue;
-
-        DrawUIObject(graphic_shaders_["UIShader"], graphic_models_["UIModel"], it->second);
-    }
+    //Temporary way to draw things above the dialogue text for now, will make proper use of layering in the future
+    DrawUIBand(UIBandTop, graphic_shaders_[UIShader], graphic_models_[UIBatchModel]);
 
     if (debug_) { debug_ = !debug_; }
 }
 
 void GraphicsSystem::DrawFinalTexture(GLuint* texture, float opacity) {
 
-    graphic_shaders_["FinalShader"]->Use();
-    glBindVertexArray(graphic_models_["BoxModel"]->vaoid_);
-    glBindTexture(GL_TEXTURE_2D, graphic_models_["BoxModel"]->vaoid_);
+    graphic_shaders_[FinalShader]->Use();
+    glBindVertexArray(graphic_models_[BoxModel]->vaoid_);
+    glBindTexture(GL_TEXTURE_2D, graphic_models_[BoxModel]->vaoid_);
     glBindTextureUnit(0, *texture);
   
-    graphic_shaders_["FinalShader"]->SetUniform("uTex2d", 0);
-    graphic_shaders_["FinalShader"]->SetUniform("opacity", opacity);
+    graphic_shaders_[FinalShader]->SetUniform(final_opacity_, opacity);
 
-    glDrawElements(GL_TRIANGLE_STRIP, graphic_models_["BoxModel"]->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
-    graphic_shaders_["FinalShader"]->UnUse();
+    glDrawElements(GL_TRIANGLE_STRIP, graphic_models_[BoxModel]->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
+    graphic_shaders_[FinalShader]->UnUse();
     glBindVertexArray(0);
 }
 
 void GraphicsSystem::DrawVignette(float opacity) {
 
-    graphic_shaders_["VignetteShader"]->Use();
-    glBindVertexArray(graphic_models_["BoxModel"]->vaoid_);
-    glBindTexture(GL_TEXTURE_2D, graphic_models_["BoxModel"]->vaoid_);
+    graphic_shaders_[VignetteShader]->Use();
+    glBindVertexArray(graphic_models_[BoxModel]->vaoid_);
+    glBindTexture(GL_TEXTURE_2D, graphic_models_[BoxModel]->vaoid_);
 
-    graphic_shaders_["VignetteShader"]->SetUniform("center", { windows_system_->GetWinWidth() / 2,  windows_system_->GetWinHeight() / 2 });
-    graphic_shaders_["VignetteShader"]->SetUniform("clear_size", vignette_size);
-    graphic_shaders_["VignetteShader"]->SetUniform("max_size", max_vignette_size);
-    graphic_shaders_["VignetteShader"]->SetUniform("opacity", opacity);
+    graphic_shaders_[VignetteShader]->SetUniform(vignette_center_, { windows_system_->GetWinWidth() / 2,  windows_system_->GetWinHeight() / 2 });
+    graphic_shaders_[VignetteShader]->SetUniform(vignette_clear_size_, vignette_size);
+    graphic_shaders_[VignetteShader]->SetUniform(vignette_max_size_, max_vignette_size);
+    graphic_shaders_[VignetteShader]->SetUniform(vignette_opacity_, opacity);
 
-    glDrawElements(GL_TRIANGLE_STRIP, graphic_models_["BoxModel"]->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
-    graphic_shaders_["VignetteShader"]->UnUse();
+    glDrawElements(GL_TRIANGLE_STRIP, graphic_models_[BoxModel]->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
+    graphic_shaders_[VignetteShader]->UnUse();
     glBindVertexArray(0);
 }
 
@@ -541,6 +528,7 @@ void GraphicsSystem::AddTextureRendererComponent(EntityID id, TextureRenderer* t
     if (it->ui_) {
 
         uirenderers_in_order_.insert({ GetLayer(texture_renderer), texture_renderer });
+        ui_entries_dirty_ = true;
     }
 
     else {
@@ -579,6 +567,7 @@ void GraphicsSystem::RemoveTextureRendererComponent(EntityID id) {
                 if ((*orderit).second->GetOwner()->GetID() == id) {
 
                     orderit = uirenderers_in_order_.erase(orderit);
+                    ui_entries_dirty_ = true;
                     break;
                 }
             }
@@ -616,6 +605,7 @@ void GraphicsSystem::AddAnimationRendererComponent(EntityID id, AnimationRendere
     if (it->ui_) {
 
         uirenderers_in_order_.insert({ GetLayer(animation_renderer), animation_renderer });
+        ui_entries_dirty_ = true;
     }
 
     else {
@@ -653,6 +643,7 @@ void GraphicsSystem::RemoveAnimationRendererComponent(EntityID id) {
                 if ((*orderit).second->GetOwner()->GetID() == id) {
 
                     orderit = uirenderers_in_order_.erase(orderit);
+                    ui_entries_dirty_ = true;
                     break;
                 }
             }
@@ -711,12 +702,11 @@ void GraphicsSystem::UpdateAnimationFrame(AnimationRenderer* anim_renderer, floa
     }
 }
 
-void GraphicsSystem::BatchWorldObject(IRenderer* i_worldobj_renderer) {
+void GraphicsSystem::BatchWorldObject(const RenderQueue::Item& item) {
 
-    Vector2D scale =
-        component_manager_->GetComponent<Scale>(i_worldobj_renderer->GetOwner()->GetID())->GetScale();
-    Transform* transform =
-        component_manager_->GetComponent<Transform>(i_worldobj_renderer->GetOwner()->GetID());
+    IRenderer* i_worldobj_renderer = item.renderer_;
+    Vector2D scale = item.scale_->GetScale();
+    Transform* transform = item.transform_;
 
     const float global_scale = CORE->GetGlobalScale();
     float orientation = static_cast<float>(transform->rotation_ * M_PI / 180);
@@ -733,81 +723,46 @@ void GraphicsSystem::BatchWorldObject(IRenderer* i_worldobj_renderer) {
 
     GLuint tex_id = texture_handles[i_worldobj_renderer->texture_handle_];
 
-    for (int i = 0; i < 4; ++i) {
-
-        tex_vtx_sent.push_back(i_worldobj_renderer->tex_vtx_[i]);
-        scaling_sent.push_back(scaling);
-        rotation_sent.push_back(rotation);
-        position_sent.push_back(position);
-        texture_id_sent.push_back(static_cast<float>(tex_id));
-    }
+    sprite_batch_.Add(i_worldobj_renderer->tex_vtx_.data(), scaling, rotation, position, static_cast<float>(tex_id));
 }
 
-void GraphicsSystem::DrawBatch(GLuint vbo_hdl, glm::mat3 world_to_ndc_xform)
+void GraphicsSystem::DrawBatch(Model* model)
 {
     for (auto tex_it = texture_handles.begin(); tex_it != texture_handles.end(); ++tex_it) {
 
         glBindTextureUnit(tex_it->second, tex_it->first);
     }
 
-    size_t offset = sizeof(glm::vec2) * 4 * batch_size_;
-
-    glNamedBufferSubData(vbo_hdl, offset,
-                         sizeof(glm::vec2) * tex_vtx_sent.size(),
-                         tex_vtx_sent.data());
-
-    offset += sizeof(glm::vec2) * 4 * batch_size_;
+    // Each batch goes to the next segment of the ring
+    size_t offset = model->vbo_tex_offset_ + sprite_batch_.SegmentOffset();
 
-    glNamedBufferSubData(vbo_hdl, offset,
-                         sizeof(glm::vec2) * scaling_sent.size(),
-                         scaling_sent.data());
+    glNamedBufferSubData(model->vboid_, offset, sprite_batch_.Bytes(), sprite_batch_.Data());
 
-    offset += sizeof(glm::vec2) * 4 * batch_size_;
+    GLsizei count = static_cast<GLsizei>(sprite_batch_.Count());
 
-    glNamedBufferSubData(vbo_hdl, offset,
-                         sizeof(glm::vec2) * rotation_sent.size(),
-                         rotation_sent.data());
+    if (sprite_batch_.Instanced()) {
 
-    offset += sizeof(glm::vec2) * 4 * batch_size_;
-
-    glNamedBufferSubData(vbo_hdl, offset,
-                         sizeof(glm::vec2) * position_sent.size(),
-                         position_sent.data());
-
-    offset += sizeof(glm::vec2) * 4 * batch_size_;
-
-    glNamedBufferSubData(vbo_hdl, offset,
-                         sizeof(float) * texture_id_sent.size(),
-                         texture_id_sent.data());
-
-    int texture_samplers[20]{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
-
-    auto loc = glGetUniformLocation(graphic_shaders_["ObjectShader"]->GetHandle(), "uTex2d");
-    glUniform1iv(loc, 20, texture_samplers);
+        glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, model->draw_cnt_, count,
+                                          static_cast<GLuint>(sprite_batch_.Segment() * batch_size_));
+    }
 
-    graphic_shaders_["ObjectShader"]->SetUniform("world_to_ndc_xform", world_to_ndc_xform);
+    else {
 
-    glDrawElements(GL_TRIANGLE_STRIP, static_cast<GLsizei>(6 * tex_vtx_sent.size() / 4 - 2), GL_UNSIGNED_SHORT, NULL);
+        glVertexArrayVertexBuffer(model->vaoid_, 1, model->vboid_, offset, sizeof(SpriteBatch::Vertex));
+        glDrawElements(GL_TRIANGLE_STRIP, 6 * count - 2, GL_UNSIGNED_SHORT, NULL);
+    }
 
-    tex_vtx_sent.clear();
-    scaling_sent.clear();
-    rotation_sent.clear();
-    position_sent.clear();
-    texture_id_sent.clear();
+    sprite_batch_.Advance();
     texture_handles.clear();
 }
 
-void GraphicsSystem::DrawTextObject(Shader* shader, Model* model, TextRenderer* text_renderer) {
+bool GraphicsSystem::UpdateTextMesh(TextRenderer* text_renderer) {
 
-    shader->SetUniform("uTex2d", 0);
-    shader->SetUniform("projection", projection);
-    shader->SetUniform("text_color", text_renderer->color_);
-	
     Transform* xform = component_manager_->GetComponent<Transform>(text_renderer->GetOwner()->GetID());
 	
     if (!xform) {
 
-        return;
+        return false;
     }
 
     Vector2D obj_pos_ = xform->position_ * CORE->GetGlobalScale();
@@ -831,10 +786,24 @@ void GraphicsSystem::DrawTextObject(Shader* shader, Model* model, TextRenderer*
         scale = text_renderer->scale_ * cam_zoom;
     }
 
-    std::string::const_iterator c;
-    for (c = text_renderer->text_.begin(); c != text_renderer->text_.end(); c++) {
+    glm::vec2 origin{ pos.x, pos.y };
+    glm::vec3 color = text_renderer->color_;
+
+    if (!text_renderer->mesh_dirty_ && text_renderer->mesh_position_ == origin &&
+        text_renderer->mesh_scale_ == scale && text_renderer->mesh_color_ == color) {
+
+        return true;
+    }
+
+    text_renderer->mesh_dirty_ = false;
+    text_renderer->mesh_position_ = origin;
+    text_renderer->mesh_scale_ = scale;
+    text_renderer->mesh_color_ = color;
+    text_renderer->mesh_.clear();
+
+    for (char c : text_renderer->text_) {
 
-        Character ch = (*text_renderer->font_->GetCharacters())[*c];
+        Character ch = text_renderer->font_->GetCharacter(c);
 
         glm::ivec2 bearing = ch.GetBearing();
         glm::ivec2 size = ch.GetSize();
@@ -844,127 +813,323 @@ void GraphicsSystem::DrawTextObject(Shader* shader, Model* model, TextRenderer*
 
         float w = size.x * scale;
         float h = size.y * scale;
-        
-        std::vector<glm::vec2> vertices;
 
-        vertices.push_back({ xpos,     ypos + h });
-        vertices.push_back({ xpos + w, ypos + h });
-        vertices.push_back({ xpos,     ypos });
-        vertices.push_back({ xpos + w, ypos });
+        // glyphs without pixels, such as spaces, only advance the cursor
+        if (size.x > 0 && size.y > 0) {
 
-        // render glyph texture over quad
-        glBindTextureUnit(0, ch.GetTexID());
+            glm::vec2 uv_min = ch.GetUVMin();
+            glm::vec2 uv_max = ch.GetUVMax();
+
+            text_renderer->mesh_.push_back({ { xpos,     ypos + h }, { uv_min.x, uv_min.y }, color });
+            text_renderer->mesh_.push_back({ { xpos + w, ypos + h }, { uv_max.x, uv_min.y }, color });
+            text_renderer->mesh_.push_back({ { xpos,     ypos },     { uv_min.x, uv_max.y }, color });
+            text_renderer->mesh_.push_back({ { xpos + w, ypos },     { uv_max.x, uv_max.y }, color });
+        }
 
-        glNamedBufferSubData(model->GetVBOHandle(), 0,
-                             sizeof(glm::vec2) * vertices.size(), vertices.data());
-        // render quad
-        glDrawElements(GL_TRIANGLE_STRIP, model->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
-        
         // now advance cursors for next glyph (note that advance is number of 1/64 pixels)
         pos.x += (ch.GetAdvance() >> 6) * scale; // bitshift by 6 to get value in pixels (2^6 = 64)
     }
+
+    return true;
 }
 
-void GraphicsSystem::DrawUIObject(Shader* shader, Model* model, IRenderer* i_renderer)
-{
-    shader->SetUniform("uTex2d", 0);
-    shader->SetUniform("projection", projection);
+void GraphicsSystem::BatchTextObject(Model* model, TextRenderer* text_renderer) {
 
-    Transform* xform = component_manager_->GetComponent<Transform>(i_renderer->GetOwner()->GetID());
-    Scale* scale = component_manager_->GetComponent<Scale>(i_renderer->GetOwner()->GetID());
+    if (!UpdateTextMesh(text_renderer) || text_renderer->mesh_.empty()) {
 
-    Vector2D obj_pos_ = xform->position_ * CORE->GetGlobalScale() + 0.5f * Vector2D{ win_size_.x, win_size_.y };
-    Vector2D obj_scale = scale->scale_;
+        return;
+    }
 
-    std::vector<glm::vec2> vertices;
-    vertices.push_back({ obj_pos_.x - obj_scale.x, obj_pos_.y - obj_scale.y });
-    vertices.push_back({ obj_pos_.x + obj_scale.x, obj_pos_.y - obj_scale.y });
-    vertices.push_back({ obj_pos_.x - obj_scale.x, obj_pos_.y + obj_scale.y });
-    vertices.push_back({ obj_pos_.x + obj_scale.x, obj_pos_.y + obj_scale.y });
-    
-    for (int i = 0; i < 4; ++i) {
+    // every glyph of a font shares its atlas, only a change of font needs a new draw
+    GLuint atlas_handle = text_renderer->font_->GetAtlasHandle();
+
+    if (!text_batch_.empty() && atlas_handle != text_batch_texture_) {
 
-        vertices.push_back(i_renderer->tex_vtx_[i]);
+        DrawTextBatch(model);
     }
 
-    glBindTextureUnit(0, i_renderer->texture_handle_);
-    
+    text_batch_texture_ = atlas_handle;
+
+    const std::vector<GlyphVertex>& mesh = text_renderer->mesh_;
+    const size_t capacity = max_text_glyphs_ * 4;
+
+    for (size_t copied = 0; copied < mesh.size(); ) {
+
+        size_t count = (std::min)(mesh.size() - copied, capacity - text_batch_.size());
+
+        text_batch_.insert(text_batch_.end(), mesh.begin() + copied, mesh.begin() + copied + count);
+        copied += count;
+
+        if (text_batch_.size() == capacity) {
+
+            DrawTextBatch(model);
+        }
+    }
+}
+
+void GraphicsSystem::DrawTextBatch(Model* model) {
+
+    if (text_batch_.empty()) {
+
+        return;
+    }
+
+    glBindTextureUnit(0, text_batch_texture_);
+
     glNamedBufferSubData(model->GetVBOHandle(), 0,
-                         sizeof(glm::vec2) * vertices.size(), vertices.data());
-    // render quad
-    glDrawElements(GL_TRIANGLE_STRIP, model->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
+                         sizeof(GlyphVertex) * text_batch_.size(), text_batch_.data());
+    // six indices per glyph quad
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(text_batch_.size() / 4 * 6), GL_UNSIGNED_SHORT, NULL);
+
+    text_batch_.clear();
+}
+
+void GraphicsSystem::LoadBatchSettings()
+{
+    const rapidjson::Document& doc = DeSerializeJSON("Resources/EntityConfig/graphics.json");
+
+    const rapidjson::Value& value_arr = doc["Batch"];
+    DEBUG_ASSERT(value_arr.IsArray(), "Entry does not exist in JSON");
+
+    //stores the data into a stream that is easier to read data from
+    std::stringstream stream;
+
+    for (rapidjson::Value::ConstValueIterator it = value_arr.Begin(); it != value_arr.End(); ++it) {
+
+        const rapidjson::Value& member = *it;
+        DEBUG_ASSERT(member.IsObject(), "Entry does not exist in JSON");
+
+        for (rapidjson::Value::ConstMemberIterator it2 = member.MemberBegin(); it2 != member.MemberEnd(); ++it2) {
+
+            stream << it2->value.GetString() << " ";
+        }
+    }
+
+    bool instanced = false;
+    stream >> batch_size_ >> batch_segments_ >> instanced;
+
+    // The vertex path indexes a whole batch with 16 bit indices
+    DEBUG_ASSERT(batch_size_ > 0 && batch_size_ * 4 <= 0xFFFF && batch_segments_ > 0,
+                 "Invalid sprite batch settings");
+
+    sprite_batch_.Init(batch_size_, batch_segments_, instanced);
+}
+
+void GraphicsSystem::LoadUIFills()
+{
+    const rapidjson::Document& doc = DeSerializeJSON("Resources/EntityConfig/ui.json");
+
+    const rapidjson::Value& value_arr = doc["Fill"];
+    DEBUG_ASSERT(value_arr.IsArray(), "Entry does not exist in JSON");
+
+    for (rapidjson::Value::ConstValueIterator it = value_arr.Begin(); it != value_arr.End(); ++it) {
+
+        const rapidjson::Value& member = *it;
+        DEBUG_ASSERT(member.IsObject(), "Entry does not exist in JSON");
+
+        //stores the data into a stream that is easier to read data from
+        std::stringstream stream;
+
+        for (rapidjson::Value::ConstMemberIterator it2 = member.MemberBegin(); it2 != member.MemberEnd(); ++it2) {
+
+            stream << it2->value.GetString() << " ";
+        }
+
+        std::string name;
+        UIFill fill;
+
+        stream >> name >> fill.back_ >> fill.mask_ >> fill.fill_ >> fill.front_ >> fill.scale_ >> fill.drop_;
+
+        ui_fills_[name] = fill;
+    }
 }
 
-void GraphicsSystem::DrawHealthbar(Shader* shader, Model* model, IRenderer* i_renderer)
+void GraphicsSystem::RebuildUIEntries()
 {
-    shader->SetUniform("uTex2d", 0);
-    shader->SetUniform("projection", projection);
+    ui_entries_.clear();
 
-    Transform* xform = component_manager_->GetComponent<Transform>(i_renderer->GetOwner()->GetID());
-    Scale* scale = component_manager_->GetComponent<Scale>(i_renderer->GetOwner()->GetID());
+    for (IRenderOrderIt it = uirenderers_in_order_.begin();
+        it != uirenderers_in_order_.end(); ++it) {
 
-    Health* health = component_manager_->GetComponent<Health>(CORE->GetManager<EntityManager>()->GetPlayerEntities()->GetID());
+        EntityID id = it->second->GetOwner()->GetID();
 
-    Vector2D obj_pos_ = xform->position_ * CORE->GetGlobalScale() + 0.5f * Vector2D{ win_size_.x, win_size_.y };
-    Vector2D obj_scale = scale->scale_ * 0.7f;
+        UIEntry entry{ it->second,
+                       component_manager_->GetComponent<Transform>(id),
+                       component_manager_->GetComponent<Scale>(id),
+                       component_manager_->GetComponent<Clickable>(id),
+                       nullptr };
 
-    std::vector<glm::vec2> gauge_vertices;
-    std::vector<glm::vec2> water_vertices;
+        Name* name = component_manager_->GetComponent<Name>(id);
 
-    gauge_vertices.push_back({ obj_pos_.x - obj_scale.x, obj_pos_.y - obj_scale.y });
-    gauge_vertices.push_back({ obj_pos_.x + obj_scale.x, obj_pos_.y - obj_scale.y });
-    gauge_vertices.push_back({ obj_pos_.x - obj_scale.x, obj_pos_.y + obj_scale.y });
-    gauge_vertices.push_back({ obj_pos_.x + obj_scale.x, obj_pos_.y + obj_scale.y });
+        if (name) {
 
-    obj_pos_.y -= 1.5f * obj_scale.y * (1.0f - health->GetCurrentHealth() / static_cast<float>(health->GetMaxHealth()));
+            std::map<std::string, UIFill>::const_iterator fill = ui_fills_.find(name->GetName());
 
-    water_vertices.push_back({ obj_pos_.x - obj_scale.x, obj_pos_.y - obj_scale.y });
-    water_vertices.push_back({ obj_pos_.x + obj_scale.x, obj_pos_.y - obj_scale.y });
-    water_vertices.push_back({ obj_pos_.x - obj_scale.x, obj_pos_.y + obj_scale.y });
-    water_vertices.push_back({ obj_pos_.x + obj_scale.x, obj_pos_.y + obj_scale.y });
+            if (fill != ui_fills_.end()) {
 
-    std::vector<glm::vec2> tex_vtx{ { 0.0f, 0.0f},
-                                    { 1.0f, 0.0f},
-                                    { 0.0f, 1.0f},
-                                    { 1.0f, 1.0f}, };
+                entry.fill_ = &fill->second;
+            }
+        }
+
+        ui_entries_.push_back(entry);
+    }
+
+    ui_entries_dirty_ = false;
+}
+
+void GraphicsSystem::BatchUIFill(UIBatch& batch, const UIEntry& entry)
+{
+    const UIFill& fill = *entry.fill_;
+
+    float ratio = 1.0f;
+    Entity* player = CORE->GetManager<EntityManager>()->GetPlayerEntities();
+    Health* health = player ? component_manager_->GetComponent<Health>(player->GetID()) : nullptr;
+
+    if (health) {
+
+        ratio = health->GetCurrentHealth() / static_cast<float>(health->GetMaxHealth());
+    }
+
+    Vector2D obj_pos_ = entry.transform_->position_ * CORE->GetGlobalScale() + 0.5f * Vector2D{ win_size_.x, win_size_.y };
+    Vector2D obj_scale = entry.scale_->scale_ * fill.scale_;
+
+    glm::vec2 gauge_vertices[4]{ { obj_pos_.x - obj_scale.x, obj_pos_.y - obj_scale.y },
+                                 { obj_pos_.x + obj_scale.x, obj_pos_.y - obj_scale.y },
+                                 { obj_pos_.x - obj_scale.x, obj_pos_.y + obj_scale.y },
+                                 { obj_pos_.x + obj_scale.x, obj_pos_.y + obj_scale.y } };
+
+    obj_pos_.y -= fill.drop_ * obj_scale.y * (1.0f - ratio);
+
+    glm::vec2 fill_vertices[4]{ { obj_pos_.x - obj_scale.x, obj_pos_.y - obj_scale.y },
+                                { obj_pos_.x + obj_scale.x, obj_pos_.y - obj_scale.y },
+                                { obj_pos_.x - obj_scale.x, obj_pos_.y + obj_scale.y },
+                                { obj_pos_.x + obj_scale.x, obj_pos_.y + obj_scale.y } };
+
+    // The fill is only drawn where the mask was, the front covers both
+    const std::string* names[4]{ &fill.back_, &fill.mask_, &fill.fill_, &fill.front_ };
+    const glm::vec2* vertices[4]{ gauge_vertices, gauge_vertices, fill_vertices, gauge_vertices };
+    UIBatch::Stencil stencils[4]{ UIBatch::Stencil::None, UIBatch::Stencil::Write,
+                                  UIBatch::Stencil::Test, UIBatch::Stencil::None };
 
     for (int i = 0; i < 4; ++i) {
 
-        gauge_vertices.push_back(tex_vtx[i]);
-        water_vertices.push_back(tex_vtx[i]);
+        Texture* texture = texture_manager_->GetTexture(*names[i]);
+
+        if (texture->GetTexVtx()->size() < 4) {
+
+            continue;
+        }
+
+        batch.Add(vertices[i], texture->GetTexVtx()->data(), texture->GetTilesetHandle(), stencils[i]);
     }
-    
-    glNamedBufferSubData(model->GetVBOHandle(), 0,
-                         sizeof(glm::vec2) * gauge_vertices.size(), gauge_vertices.data());
-    glBindTextureUnit(0, texture_manager_->GetTexture("WaterGauge_Leaves_0")->GetTilesetHandle());
-    glDrawElements(GL_TRIANGLE_STRIP, model->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
-    glDisable(GL_DEPTH_TEST);
-
-    glEnable(GL_STENCIL_TEST);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
-    glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-    glStencilFunc(GL_ALWAYS, 1, 0xFF);
-    glStencilMask(0xFF);
-    glNamedBufferSubData(model->GetVBOHandle(), 0,
-                         sizeof(glm::vec2) * gauge_vertices.size(), gauge_vertices.data());
-    glBindTextureUnit(0, texture_manager_->GetTexture("WaterGauge_Droplet_0")->GetTilesetHandle());
-    glDrawElements(GL_TRIANGLE_STRIP, model->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
-    glDisable(GL_DEPTH_TEST);
+}
 
-    glStencilFunc(GL_EQUAL, 1, 0xFF);
-    glStencilMask(0x00);
-    glNamedBufferSubData(model->GetVBOHandle(), 0,
-                         sizeof(glm::vec2) * water_vertices.size(), water_vertices.data());
-    glBindTextureUnit(0, texture_manager_->GetTexture("WaterGauge_Water_0")->GetTilesetHandle());
-    glDrawElements(GL_TRIANGLE_STRIP, model->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
-    glDisable(GL_STENCIL_TEST);
+void GraphicsSystem::DrawUIBand(UIBand band, Shader* shader, Model* model)
+{
+    if (ui_entries_dirty_) {
 
-    glNamedBufferSubData(model->GetVBOHandle(), 0,
-                         sizeof(glm::vec2) * gauge_vertices.size(), gauge_vertices.data());
-    glBindTextureUnit(0, texture_manager_->GetTexture("WaterGauge_Shine_0")->GetTilesetHandle());
-    glDrawElements(GL_TRIANGLE_STRIP, model->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
+        RebuildUIEntries();
+    }
+
+    UIBatch& batch = ui_batches_[band];
+    batch.Begin();
+
+    for (size_t i = 0; i < ui_entries_.size(); ++i) {
+
+        const UIEntry& entry = ui_entries_[i];
+        IRenderer* renderer = entry.renderer_;
+
+        bool in_band = (band == UIBandBase) ? renderer->layer_ < 10 :
+                       (band == UIBandOverlay) ? renderer->layer_ >= 10 && renderer->layer_ < 20 :
+                       renderer->layer_ >= 20;
+
+        if (!renderer->alive_ || !in_band || !entry.transform_ || !entry.scale_) {
+
+            continue;
+        }
+
+        if (debug_) {
+            // Log id of entity and its updated components that are being updated
+            M_DEBUG->WriteDebugMessage("Drawing entity: " + std::to_string(renderer->GetOwner()->GetID()) + "\n");
+        }
+
+        if (entry.fill_) {
+
+            BatchUIFill(batch, entry);
+            continue;
+        }
+
+        //no clickable but active for rendering
+        if (entry.clickable_ && !entry.clickable_->GetActive())
+            continue;
+
+        Vector2D obj_pos_ = entry.transform_->position_ * CORE->GetGlobalScale() + 0.5f * Vector2D{ win_size_.x, win_size_.y };
+        Vector2D obj_scale = entry.scale_->scale_;
+
+        glm::vec2 vertices[4]{ { obj_pos_.x - obj_scale.x, obj_pos_.y - obj_scale.y },
+                               { obj_pos_.x + obj_scale.x, obj_pos_.y - obj_scale.y },
+                               { obj_pos_.x - obj_scale.x, obj_pos_.y + obj_scale.y },
+                               { obj_pos_.x + obj_scale.x, obj_pos_.y + obj_scale.y } };
+
+        batch.Add(vertices, renderer->tex_vtx_.data(), renderer->texture_handle_);
+    }
+
+    // A band keeps its region of the buffer, so a static UI is not uploaded again
+    GLint base_vertex = static_cast<GLint>(band * ui_batch_size_ * 4);
+
+    if (batch.End()) {
+
+        glNamedBufferSubData(model->GetVBOHandle(), base_vertex * sizeof(UIBatch::Vertex),
+                             sizeof(UIBatch::Vertex) * batch.Vertices().size(), batch.Vertices().data());
+    }
+
+    if (batch.Draws().empty()) {
+
+        return;
+    }
+
+    shader->Use();
+    glBindVertexArray(model->vaoid_);
+
+    const std::vector<GLuint>& textures = batch.Textures();
+
+    for (const UIBatch::Draw& draw : batch.Draws()) {
+
+        for (size_t i = 0; i < draw.texture_count_; ++i) {
+
+            glBindTextureUnit(static_cast<GLuint>(i), textures[draw.textures_begin_ + i]);
+        }
+
+        switch (draw.stencil_) {
+
+        case UIBatch::Stencil::Write:
+
+            glEnable(GL_STENCIL_TEST);
+            glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+            glStencilFunc(GL_ALWAYS, 1, 0xFF);
+            glStencilMask(0xFF);
+            break;
+
+        case UIBatch::Stencil::Test:
 
+            glEnable(GL_STENCIL_TEST);
+            glStencilFunc(GL_EQUAL, 1, 0xFF);
+            glStencilMask(0x00);
+            break;
+
+        default:
+
+            glDisable(GL_STENCIL_TEST);
+            break;
+        }
+
+        // six indices per quad, the index buffer is shared by all bands
+        glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(draw.count_ * 6), GL_UNSIGNED_SHORT,
+                                 reinterpret_cast<void*>(draw.first_ * 6 * sizeof(GLushort)), base_vertex);
+    }
+
+    glDisable(GL_STENCIL_TEST);
+    glStencilMask(0xFF);
 }
 
 void GraphicsSystem::ChangeLayer(AnimationRenderer* anim_renderer, int layer) {
@@ -986,6 +1151,7 @@ void GraphicsSystem::ChangeLayer(AnimationRenderer* anim_renderer, int layer) {
         if (it->second == anim_renderer)
         {
             uirenderers_in_order_.erase(it);
+            ui_entries_dirty_ = true;
             uirenderers_in_order_.insert({ layer, anim_renderer });
             return;
         }
@@ -1011,6 +1177,7 @@ void GraphicsSystem::ChangeLayer(TextureRenderer* tex_renderer, int layer) {
         if (it->second == tex_renderer)
         {
             uirenderers_in_order_.erase(it);
+            ui_entries_dirty_ = true;
             uirenderers_in_order_.insert({ layer, tex_renderer });
             return;
         }
@@ -1156,8 +1323,8 @@ GLuint GraphicsSystem::GetFramebuffer()
 
 void GraphicsSystem::DrawDebugLines(Points points, glm::vec4 color, float width)
 {
-    Shader* shader = graphic_shaders_["DebugShader"];
-    Model* model = graphic_models_["DebugModel"];
+    Shader* shader = graphic_shaders_[DebugShader];
+    Model* model = graphic_models_[DebugModel];
 
     shader->Use();
     glBindVertexArray(model->vaoid_);
@@ -1166,8 +1333,8 @@ void GraphicsSystem::DrawDebugLines(Points points, glm::vec4 color, float width)
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
     glLineWidth(width);
 
-    shader->SetUniform("world_to_ndc_xform", *camera_system_->GetMainCamera()->GetCameraWorldToNDCTransform());
-    shader->SetUniform("color", color);
+    shader_manager_->SetCameraUniforms(*camera_system_->GetMainCamera()->GetCameraWorldToNDCTransform());
+    shader->SetUniform(debug_color_, color);
     
     glNamedBufferSubData(model->GetVBOHandle(), 0, sizeof(glm::vec2) * points.size() * 2, points.data());
     glDrawElements(GL_LINES, static_cast<GLsizei>(points.size() * 2), GL_UNSIGNED_SHORT, NULL);
@@ -1200,6 +1367,19 @@ void GraphicsSystem::EnableLighting(bool value)
     lighting_enabled_ = value;
 }
 
+bool GraphicsSystem::InstancedSprites() const
+{
+    return sprite_batch_.Instanced();
+}
+
+void GraphicsSystem::EnableInstancedSprites(bool value)
+{
+    if (value != sprite_batch_.Instanced())
+    {
+        sprite_batch_.Init(batch_size_, batch_segments_, value);
+    }
+}
+
 std::vector<EntityID> GraphicsSystem::EntitiesWithThisTexture(GLuint handle)
 {
     std::vector<EntityID> entities;
@@ -12,6 +12,7 @@
 
 #include "Systems/ImguiSystem.h"
 #include "Manager/Amap.h"
+#include "Manager/FileManager.h"
 
 #include "ImguiWindows/EntityWindow.h"
 #include "ImguiWindows/EntityPathWindow.h"
@@ -511,8 +512,7 @@ const char* ImguiSystem::GetGenericFilter() {
 
 void ImguiSystem::LoadJsonPaths(std::string path) {
 
-    rapidjson::Document doc;
-    DeSerializeJSON(path, doc);
+    const rapidjson::Document& doc = DeSerializeJSON(path);
 
     const rapidjson::Value& files_arr = doc;
     DEBUG_ASSERT(files_arr.IsObject(), "Level JSON does not exist in proper format");
@@ -710,12 +710,12 @@ void ImguiSystem::PopUpMessage(const char* windowName, const char* message) {
     }
 }
 
-void ImguiSystem::DeletePopUp(const char* windowName, std::string objName, Entity* entity, std::shared_ptr<Component> component) {
+void ImguiSystem::DeletePopUp(const char* windowName, std::string objName, Entity* entity, Component* component) {
 
     std::string warning = {};
 
     if (entity) {
-        std::shared_ptr<Name> entityname = std::dynamic_pointer_cast<Name>(entity->GetComponent(ComponentTypes::NAME));
+        Name* entityname = entity->GetComponentType<Name>(ComponentTypes::NAME);
         warning = objName + " from " + entityname->GetName();
     }
 
@@ -0,0 +1,153 @@
+/**********************************************************************************
+*\file         LevelCache.cpp
+*\brief        Contains definition of functions and variables used for
+*			   cooking levels into a binary format that loads without
+*			   parsing the JSON entity files
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Systems/LevelCache.h"
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+LevelCook::LevelCook() :
+	archetype_count_{ 0 },
+	entity_count_at_{ 0 },
+	component_count_at_{ 0 },
+	block_size_at_{ 0 }
+{}
+
+void LevelCook::Increment(size_t offset) {
+
+	uint32_t count;
+	std::memcpy(&count, archetypes_.data() + offset, sizeof(count));
+	++count;
+	std::memcpy(archetypes_.data() + offset, &count, sizeof(count));
+}
+
+void LevelCook::AddSource(const std::string& path) {
+
+	sources_.push_back(path);
+}
+
+void LevelCook::BeginArchetype(const std::string& name) {
+
+	++archetype_count_;
+	CloneReader::Append(archetypes_, name);
+
+	entity_count_at_ = archetypes_.size();
+	CloneReader::Append(archetypes_, uint32_t{ 0 });
+}
+
+void LevelCook::BeginEntity() {
+
+	Increment(entity_count_at_);
+
+	component_count_at_ = archetypes_.size();
+	CloneReader::Append(archetypes_, uint32_t{ 0 });
+}
+
+std::vector<unsigned char>* LevelCook::BeginComponent(ComponentTypes type) {
+
+	Increment(component_count_at_);
+	CloneReader::Append(archetypes_, static_cast<uint32_t>(type));
+
+	block_size_at_ = archetypes_.size();
+	CloneReader::Append(archetypes_, uint32_t{ 0 });
+
+	return &archetypes_;
+}
+
+void LevelCook::EndComponent() {
+
+	uint32_t size = static_cast<uint32_t>(archetypes_.size() - block_size_at_ - sizeof(uint32_t));
+	std::memcpy(archetypes_.data() + block_size_at_, &size, sizeof(size));
+}
+
+void LevelCache::Init(const std::string& directory) {
+
+	directory_ = directory;
+
+	std::error_code error;
+	std::filesystem::create_directories(directory_, error);
+}
+
+std::string LevelCache::GetCookedPath(const std::string& level_file) const {
+
+	std::stringstream path;
+	path << directory_ << "/" << std::hex << std::hash<std::string>{}(level_file) << ".lvl";
+	return path.str();
+}
+
+bool LevelCache::Load(const std::string& level_file, MappedFile& cooked, CloneReader& archetypes) const {
+
+	if (directory_.empty() || !cooked.Map(GetCookedPath(level_file))) {
+
+		return false;
+	}
+
+	CloneReader reader{ cooked.GetData(), cooked.GetSize() };
+
+	uint32_t magic = 0, version = 0, layout = 0, source_count = 0;
+	reader >> magic >> version >> layout >> source_count;
+
+	if (magic != magic_ || version != version_ || layout != CloneReader::layout_ || source_count == 0) {
+
+		cooked.Unmap();
+		return false;
+	}
+
+	// The level JSON comes first, then every entity file it lists
+	for (uint32_t i = 0; i < source_count; ++i) {
+
+		uint64_t hash = 0;
+		std::string path;
+		reader >> hash >> path;
+
+		if ((i == 0 && path != level_file) || HashFileContents(path) != hash) {
+
+			cooked.Unmap();
+			return false;
+		}
+	}
+
+	archetypes = reader;
+	return true;
+}
+
+void LevelCache::Save(const std::string& level_file, const LevelCook& cook) const {
+
+	if (directory_.empty()) {
+
+		return;
+	}
+
+	std::vector<unsigned char> data;
+	CloneReader::Append(data, magic_);
+	CloneReader::Append(data, version_);
+	CloneReader::Append(data, CloneReader::layout_);
+	CloneReader::Append(data, static_cast<uint32_t>(cook.GetSources().size()));
+
+	for (const std::string& source : cook.GetSources()) {
+
+		CloneReader::Append(data, HashFileContents(source));
+		CloneReader::Append(data, source);
+	}
+
+	CloneReader::Append(data, cook.GetArchetypeCount());
+	data.insert(data.end(), cook.GetArchetypes().begin(), cook.GetArchetypes().end());
+
+	if (!WriteFileAtomic(GetCookedPath(level_file), { { data.data(), data.size() } })) {
+
+		std::cout << "Failed to cook level : " << level_file << std::endl;
+	}
+}
@@ -0,0 +1,39 @@
+/**********************************************************************************
+*\file         LightBatch.cpp
+*\brief        Contains definition of functions and variables used for
+*			   packing lights into instance records
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#define _USE_MATH_DEFINES
+
+#include "Systems/LightBatch.h"
+#include <cassert>
+#include <cmath>
+
+void LightBatch::Init(size_t capacity) {
+
+	assert(capacity > 0);
+
+	instances_.resize(capacity);
+	count_ = 0;
+}
+
+bool LightBatch::Add(const glm::vec2& center, const glm::vec3& color, float intensity,
+					 float radius, const glm::vec2& direction, float angle) {
+
+	if (count_ == instances_.size()) {
+
+		return false;
+	}
+
+	instances_[count_++] = { center, direction, color, intensity, radius,
+							 static_cast<float>(angle / 180 * M_PI) };
+	return true;
+}
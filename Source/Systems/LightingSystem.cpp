@@ -15,6 +15,7 @@
 
 #include "Systems/LightingSystem.h"
 #include "Systems/GraphicsSystem.h"
+#include "Systems/Partitioning.h"
 #include "Engine/Core.h"
 #include "Systems/Debug.h"
 #include "Entity/ComponentTypes.h"
@@ -40,6 +41,7 @@ void LightingSystem::Init() {
 	windows_system_ = &*CORE->GetSystem<WindowsSystem>();
 	camera_system_ = &*CORE->GetSystem<CameraSystem>();
 	graphics_system_ = &*CORE->GetSystem<GraphicsSystem>();
+	partitioning_ = &*CORE->GetSystem<PartitioningSystem>();
 
 	win_size_.x = static_cast<float>(windows_system_->GetWinWidth());
 	win_size_.y = static_cast<float>(windows_system_->GetWinHeight());
@@ -49,16 +51,22 @@ void LightingSystem::Init() {
 	darkness_texture = texture_manager_->GetTexture("DarknessTexture")->GetTilesetHandle();
 
 	ShaderManager* shader_manager = &*CORE->GetManager<ShaderManager>();
-	lighting_shaders_["PointLightShader"] = shader_manager->AddShdrpgm("Shaders/point_light.vert",
-																	   "Shaders/point_light.frag",
-																	   "PointLightShader");
+	light_shaders_[PointSegment] = shader_manager->AddShdrpgm("Shaders/light_instanced.vert",
+															   "Shaders/point_light.frag",
+															   "PointLightShader");
 
-	lighting_shaders_["ConeLightShader"] = shader_manager->AddShdrpgm("Shaders/cone_light.vert",
-																	  "Shaders/cone_light.frag",
-																	  "ConeLightShader");
+	light_shaders_[ConeSegment] = shader_manager->AddShdrpgm("Shaders/light_instanced.vert",
+															  "Shaders/cone_light.frag",
+															  "ConeLightShader");
 
 
-	light_model_ = CORE->GetManager<ModelManager>()->AddTristripsModel(1, 1, "LightModel");
+	light_model_ = CORE->GetManager<ModelManager>()->AddInstancedLightModel(static_cast<int>(max_lights_),
+																			 SegmentCount, "LightModel");
+
+	for (int segment = 0; segment < SegmentCount; ++segment) {
+
+		light_batches_[segment].Init(max_lights_);
+	}
 
 	//Temporary before camera is component
 	std::shared_ptr<GraphicsSystem> graphics_system = CORE->GetSystem<GraphicsSystem>();
@@ -119,9 +127,15 @@ void LightingSystem::Update(float frametime) {
 	float cam_zoom = (*camera_system_->GetMainCamera()->GetCameraZoom());
 	glm::vec2 cam_pos = (*camera_system_->GetMainCamera()->GetCameraPosition());
 
+	LightBatch& point_batch = light_batches_[PointSegment];
+	LightBatch& cone_batch = light_batches_[ConeSegment];
+
+	point_batch.Clear();
+	cone_batch.Clear();
+
 	for (PointLightIt it = point_light_arr_->begin(); it != point_light_arr_->end(); ++it) {
 
-		if (!it->second->alive_)
+		if (!it->second->alive_ || !partitioning_->IsLightVisible(it->first))
 		{
 			continue;
 		}
@@ -132,11 +146,14 @@ void LightingSystem::Update(float frametime) {
 		}
 
 		UpdateLightPosition(it->second, cam_zoom, cam_pos);
+
+		PointLight* light = it->second;
+		point_batch.Add(light->pos_, light->color_, light->intensity_, light->radius_ * cam_zoom);
 	}
 
 	for (ConeLightIt it = cone_light_arr_->begin(); it != cone_light_arr_->end(); ++it) {
 
-		if (!it->second->alive_)
+		if (!it->second->alive_ || !partitioning_->IsLightVisible(it->first))
 		{
 			continue;
 		}
@@ -147,6 +164,11 @@ void LightingSystem::Update(float frametime) {
 		}
 
 		UpdateLightPosition(it->second, cam_zoom, cam_pos);
+		UpdateLightDirection(it->second);
+
+		ConeLight* light = it->second;
+		cone_batch.Add(light->pos_, light->color_, light->intensity_, light->radius_ * cam_zoom,
+					   light->direction_, light->angle_);
 	}
 }
 
@@ -164,45 +186,10 @@ void LightingSystem::Draw() {
 	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-	float cam_zoom = (*camera_system_->GetMainCamera()->GetCameraZoom());
-	
-	Shader* point_light_shader = lighting_shaders_["PointLightShader"];
-	Shader* cone_light_shader = lighting_shaders_["ConeLightShader"];
-
 	glBindVertexArray(light_model_->vaoid_);
-	cone_light_shader->Use();
-
-	for (ConeLightIt it = cone_light_arr_->begin(); it != cone_light_arr_->end(); ++it) {
-
-		if (!it->second->alive_)
-		{
-			continue;
-		}
-
-		if (debug_) {
-			// Log id of entity and its updated components that are being updated
-			M_DEBUG->WriteDebugMessage("Drawing cone light for entity: " + std::to_string(it->first) + "\n");
-		}
-
-		DrawConeLight(cone_light_shader, it->second, cam_zoom);
-	}
-
-	point_light_shader->Use();
-
-	for (PointLightIt it = point_light_arr_->begin(); it != point_light_arr_->end(); ++it) {
-
-		if (!it->second->alive_)
-		{
-			continue;
-		}
 
-		if (debug_) {
-			// Log id of entity and its updated components that are being updated
-			M_DEBUG->WriteDebugMessage("Drawing point light for entity: " + std::to_string(it->first) + "\n");
-		}
-
-		DrawPointLight(point_light_shader, it->second, cam_zoom);
-	}
+	DrawLightBatch(ConeSegment);
+	DrawLightBatch(PointSegment);
 
 	glBindFramebuffer(GL_FRAMEBUFFER, lighting_buffer);
 	glClear(GL_COLOR_BUFFER_BIT);
@@ -264,45 +251,43 @@ void LightingSystem::UpdateLightPosition(ConeLight* cone_light, float cam_zoom,
 					   (cam_pos * cam_zoom + 0.5f * win_size_);
 }
 
-void LightingSystem::DrawPointLight(Shader* shader, PointLight* point_light, float cam_zoom) {
-
-	shader->SetUniform("light_color", point_light->color_);
-	shader->SetUniform("light_center", point_light->pos_);
-	shader->SetUniform("intensity", point_light->intensity_);
-	shader->SetUniform("radius", point_light->radius_ * cam_zoom);
-
-	glDrawElements(GL_TRIANGLE_STRIP, light_model_->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
-}
-
-void LightingSystem::DrawConeLight(Shader* shader, ConeLight* cone_light, float cam_zoom) {
+void LightingSystem::UpdateLightDirection(ConeLight* cone_light) {
 
 	Motion* motion =
 		component_manager_->GetComponent<Motion>(cone_light->GetOwner()->GetID());
 
 	if (motion == nullptr)
 	{
-		M_DEBUG->WriteDebugMessage("Cannot draw cone light as entity has no motion component");
+		M_DEBUG->WriteDebugMessage("Cannot point cone light as entity has no motion component");
+		return;
 	}
 
-	else
+	Vector2D direction = motion->GetVelocity();
+
+	// A light that stops keeps facing the way it last moved
+	if (Vector2DLength(direction) > 0.0f)
 	{
-		Vector2D direction = motion->GetVelocity();
+		cone_light->direction_ = glm::vec2{ direction.x, direction.y };
+	}
+}
 
-		if (Vector2DLength(direction) > 0.0f)
-		{
-			cone_light->direction_ = glm::vec2{ direction.x, direction.y };
-		}
+void LightingSystem::DrawLightBatch(LightSegment segment) {
+
+	LightBatch& batch = light_batches_[segment];
+
+	if (batch.Count() == 0) {
+
+		return;
 	}
 
-	Vector2D direction = motion->GetVelocity();
-	shader->SetUniform("light_color", cone_light->color_);
-	shader->SetUniform("light_center", cone_light->pos_);
-	shader->SetUniform("intensity", cone_light->intensity_);
-	shader->SetUniform("radius", cone_light->radius_ * cam_zoom);
-	shader->SetUniform("direction", cone_light->direction_);
-	shader->SetUniform("angle", static_cast<float>(cone_light->angle_ / 180 * M_PI));
-
-	glDrawElements(GL_TRIANGLE_STRIP, light_model_->draw_cnt_, GL_UNSIGNED_SHORT, NULL);
+	light_shaders_[segment]->Use();
+
+	glNamedBufferSubData(light_model_->vboid_, segment * max_lights_ * sizeof(LightBatch::Instance),
+						 batch.Bytes(), batch.Data());
+
+	glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, light_model_->draw_cnt_,
+									  static_cast<GLsizei>(batch.Count()),
+									  static_cast<GLuint>(segment * max_lights_));
 }
 
 std::string LightingSystem::GetName() {
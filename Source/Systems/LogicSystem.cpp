@@ -13,24 +13,274 @@
 #include "Systems/LogicSystem.h"
 #include "Manager/ForcesManager.h"
 #include "Systems/Debug.h"
+#include "Systems/GraphicsSystem.h"
+#include "Manager/AMap.h"
+#include "Script/ScriptList.h"
+#include "Systems/Factory.h"
 #include "Engine/Core.h"
+#include "MathLib/Random.h"
+#include <algorithm>
+#include <thread>
 
 void LogicSystem::Init()
 {
 	comp_mgr = &*CORE->GetManager<ComponentManager>();
 
 	ai_arr_ = comp_mgr->GetComponentArray<AI>();
+
+	ForcesManager* forces = &*CORE->GetManager<ForcesManager>();
+	commands_.Bind(&*CORE->GetSystem<GraphicsSystem>(), forces, &*CORE->GetManager<AMap>());
+
+	context_ = {};
+	context_.commands_ = &commands_;
+	context_.movement_force_ = forces->GetForceID("movement");
+
+	tick_count_ = 0;
+	DeSerialize();
+}
+
+void LogicSystem::DeSerialize()
+{
+	const rapidjson::Document& doc = DeSerializeJSON("Resources/EntityConfig/ai.json");
+
+	const rapidjson::Value& value_arr = doc["AI"];
+	DEBUG_ASSERT(value_arr.IsArray(), "Entry does not exist in JSON");
+
+	//stores the data into a stream that is easier to read data from
+	std::stringstream stream;
+
+	for (rapidjson::Value::ConstValueIterator it = value_arr.Begin(); it != value_arr.End(); ++it) {
+
+		const rapidjson::Value& member = *it;
+		DEBUG_ASSERT(member.IsObject(), "Entry does not exist in JSON");
+
+		for (rapidjson::Value::ConstMemberIterator it2 = member.MemberBegin(); it2 != member.MemberEnd(); ++it2) {
+
+			stream << it2->value.GetString() << " ";
+		}
+	}
+
+	float near_range, mid_range;
+	uint32_t near_rate, mid_rate, far_rate;
+	bool parallel;
+	size_t batch_size;
+
+	stream >> near_range >> mid_range >> near_rate >> mid_rate >> far_rate >> tick_budget_
+		   >> parallel >> batch_size;
+
+	SetParallel(parallel, batch_size);
+
+	SetLod(Behaviour::NearLod, near_range, near_rate);
+	SetLod(Behaviour::MidLod, mid_range, mid_rate);
+	SetLod(Behaviour::FarLod, 0.0f, far_rate);
+}
+
+void LogicSystem::SetLod(Behaviour::TickLod lod, float range, uint32_t rate)
+{
+	DEBUG_ASSERT((lod < Behaviour::LodCount), "Invalid level of detail");
+
+	if (lod < Behaviour::FarLod)
+		lod_range_[lod] = range;
+
+	lod_rate_[lod] = (std::max)(rate, 1u);
+}
+
+void LogicSystem::SetParallel(bool parallel, size_t batch_size)
+{
+	parallel_ = parallel;
+	batch_size_ = (std::max)(batch_size, static_cast<size_t>(1));
+
+	// The main thread takes a batch of its own. Each worker draws from a stream
+	// of its own after the main thread's, so replays are deterministic
+	if (parallel_ && !workers_.GetWorkerCount())
+		workers_.Init((std::max)(std::thread::hardware_concurrency(), 2u) - 1,
+			[](size_t worker) { SetRandomStream(static_cast<uint32_t>(worker) + 1); });
+}
+
+Behaviour::TickLod LogicSystem::ComputeLod(const Behaviour::Agent& agent) const
+{
+	if (!agent.board_.transform_)
+		return Behaviour::NearLod;
+
+	float distance = Vector2DDistance(context_.player_transform_->GetOffsetAABBPos(),
+									  agent.board_.transform_->GetOffsetAABBPos());
+
+	if (distance < lod_range_[Behaviour::NearLod])
+		return Behaviour::NearLod;
+	if (distance < lod_range_[Behaviour::MidLod])
+		return Behaviour::MidLod;
+	return Behaviour::FarLod;
+}
+
+bool LogicSystem::IsDue(const Behaviour::Agent& agent) const
+{
+	// A skipped tick is made up for as soon as possible
+	if (tick_count_ - agent.last_tick_ > lod_rate_[agent.lod_])
+		return true;
+
+	return (tick_count_ + static_cast<uint32_t>(agent.id_)) % lod_rate_[agent.lod_] == 0;
+}
+
+const Behaviour::Tree* LogicSystem::GetTree(AI::AIType type, int level)
+{
+	for (std::unique_ptr<TreeGroup>& group : groups_) {
+		if (group->type_ == type && group->level_ == level)
+			return &group->tree_;
+	}
+
+	std::unique_ptr<TreeGroup> group = std::make_unique<TreeGroup>();
+	group->type_ = type;
+	group->level_ = level;
+
+	switch (type)
+	{
+	case AI::StagBeetle:
+		Stag_Tree::Build(group->tree_, level);
+		break;
+	case AI::Mite:
+		Mite_Tree::Build(group->tree_, level);
+		break;
+	default:
+		return nullptr;
+	}
+
+	groups_.push_back(std::move(group));
+	return &groups_.back()->tree_;
+}
+
+bool LogicSystem::UpdateContext()
+{
+	Entity* player = CORE->GetManager<EntityManager>()->GetPlayerEntities();
+
+	if (!player)
+		return false;
+
+	context_.player_id_ = player->GetID();
+	context_.player_status_ = comp_mgr->GetComponent<Status>(context_.player_id_);
+	context_.player_transform_ = comp_mgr->GetComponent<Transform>(context_.player_id_);
+
+	return context_.player_status_ && context_.player_transform_;
 }
 
 void LogicSystem::Update(float frametime)
 {
 	(void)frametime;
+
+	if (!UpdateContext())
+		return;
+
+	++tick_count_;
+	due_.clear();
+
+	// Collect the agents due this step at their current level of detail
 	for (AIIt ai = ai_arr_->begin(); ai != ai_arr_->end(); ++ai) {
 
-		// Run AI Behaviour Tree
-		if(ai->second->root_)
-			ai->second->root_->run();
+		if (!ai->second->tree_)
+			continue;
+
+		Behaviour::Agent& agent = ai->second->agent_;
+		agent.lod_ = ComputeLod(agent);
+
+		// New agents are scheduled as if ticked on the previous step
+		if (agent.last_tick_ == UINT32_MAX)
+			agent.last_tick_ = tick_count_ - 1;
+
+		if (IsDue(agent))
+			due_.push_back(ai->second);
+	}
+
+	// Over budget, keep the agents that waited the longest for their level of
+	// detail, nearest first when they waited as long. A skipped agent waits
+	// longer on every step, so every agent is eventually ticked
+	if (tick_budget_ && due_.size() > tick_budget_) {
+
+		std::nth_element(due_.begin(), due_.begin() + tick_budget_, due_.end(),
+			[this](AI* lhs, AI* rhs) {
+				const Behaviour::Agent& l = lhs->agent_;
+				const Behaviour::Agent& r = rhs->agent_;
+
+				// Compares the steps waited as a fraction of each agent's rate
+				uint64_t l_waited = static_cast<uint64_t>(tick_count_ - l.last_tick_) * lod_rate_[r.lod_];
+				uint64_t r_waited = static_cast<uint64_t>(tick_count_ - r.last_tick_) * lod_rate_[l.lod_];
+
+				if (l_waited != r_waited)
+					return l_waited > r_waited;
+				if (l.lod_ != r.lod_)
+					return l.lod_ < r.lod_;
+				return l.id_ < r.id_;
+			});
+
+		due_.resize(tick_budget_);
+	}
+
+	for (std::unique_ptr<TreeGroup>& group : groups_)
+		group->agents_.clear();
+
+	// Bucket agents by the tree they share
+	for (AI* ai : due_) {
+
+		// Forces last for the time since the agent's last tick
+		Behaviour::Agent& agent = ai->agent_;
+		agent.tick_delta_ = PE_FrameRate.GetFixedDelta() * (tick_count_ - agent.last_tick_);
+		agent.last_tick_ = tick_count_;
+
+		for (std::unique_ptr<TreeGroup>& group : groups_) {
+			if (&group->tree_ == ai->tree_) {
+				group->agents_.push_back(ai);
+				break;
+			}
+		}
+	}
+
+	// Agents of a tree are ticked in entity order so results do not depend on
+	// the order of the component map
+	order_.clear();
+	for (std::unique_ptr<TreeGroup>& group : groups_) {
+
+		std::sort(group->agents_.begin(), group->agents_.end(),
+			[](AI* lhs, AI* rhs) { return lhs->agent_.id_ < rhs->agent_.id_; });
+
+		order_.insert(order_.end(), group->agents_.begin(), group->agents_.end());
 	}
+
+	if (parallel_ && order_.size() >= batch_size_ * 2) {
+		TickParallel();
+		return;
+	}
+
+	// Run AI Behaviour Tree, one tree type at a time
+	for (AI* ai : order_)
+		ai->tree_->Tick(ai->agent_, context_);
+}
+
+void LogicSystem::TickParallel()
+{
+	size_t batches = (std::min)(workers_.GetWorkerCount() + 1, order_.size() / batch_size_);
+	size_t per_batch = (order_.size() + batches - 1) / batches;
+
+	while (batch_commands_.size() < batches) {
+
+		batch_commands_.push_back(commands_);
+		batch_commands_.back().SetDeferred(true);
+	}
+
+	std::function<void(size_t)> tick_batch = [this, per_batch](size_t batch) {
+
+		Behaviour::Context context = context_;
+		context.commands_ = &batch_commands_[batch];
+
+		size_t end = (std::min)((batch + 1) * per_batch, order_.size());
+
+		for (size_t i = batch * per_batch; i < end; ++i)
+			order_[i]->tree_->Tick(order_[i]->agent_, context);
+	};
+
+	// The main thread takes the first batch
+	workers_.Run(batches, tick_batch);
+
+	// Commands are applied in the same agent order as a serial tick
+	for (size_t batch = 0; batch < batches; ++batch)
+		batch_commands_[batch].Flush();
 }
 
 void LogicSystem::Draw()
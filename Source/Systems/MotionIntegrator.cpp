@@ -0,0 +1,204 @@
+/**********************************************************************************
+*\file         MotionIntegrator.cpp
+*\brief        Contains definition of functions and variables used for the
+*			   batched Motion/Transform integrator
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Systems/MotionIntegrator.h"
+
+#if defined(PE_MOTION_AVX)
+#include <immintrin.h>
+#elif defined(PE_MOTION_SSE)
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+	// Must match VerifyZeroFloat and the damping used by Physics
+	constexpr float snap_epsilon = 0.001f;
+	constexpr float damping = 0.80f;
+
+	// Arrays are padded to a multiple of the widest register
+	constexpr size_t batch_padding = 8;
+}
+
+void MotionBatch::Clear() {
+
+	size_ = 0;
+	motions_.clear();
+	transforms_.clear();
+}
+
+void MotionBatch::Reserve(size_t count) {
+
+	size_t padded = (count + batch_padding - 1) / batch_padding * batch_padding;
+
+	if (pos_x_.size() >= padded)
+		return;
+
+	for (std::vector<float>* arr : { &pos_x_, &pos_y_, &vel_x_, &vel_y_, &acc_x_, &acc_y_,
+									 &force_x_, &force_y_, &inv_mass_, &cos_, &sin_ }) {
+
+		arr->resize(padded);
+	}
+
+	motions_.reserve(padded);
+	transforms_.reserve(padded);
+}
+
+size_t MotionBatch::Push(Motion* motion, Transform* transform) {
+
+	Reserve(size_ + 1);
+
+	motions_.push_back(motion);
+	transforms_.push_back(transform);
+
+	return size_++;
+}
+
+void IntegrateMotionScalar(MotionBatch& batch, size_t begin, size_t end, float frametime) {
+
+	for (size_t i = begin; i < end; ++i) {
+
+		// a = F / m
+		float ax = batch.force_x_[i] * batch.inv_mass_[i];
+		float ay = batch.force_y_[i] * batch.inv_mass_[i];
+		batch.acc_x_[i] = ax;
+		batch.acc_y_[i] = ay;
+
+		// Change in velocity, rotated for particles
+		float dx = ax * frametime;
+		float dy = ay * frametime;
+		float rx = (batch.cos_[i] * dx) + (-batch.sin_[i] * dy);
+		float ry = (batch.sin_[i] * dx) + (batch.cos_[i] * dy);
+
+		float vx = (batch.vel_x_[i] + rx) * damping;
+		float vy = (batch.vel_y_[i] + ry) * damping;
+
+		// If velocity is close to 0, reset to 0
+		if (vx > -snap_epsilon && vx < snap_epsilon)
+			vx = 0.0f;
+		if (vy > -snap_epsilon && vy < snap_epsilon)
+			vy = 0.0f;
+
+		batch.vel_x_[i] = vx;
+		batch.vel_y_[i] = vy;
+
+		batch.pos_x_[i] += vx * frametime;
+		batch.pos_y_[i] += vy * frametime;
+	}
+}
+
+#if defined(PE_MOTION_AVX)
+
+static size_t IntegrateMotionWide(MotionBatch& batch, float frametime) {
+
+	const __m256 dt = _mm256_set1_ps(frametime);
+	const __m256 damp = _mm256_set1_ps(damping);
+	const __m256 pos_eps = _mm256_set1_ps(snap_epsilon);
+	const __m256 neg_eps = _mm256_set1_ps(-snap_epsilon);
+
+	size_t i = 0;
+
+	for (; i + 8 <= batch.size_; i += 8) {
+
+		__m256 inv_mass = _mm256_loadu_ps(&batch.inv_mass_[i]);
+		__m256 ax = _mm256_mul_ps(_mm256_loadu_ps(&batch.force_x_[i]), inv_mass);
+		__m256 ay = _mm256_mul_ps(_mm256_loadu_ps(&batch.force_y_[i]), inv_mass);
+		_mm256_storeu_ps(&batch.acc_x_[i], ax);
+		_mm256_storeu_ps(&batch.acc_y_[i], ay);
+
+		__m256 dx = _mm256_mul_ps(ax, dt);
+		__m256 dy = _mm256_mul_ps(ay, dt);
+		__m256 c = _mm256_loadu_ps(&batch.cos_[i]);
+		__m256 s = _mm256_loadu_ps(&batch.sin_[i]);
+		__m256 neg_s = _mm256_sub_ps(_mm256_setzero_ps(), s);
+		__m256 rx = _mm256_add_ps(_mm256_mul_ps(c, dx), _mm256_mul_ps(neg_s, dy));
+		__m256 ry = _mm256_add_ps(_mm256_mul_ps(s, dx), _mm256_mul_ps(c, dy));
+
+		__m256 vx = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&batch.vel_x_[i]), rx), damp);
+		__m256 vy = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&batch.vel_y_[i]), ry), damp);
+
+		__m256 snap_x = _mm256_and_ps(_mm256_cmp_ps(vx, neg_eps, _CMP_GT_OQ), _mm256_cmp_ps(vx, pos_eps, _CMP_LT_OQ));
+		__m256 snap_y = _mm256_and_ps(_mm256_cmp_ps(vy, neg_eps, _CMP_GT_OQ), _mm256_cmp_ps(vy, pos_eps, _CMP_LT_OQ));
+		vx = _mm256_andnot_ps(snap_x, vx);
+		vy = _mm256_andnot_ps(snap_y, vy);
+
+		_mm256_storeu_ps(&batch.vel_x_[i], vx);
+		_mm256_storeu_ps(&batch.vel_y_[i], vy);
+
+		_mm256_storeu_ps(&batch.pos_x_[i], _mm256_add_ps(_mm256_loadu_ps(&batch.pos_x_[i]), _mm256_mul_ps(vx, dt)));
+		_mm256_storeu_ps(&batch.pos_y_[i], _mm256_add_ps(_mm256_loadu_ps(&batch.pos_y_[i]), _mm256_mul_ps(vy, dt)));
+	}
+
+	return i;
+}
+
+#elif defined(PE_MOTION_SSE)
+
+static size_t IntegrateMotionWide(MotionBatch& batch, float frametime) {
+
+	const __m128 dt = _mm_set1_ps(frametime);
+	const __m128 damp = _mm_set1_ps(damping);
+	const __m128 pos_eps = _mm_set1_ps(snap_epsilon);
+	const __m128 neg_eps = _mm_set1_ps(-snap_epsilon);
+
+	size_t i = 0;
+
+	for (; i + 4 <= batch.size_; i += 4) {
+
+		__m128 inv_mass = _mm_loadu_ps(&batch.inv_mass_[i]);
+		__m128 ax = _mm_mul_ps(_mm_loadu_ps(&batch.force_x_[i]), inv_mass);
+		__m128 ay = _mm_mul_ps(_mm_loadu_ps(&batch.force_y_[i]), inv_mass);
+		_mm_storeu_ps(&batch.acc_x_[i], ax);
+		_mm_storeu_ps(&batch.acc_y_[i], ay);
+
+		__m128 dx = _mm_mul_ps(ax, dt);
+		__m128 dy = _mm_mul_ps(ay, dt);
+		__m128 c = _mm_loadu_ps(&batch.cos_[i]);
+		__m128 s = _mm_loadu_ps(&batch.sin_[i]);
+		__m128 neg_s = _mm_sub_ps(_mm_setzero_ps(), s);
+		__m128 rx = _mm_add_ps(_mm_mul_ps(c, dx), _mm_mul_ps(neg_s, dy));
+		__m128 ry = _mm_add_ps(_mm_mul_ps(s, dx), _mm_mul_ps(c, dy));
+
+		__m128 vx = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&batch.vel_x_[i]), rx), damp);
+		__m128 vy = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&batch.vel_y_[i]), ry), damp);
+
+		__m128 snap_x = _mm_and_ps(_mm_cmpgt_ps(vx, neg_eps), _mm_cmplt_ps(vx, pos_eps));
+		__m128 snap_y = _mm_and_ps(_mm_cmpgt_ps(vy, neg_eps), _mm_cmplt_ps(vy, pos_eps));
+		vx = _mm_andnot_ps(snap_x, vx);
+		vy = _mm_andnot_ps(snap_y, vy);
+
+		_mm_storeu_ps(&batch.vel_x_[i], vx);
+		_mm_storeu_ps(&batch.vel_y_[i], vy);
+
+		_mm_storeu_ps(&batch.pos_x_[i], _mm_add_ps(_mm_loadu_ps(&batch.pos_x_[i]), _mm_mul_ps(vx, dt)));
+		_mm_storeu_ps(&batch.pos_y_[i], _mm_add_ps(_mm_loadu_ps(&batch.pos_y_[i]), _mm_mul_ps(vy, dt)));
+	}
+
+	return i;
+}
+
+#else
+
+static size_t IntegrateMotionWide(MotionBatch& batch, float frametime) {
+
+	(void)batch;
+	(void)frametime;
+	return 0;
+}
+
+#endif
+
+void IntegrateMotion(MotionBatch& batch, float frametime) {
+
+	size_t done = IntegrateMotionWide(batch, frametime);
+	IntegrateMotionScalar(batch, done, batch.size_, frametime);
+}
@@ -25,7 +25,10 @@ void PartitioningSystem::Init() {
 	transform_map_ = component_manager_->GetComponentArray<Transform>();
 	texture_map_ = component_manager_->GetComponentArray<TextureRenderer>();
 	animation_map_ = component_manager_->GetComponentArray<AnimationRenderer>();
+	point_light_map_ = component_manager_->GetComponentArray<PointLight>();
+	cone_light_map_ = component_manager_->GetComponentArray<ConeLight>();
 	grid_size_ = 4;
+	visibility_valid_ = false;
 
 	InitPartition();
 }
@@ -45,6 +48,8 @@ void PartitioningSystem::InitPartition() {
 	y_.resize( static_cast<int>(y) );
 	renderer_x_.resize(static_cast<int>(x));
 	renderer_y_.resize(static_cast<int>(y));
+	light_x_.resize(static_cast<int>(x));
+	light_y_.resize(static_cast<int>(y));
 
 	abs_bottom_left_.x = abs_bottom_left_.x < 0 ? (-abs_bottom_left_.x) : abs_bottom_left_.x;
 	abs_bottom_left_.y = abs_bottom_left_.y < 0 ? (-abs_bottom_left_.y) : abs_bottom_left_.y;
@@ -56,6 +61,7 @@ void PartitioningSystem::Update(float frametime) {
 
 	// Resets all the bits
 	ResetPartition();
+	visibility_valid_ = false;
 
 	if (x_.size() < 1 || y_.size() < 1)
 		return;
@@ -81,6 +87,18 @@ void PartitioningSystem::Update(float frametime) {
 		if (animation->IsAlive())
 			InitRendererInPartition(id);
 	}
+
+	for (auto& [id, light] : *point_light_map_) {
+
+		if (light->GetAlive())
+			InitLightInPartition(id, light->GetRadius());
+	}
+
+	for (auto& [id, light] : *cone_light_map_) {
+
+		if (light->GetAlive())
+			InitLightInPartition(id, light->GetRadius());
+	}
 	
 	ComputePartitionedEntities();
 
@@ -152,6 +170,17 @@ void PartitioningSystem::ResetPartition() {
 		
 		y.reset();
 	}
+
+	for (PartitionAxis* axis : { &renderer_x_, &renderer_y_, &light_x_, &light_y_ }) {
+
+		for (Bitset& bits : *axis) {
+
+			bits.reset();
+		}
+	}
+
+	partitioned_renderers_.reset();
+	partitioned_lights_.reset();
 }
 
 void PartitioningSystem::GetPartitionedEntities(std::vector<AABBMapIt>& vec, size_t x, size_t y) {
@@ -213,12 +242,24 @@ const PartitioningSystem::EntityIDSet& PartitioningSystem::GetActiveEntityIDs()
 	return id_set_;
 }
 
+bool PartitioningSystem::IsRendererVisible(EntityID id) const {
+
+	// Renderers that were never partitioned have no bounds to cull against
+	return !visibility_valid_ || id >= visible_renderers_.size() ||
+		   !partitioned_renderers_.test(id) || visible_renderers_.test(id);
+}
+
+bool PartitioningSystem::IsLightVisible(EntityID id) const {
+
+	return !visibility_valid_ || id >= visible_lights_.size() ||
+		   !partitioned_lights_.test(id) || visible_lights_.test(id);
+}
+
 
 // Call this function every loop
 void PartitioningSystem::ComputePartitionedEntities() {
 
 	float inv_cam_zoom{};
-	Bitset all_entities{};
 	Vector2D bottom_left{}, top_right{}, camera_pos{};
 	My::Vector2D<size_t> my_bottom_left{}, my_top_right{};
 	Camera* camera = nullptr;
@@ -250,42 +291,52 @@ void PartitioningSystem::ComputePartitionedEntities() {
 	// Convert the positions to grid coordinates (Divide by PartitionScale)
 	ComputePartitionBoundaries(bottom_left, top_right);
 
-	// Cast to size_t
-	my_bottom_left.x = static_cast<size_t>(bottom_left.x);
-	my_bottom_left.y = static_cast<size_t>(bottom_left.y);
-	my_top_right.x = static_cast<size_t>(top_right.x);
-	my_top_right.y = static_cast<size_t>(top_right.y);
-
-	// Iterate through partition boundaries to determine all entities that lie within
-	for (size_t i = my_bottom_left.y; i < my_top_right.y; ++i) {
-		for (size_t j = my_bottom_left.x; j < my_top_right.x; ++j) {
-
-			if (i >= renderer_y_.size() || j >= renderer_x_.size()) {
-				
-				M_DEBUG->WriteDebugMessage("Partitioning Bitset: " + 
-					std::to_string(renderer_x_.size()) + " " + 
-					std::to_string(renderer_y_.size()) + "\n");
-				return;
-			}
-		
-			// Perform an & to determine common entities within both areas
-			// To allow for checking of values
-			Bitset x = renderer_x_[j];
-			Bitset y = renderer_y_[i];
-			all_entities |= x & y;
-		}
-	}
+	// Renderers and lights past the edges are kept in the edge cells, so the view is
+	// clamped to the grid instead of being rejected
+	my_bottom_left.x = static_cast<size_t>((std::max)(bottom_left.x, 0.0f));
+	my_bottom_left.y = static_cast<size_t>((std::max)(bottom_left.y, 0.0f));
+	my_top_right.x = (std::min)(static_cast<size_t>((std::max)(top_right.x, 1.0f)), renderer_x_.size());
+	my_top_right.y = (std::min)(static_cast<size_t>((std::max)(top_right.y, 1.0f)), renderer_y_.size());
+
+	if (my_bottom_left.x >= renderer_x_.size())
+		my_bottom_left.x = renderer_x_.size() - 1;
+	if (my_bottom_left.y >= renderer_y_.size())
+		my_bottom_left.y = renderer_y_.size() - 1;
+
+	visible_renderers_ = GetVisibleInAxes(renderer_x_, renderer_y_, my_bottom_left, my_top_right);
+	visible_lights_ = GetVisibleInAxes(light_x_, light_y_, my_bottom_left, my_top_right);
+	visibility_valid_ = true;
 
 	// If an EntityID is set, insert it's ID into the std::set to be marked as active
-	for (size_t i = 0; i < all_entities.size(); ++i) {
+	for (size_t i = 0; i < visible_renderers_.size(); ++i) {
 		
-		if (all_entities.test(i)) {
+		if (visible_renderers_.test(i)) {
 
 			id_set_.insert(i);
 		}
 	}
 }
 
+PartitioningSystem::Bitset PartitioningSystem::GetVisibleInAxes(const PartitionAxis& x_axis, const PartitionAxis& y_axis,
+	const My::Vector2D<size_t>& bottom_left, const My::Vector2D<size_t>& top_right) const {
+
+	Bitset x{}, y{};
+
+	// An entity is within the view if it is in any of its columns and any of its
+	// rows, which only needs one pass over each axis instead of every cell
+	for (size_t j = bottom_left.x; j < top_right.x; ++j) {
+
+		x |= x_axis[j];
+	}
+
+	for (size_t i = bottom_left.y; i < top_right.y; ++i) {
+
+		y |= y_axis[i];
+	}
+
+	return x & y;
+}
+
 void PartitioningSystem::ComputeBoundaries(const Vector2D& camera_pos, const float& camera_zoom, Vector2D& bottom_left, Vector2D& top_right) {
 
 	WindowsSystem* windows = &*CORE->GetSystem<WindowsSystem>();
@@ -376,35 +427,60 @@ void PartitioningSystem::InitEntityInPartition(const EntityID& id) {
 
 void PartitioningSystem::InitRendererInPartition(const EntityID& id) {
 
-	Vector2D pos{}, min{}, max{};
 	Transform* xform = component_manager_->GetComponent<Transform>(id);
 	Scale* scale = component_manager_->GetComponent<Scale>(id);
 
-	if (!xform || !scale) return;
+	if (!xform || !scale || id >= partitioned_renderers_.size()) return;
 
-	// Computing the position of the entity
-	pos.x = xform->GetOffsetAABBPos().x + abs_bottom_left_.x;
-	pos.y = xform->GetOffsetAABBPos().y + abs_bottom_left_.y;
+	SetBoundsInPartition(renderer_x_, renderer_y_, id, xform->GetOffsetAABBPos(), scale->GetScale());
+	partitioned_renderers_.set(id);
+}
+
+void PartitioningSystem::InitLightInPartition(const EntityID& id, float radius) {
 
-	Vector2D texture_scale_ = scale->GetScale();
+	Transform* xform = component_manager_->GetComponent<Transform>(id);
+
+	if (!xform || id >= partitioned_lights_.size()) return;
+
+	// Light radius is in world scale
+	float game_radius = radius / CORE->GetGlobalScale();
+
+	SetBoundsInPartition(light_x_, light_y_, id, xform->GetOffsetAABBPos(), { game_radius, game_radius });
+	partitioned_lights_.set(id);
+}
+
+void PartitioningSystem::SetBoundsInPartition(PartitionAxis& x_axis, PartitionAxis& y_axis, const EntityID& id,
+											  const Vector2D& pos, const Vector2D& half_extent) {
+
+	if (id >= Bitset{}.size() || x_axis.empty() || y_axis.empty())
+		return;
+
+	Vector2D min{}, max{};
 
 	// Computing the min and max pos of the entity
-	min.x = (pos.x - texture_scale_.x) / grid_size_;
+	min.x = (pos.x + abs_bottom_left_.x - half_extent.x) / grid_size_;
 	RoundDown(min.x);
-	min.y = (pos.y - texture_scale_.y) / grid_size_;
+	min.y = (pos.y + abs_bottom_left_.y - half_extent.y) / grid_size_;
 	RoundDown(min.y);
-	max.x = (pos.x + texture_scale_.x) / grid_size_;
+	max.x = (pos.x + abs_bottom_left_.x + half_extent.x) / grid_size_;
 	RoundUp(max.x);
-	max.y = (pos.y + texture_scale_.y) / grid_size_;
+	max.y = (pos.y + abs_bottom_left_.y + half_extent.y) / grid_size_;
 	RoundUp(max.y);
 
+	// Anything past the edges of the grid is kept in the edge cells
+	int last_x = static_cast<int>(x_axis.size()) - 1;
+	int last_y = static_cast<int>(y_axis.size()) - 1;
+
+	int min_x = (std::clamp)(static_cast<int>(min.x), 0, last_x);
+	int min_y = (std::clamp)(static_cast<int>(min.y), 0, last_y);
+	int max_x = (std::clamp)(static_cast<int>(max.x), min_x + 1, last_x + 1);
+	int max_y = (std::clamp)(static_cast<int>(max.y), min_y + 1, last_y + 1);
+
 	// Setting the bits for the grid based on entity location
-	for (int j = static_cast<int>(min.x); j < max.x; ++j) {
-		if (j >= 0 && j < renderer_x_.size())
-			renderer_x_[j].set(id);
+	for (int j = min_x; j < max_x; ++j) {
+		x_axis[j].set(id);
 	}
-	for (int i = static_cast<int>(min.y); i < max.y; ++i) {
-		if (i >= 0 && i < renderer_y_.size())
-			renderer_y_[i].set(id);
+	for (int i = min_y; i < max_y; ++i) {
+		y_axis[i].set(id);
 	}
-}
\ No newline at end of file
+}
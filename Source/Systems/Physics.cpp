@@ -27,19 +27,6 @@ bool VerifyZeroFloat(const float& val) {
 	return false;
 }
 
-auto SnapZero = [](Vector2D& vec) {
-
-	if (VerifyZeroFloat(vec.x)) {
-
-		vec.x = 0.0f;
-	}
-
-	if (VerifyZeroFloat(vec.y)) {
-
-		vec.y = 0.0f;
-	}
-};
-
 Physics::Physics() {
 
 	debug_ = false;
@@ -60,6 +47,8 @@ void Physics::Init() {
 	force_mgr = &*CORE->GetManager<ForcesManager>();
 	component_mgr_ = &*CORE->GetManager<ComponentManager>();
 	logic_mgr_ = &*CORE->GetManager<LogicManager>();
+	entity_mgr_ = &*CORE->GetManager<EntityManager>();
+	player_name_ = NameTable::Intern("Player");
 	graphics_sys_ = &*CORE->GetSystem<GraphicsSystem>();
 }
 
@@ -71,29 +60,41 @@ void Physics::Update(float frametime) {
 		
 	force_mgr->Update(frametime);
 
-	// Updating entity's velocity
+	// Gather every live body into the packed batch
+	batch_.Clear();
+	batch_.Reserve(motion_arr_->size());
+
 	for (MotionIt motion = motion_arr_->begin(); motion != motion_arr_->end(); ++motion) {
 
 		if (!motion->second->alive_)
 			continue;
 
 		Transform* xform = transform_arr_->GetComponent(motion->first);
-		Particle* particle = component_mgr_->GetComponent<Particle>(motion->first);
+		Particle* particle = particle_arr_->GetComponent(motion->first);
+
+		size_t i = batch_.Push(motion->second, xform);
+		Vector2D force = force_mgr->GetForce(motion->second->force_slot_, motion->first);
 
-		// Perform update of entity's motion component
-		Vector2D new_vel{};
-		motion->second->acceleration_ = force_mgr->GetForce(motion->second->GetOwner()->GetID()) * motion->second->inv_mass_;
-		new_vel += motion->second->acceleration_ * frametime;
+		batch_.force_x_[i] = force.x;
+		batch_.force_y_[i] = force.y;
+		batch_.inv_mass_[i] = motion->second->inv_mass_;
+		batch_.vel_x_[i] = motion->second->velocity_.x;
+		batch_.vel_y_[i] = motion->second->velocity_.y;
+		batch_.pos_x_[i] = xform ? xform->position_.x : 0.0f;
+		batch_.pos_y_[i] = xform ? xform->position_.y : 0.0f;
+		batch_.cos_[i] = 1.0f;
+		batch_.sin_[i] = 0.0f;
 
 		// Apply rotation matrix to velocity only if it's a particle to save processing power
-		if (particle) {
+		if (particle && xform) {
 
 			Matrix3x3 mtx{};
-			
-			// Apply rotation matrix to the velocity
+
+			// Rotation matrix applied to the change in velocity by the integrator
 			xform->rotation_ += xform->rotation_speed_;
 			Mtx33RotDeg(mtx, xform->rotation_);
-			new_vel = mtx * new_vel;
+			batch_.cos_[i] = mtx.m00;
+			batch_.sin_[i] = mtx.m10;
 
 			// Check if rotation is within bounds otherwise inverse the velocity
 			if (xform->rotation_ > xform->rotation_range_.y || xform->rotation_ < xform->rotation_range_.x) {
@@ -101,53 +102,41 @@ void Physics::Update(float frametime) {
 				xform->rotation_speed_ = -xform->rotation_speed_;
 			}
 		}
+	}
 
-		// Perform update ot entity's velocity
-		motion->second->velocity_ += new_vel;
-		motion->second->velocity_ *= 0.80f;
+	// Integrate acceleration, velocity and position for the whole batch
+	IntegrateMotion(batch_, frametime);
 
+	// Scatter results back into the components
+	for (size_t i = 0; i < batch_.size_; ++i) {
 
-		// If velocity is close to 0, reset to 0	
-		SnapZero(motion->second->velocity_);
+		Motion* motion = batch_.motions_[i];
+		Transform* xform = batch_.transforms_[i];
+
+		motion->acceleration_ = { batch_.acc_x_[i], batch_.acc_y_[i] };
+		motion->velocity_ = { batch_.vel_x_[i], batch_.vel_y_[i] };
 
 		// Check whether the entity owns a transform component by checking entity ID
 		if (xform) {
 			if (debug_) {
 				// Log id of entity and it's updated components that are being updated
 				std::stringstream ss;
-				ss << "Updating entity: " << std::to_string(motion->first) << "\n";
+				ss << "Updating entity: " << std::to_string(motion->GetOwner()->GetID()) << "\n";
 				ss << "\tCurrent Position: " << xform->position_.x << ", " << xform->position_.y << "\n";
+				ss << "\tUpdated Position: " << batch_.pos_x_[i] << ", " << batch_.pos_y_[i] << "\n";
 				M_DEBUG->WriteDebugMessage(ss.str());
 			}
 
 			// Perform update of entity's transform component
-			xform->position_ += motion->second->velocity_ * frametime;
-
-			if (debug_) {
-				// Log id of entity and it's updated components that are being updated
-				std::stringstream ss;
-				ss << "\tUpdated Position: " << xform->position_.x << ", " << xform->position_.y << "\n";
-				M_DEBUG->WriteDebugMessage(ss.str());
-			}
+			xform->position_ = { batch_.pos_x_[i], batch_.pos_y_[i] };
 		}
 	}
 
 	// Update textures and child entity offset
 	for (auto& [id, logic] : *logic_arr_) {
 
-		std::string update{};
-
-		if (logic->my_logic_.find("UpdateTexture") != logic->my_logic_.end()) {
-
-			update = logic->my_logic_["UpdateTexture"];
-			logic_mgr_->Exec(update, id);
-		}
-
-		if (logic->my_logic_.find("UpdateChildOffset") != logic->my_logic_.end()) {
-
-			update = logic->my_logic_["UpdateChildOffset"];
-			logic_mgr_->Exec(update, id);
-		}
+		logic->GetHook(LogicHook::UpdateTexture).Exec(id);
+		logic->GetHook(LogicHook::UpdateChildOffset).Exec(id);
 	}
 }
 
@@ -157,25 +146,29 @@ void Physics::ChangeVelocity(Message* m) {
 	//dynamic cast from message base class to derived message class
 	MessagePhysics_Motion* msg = dynamic_cast<MessagePhysics_Motion*>(m);
 
-	//locate the motion component that contains a matching entityID as in the message
-	for (MotionIt motion = motion_arr_->begin(); motion != motion_arr_->end(); ++motion) {
+	// Only entities named Player are moved, found without checking every motion's owner
+	const EntityManager::EntityIdMapType& players = entity_mgr_->GetNamedEntities(player_name_);
 
-		// Check if entity type of owner is Player
-		if (ENTITYNAME(motion->second->GetOwner()) == "Player") {
+	for (EntityManager::EntityIdMapType::const_iterator player = players.begin(); player != players.end(); ++player) {
 
-			//StatusIt status = status_arr_.find(motion->second->GetOwner()->GetID());
-			Status* status = status_arr_->GetComponent(motion->second->GetOwner()->GetID());
+		Motion* motion = motion_arr_->GetComponent(player->first);
 
-			// Temporary inclusion for "Hiding and burrow" check until input sys conversion to component
-			if (status && (status->status_ != StatusType::INVISIBLE)) {
+		if (!motion) {
 
-				//update the acceleration data member of that component with the message's
-				motion->second->velocity_ = msg->new_vec_;
-			}
-			else {
+			continue;
+		}
 
-				motion->second->velocity_ = {};
-			}
+		Status* status = status_arr_->GetComponent(player->first);
+
+		// Temporary inclusion for "Hiding and burrow" check until input sys conversion to component
+		if (status && (status->status_ != StatusType::INVISIBLE)) {
+
+			//update the acceleration data member of that component with the message's
+			motion->velocity_ = msg->new_vec_;
+		}
+		else {
+
+			motion->velocity_ = {};
 		}
 	}
 }
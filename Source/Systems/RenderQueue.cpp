@@ -0,0 +1,115 @@
+/**********************************************************************************
+*\file         RenderQueue.cpp
+*\brief        Contains definition of functions and variables used for
+*			   the draw key sorted render queue
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+               or disclosure of this file or its contents without the prior
+               written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Systems/RenderQueue.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    constexpr int layer_shift = 48;
+    constexpr int depth_shift = 16;
+    constexpr int texture_shift = 4;
+
+    constexpr uint64_t texture_mask = 0xFFF;
+    constexpr uint64_t material_mask = 0xF;
+
+    constexpr int radix_bits = 8;
+    constexpr size_t radix_size = 1 << radix_bits;
+    constexpr size_t radix_passes = sizeof(uint64_t) * 8 / radix_bits;
+
+    // Maps a float onto an unsigned integer with the same ordering
+    uint32_t SortableFloat(float value) {
+
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    }
+}
+
+uint64_t RenderQueue::MakeKey(int layer, float depth, GLuint texture, uint8_t material) {
+
+    // Layers outside of 16 bits keep their order against every other layer
+    int clamped = (std::max)((std::min)(layer, static_cast<int>(INT16_MAX)), static_cast<int>(INT16_MIN));
+    uint64_t layer_bits = static_cast<uint64_t>(clamped - INT16_MIN);
+
+    // Objects further up the screen are drawn first
+    uint64_t depth_bits = static_cast<uint64_t>(~SortableFloat(depth));
+
+    return layer_bits << layer_shift |
+           depth_bits << depth_shift |
+           (texture & texture_mask) << texture_shift |
+           (material & material_mask);
+}
+
+void RenderQueue::Clear() {
+
+    items_.clear();
+}
+
+void RenderQueue::Push(uint64_t key, IRenderer* renderer, Transform* transform, Scale* scale) {
+
+    items_.push_back({ key, renderer, transform, scale });
+}
+
+void RenderQueue::Sort() {
+
+    const size_t count = items_.size();
+
+    if (count < 2) {
+
+        return;
+    }
+
+    // Histograms for every pass are built in a single read of the keys
+    size_t histogram[radix_passes][radix_size]{};
+
+    for (const Item& item : items_) {
+
+        for (size_t pass = 0; pass < radix_passes; ++pass) {
+
+            ++histogram[pass][(item.key_ >> (pass * radix_bits)) & (radix_size - 1)];
+        }
+    }
+
+    scratch_.resize(count);
+
+    for (size_t pass = 0; pass < radix_passes; ++pass) {
+
+        size_t* buckets = histogram[pass];
+        const int shift = static_cast<int>(pass * radix_bits);
+
+        // Every key has the same byte here, the pass would not move anything
+        if (buckets[(items_.front().key_ >> shift) & (radix_size - 1)] == count) {
+
+            continue;
+        }
+
+        size_t offset = 0;
+
+        for (size_t bucket = 0; bucket < radix_size; ++bucket) {
+
+            size_t bucket_count = buckets[bucket];
+            buckets[bucket] = offset;
+            offset += bucket_count;
+        }
+
+        for (const Item& item : items_) {
+
+            scratch_[buckets[(item.key_ >> shift) & (radix_size - 1)]++] = item;
+        }
+
+        items_.swap(scratch_);
+    }
+}
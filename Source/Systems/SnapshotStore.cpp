@@ -0,0 +1,157 @@
+/**********************************************************************************
+*\file         SnapshotStore.cpp
+*\brief        Contains definition of functions and variables used for
+*			   keeping save game snapshots of the world in memory and on disk
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Systems/SnapshotStore.h"
+#include "Manager/MappedFile.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+	void WriteSnapshot(const std::string& path, SnapshotStore::Snapshot snapshot) {
+
+		std::vector<unsigned char> header;
+		CloneReader::Append(header, SnapshotStore::magic_);
+		CloneReader::Append(header, SnapshotStore::version_);
+		CloneReader::Append(header, CloneReader::layout_);
+
+		if (!WriteFileAtomic(path, { { header.data(), header.size() },
+									 { snapshot->data(), snapshot->size() } })) {
+
+			std::cout << "Failed to write snapshot : " << path << std::endl;
+		}
+	}
+}
+
+SnapshotStore::SnapshotStore() :
+	writing_{ false }
+{}
+
+SnapshotStore::~SnapshotStore() {
+
+	Wait();
+}
+
+void SnapshotStore::Init(const std::string& directory) {
+
+	directory_ = directory;
+
+	std::error_code error;
+	std::filesystem::create_directories(directory_, error);
+}
+
+std::string SnapshotStore::GetPath(const std::string& slot) const {
+
+	return directory_ + "/" + slot + ".sav";
+}
+
+void SnapshotStore::Save(const std::string& slot, std::vector<unsigned char>&& contents) {
+
+	Snapshot snapshot = std::make_shared<const std::vector<unsigned char>>(std::move(contents));
+	snapshots_[slot] = snapshot;
+
+	if (directory_.empty()) {
+
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock{ write_lock_ };
+
+	// Writes are made in turn by one thread so they never overlap, an
+	// unwritten earlier save of the slot is dropped
+	queued_writes_[GetPath(slot)] = snapshot;
+
+	if (!writing_) {
+
+		writing_ = true;
+		writer_ = std::async(std::launch::async, &SnapshotStore::WriteQueued, this);
+	}
+}
+
+void SnapshotStore::WriteQueued() {
+
+	for (;;) {
+
+		std::pair<std::string, Snapshot> write;
+
+		{
+			std::lock_guard<std::mutex> lock{ write_lock_ };
+
+			if (queued_writes_.empty()) {
+
+				writing_ = false;
+				return;
+			}
+
+			write = *queued_writes_.begin();
+			queued_writes_.erase(queued_writes_.begin());
+		}
+
+		WriteSnapshot(write.first, write.second);
+	}
+}
+
+bool SnapshotStore::Load(const std::string& slot, Snapshot& snapshot, CloneReader& contents) {
+
+	auto it = snapshots_.find(slot);
+
+	if (it != snapshots_.end()) {
+
+		snapshot = it->second;
+		contents = CloneReader{ snapshot->data(), snapshot->size() };
+		return true;
+	}
+
+	if (directory_.empty()) {
+
+		return false;
+	}
+
+	std::ifstream file{ GetPath(slot), std::ios::binary | std::ios::ate };
+
+	if (!file) {
+
+		return false;
+	}
+
+	std::vector<unsigned char> data(static_cast<size_t>(file.tellg()));
+	file.seekg(0, std::ios::beg);
+	file.read(reinterpret_cast<char*>(data.data()), data.size());
+
+	CloneReader reader{ data.data(), data.size() };
+
+	uint32_t magic = 0, version = 0, layout = 0;
+	reader >> magic >> version >> layout;
+
+	if (!file || magic != magic_ || version != version_ || layout != CloneReader::layout_) {
+
+		return false;
+	}
+
+	// Only what follows the header is kept, as it is for saved snapshots
+	data.erase(data.begin(), data.begin() + sizeof(magic) + sizeof(version) + sizeof(layout));
+
+	snapshot = std::make_shared<const std::vector<unsigned char>>(std::move(data));
+	snapshots_[slot] = snapshot;
+	contents = CloneReader{ snapshot->data(), snapshot->size() };
+	return true;
+}
+
+void SnapshotStore::Wait() {
+
+	if (writer_.valid()) {
+
+		writer_.get();
+	}
+}
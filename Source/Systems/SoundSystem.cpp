@@ -15,8 +15,10 @@
 #include "Manager/EntityManager.h"
 #include "Systems/SoundSystem.h"
 #include "Engine/Core.h"
+#include "Manager/FileManager.h"
 #include "Systems/InputSystem.h"
 #include "MathLib/MathHelper.h"
+#include "MathLib/Random.h"
 #include "Systems/Debug.h"
 
 SoundSystem::SoundSystem() :
@@ -115,6 +117,19 @@ void SoundSystem::LoadSound(std::string name, std::stringstream& data) {
 	}
 }
 
+size_t SoundSystem::GetSoundSize(std::string name) {
+
+	SoundIt it = sound_library_.find(name);
+	unsigned int length = 0;
+
+	if (it != sound_library_.end()) {
+
+		it->second->sound_->getLength(&length, FMOD_TIMEUNIT_PCMBYTES);
+	}
+
+	return length;
+}
+
 void SoundSystem::PlaySounds(std::string fileID) {
 
 	// Check whether sound file exists within sound library
@@ -168,7 +183,7 @@ void SoundSystem::PlayTaggedSounds(std::string file_tag) {
 		}
 	}
 
-	SoundIt it = (!list.empty()) ? list[rand() % list.size()] : sound_library_.end();
+	SoundIt it = (!list.empty()) ? list[GetRandom().Index(list.size())] : sound_library_.end();
 
 	// If sound file exists within the sound library
 	if (it != sound_library_.end()) {
@@ -292,6 +307,8 @@ void SoundSystem::RemoveSound(std::string name) {
 	}
 	if (sound_it != sound_library_.end()) {
 		
+		// Also stops the channels still playing it
+		sound_it->second->sound_->release();
 		sound_library_.erase(sound_it);
 	}
 }
@@ -308,11 +325,15 @@ void SoundSystem::RemoveCompletedChannel() {
 	completed_channel_.clear();
 }
 
+void SoundSystem::ResetPlayer() {
+
+	player_ = nullptr;
+}
+
 void SoundSystem::DeSerialize(const std::string& filepath) {
 
-	// Parse the stringstream into document (DOM) format
-	rapidjson::Document doc;
-	DeSerializeJSON(filepath, doc);
+	// Parse the file into document (DOM) format
+	const rapidjson::Document& doc = DeSerializeJSON(filepath);
 
 	// Treats entire filestream at index as array and ensure that it is an array
 	const rapidjson::Value& sound_arr = doc;
@@ -376,8 +397,7 @@ void SoundSystem::Serialize(const std::string& filepath) {
 
 void SoundSystem::Init() {
 
-	// Load all sound files
-	DeSerialize("Resources/AssetsLoading/sounds.json");
+	// Sound files are loaded by the Asset Registry with the levels using them
 	component_manager_ = CORE->GetManager<ComponentManager>();
 	graphics_system_ = CORE->GetSystem<GraphicsSystem>();
 	sound_emitter_arr_ = component_manager_->GetComponentArray<SoundEmitter>();
@@ -0,0 +1,78 @@
+/**********************************************************************************
+*\file         SpriteBatch.cpp
+*\brief        Contains definition of functions and variables used for
+*			   building the world sprite vertex stream
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+               or disclosure of this file or its contents without the prior
+               written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Systems/SpriteBatch.h"
+#include <cassert>
+
+void SpriteBatch::Init(size_t capacity, size_t segments, bool instanced) {
+
+    // Plain asserts keep the builder free of engine systems, so it can run headless
+    assert(capacity > 0 && segments > 0);
+
+    capacity_ = capacity;
+    segments_ = segments;
+    segment_ = 0;
+    count_ = 0;
+    instanced_ = instanced;
+
+    vertices_.clear();
+    instances_.clear();
+
+    // Storage is sized once, Add only writes into it
+    if (instanced_) {
+
+        instances_.resize(capacity_);
+    }
+
+    else {
+
+        vertices_.resize(capacity_ * 4);
+    }
+}
+
+void SpriteBatch::Add(const glm::vec2* tex_vtx, const glm::vec2& scaling,
+                      const glm::vec2& rotation, const glm::vec2& position, float texture_id) {
+
+    assert(!Full());
+
+    if (instanced_) {
+
+        instances_[count_++] = { { tex_vtx[0].x, tex_vtx[0].y, tex_vtx[3].x, tex_vtx[3].y },
+                                 scaling, rotation, position, texture_id };
+        return;
+    }
+
+    Vertex* vertex = &vertices_[count_++ * 4];
+
+    for (int i = 0; i < 4; ++i) {
+
+        vertex[i] = { tex_vtx[i], scaling, rotation, position, texture_id };
+    }
+}
+
+void SpriteBatch::Advance() {
+
+    count_ = 0;
+    segment_ = (segment_ + 1) % segments_;
+}
+
+const void* SpriteBatch::Data() const {
+
+    return instanced_ ? static_cast<const void*>(instances_.data())
+                      : static_cast<const void*>(vertices_.data());
+}
+
+size_t SpriteBatch::SpriteStride() const {
+
+    return instanced_ ? sizeof(Instance) : sizeof(Vertex) * 4;
+}
@@ -0,0 +1,107 @@
+/**********************************************************************************
+*\file         UIBatch.cpp
+*\brief        Contains definition of functions and variables used for
+*			   building the UI vertex stream
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+               or disclosure of this file or its contents without the prior
+               written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Systems/UIBatch.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+void UIBatch::Init(size_t capacity, size_t max_textures) {
+
+    assert(capacity > 0 && max_textures > 0);
+
+    capacity_ = capacity;
+    max_textures_ = max_textures;
+    invalid_ = true;
+
+    vertices_.clear();
+    previous_.clear();
+    draws_.clear();
+    textures_.clear();
+
+    vertices_.reserve(capacity_ * 4);
+    previous_.reserve(capacity_ * 4);
+}
+
+void UIBatch::Begin() {
+
+    // Keep last frame's vertices to compare against, reusing both buffers
+    vertices_.swap(previous_);
+    vertices_.clear();
+    draws_.clear();
+    textures_.clear();
+}
+
+bool UIBatch::Add(const glm::vec2* position, const glm::vec2* tex_vtx,
+                  unsigned int texture, Stencil stencil) {
+
+    if (vertices_.size() == capacity_ * 4) {
+
+        return false;
+    }
+
+    size_t quad = vertices_.size() / 4;
+    Draw* draw = draws_.empty() ? nullptr : &draws_.back();
+
+    // Masked quads are drawn on their own, they change the stencil state
+    if (draw && (stencil != Stencil::None || draw->stencil_ != Stencil::None)) {
+
+        draw = nullptr;
+    }
+
+    std::vector<unsigned int>::iterator slot;
+
+    if (draw) {
+
+        std::vector<unsigned int>::iterator begin = textures_.begin() + draw->textures_begin_;
+        slot = std::find(begin, textures_.end(), texture);
+
+        if (slot == textures_.end() && draw->texture_count_ == max_textures_) {
+
+            draw = nullptr;
+        }
+    }
+
+    if (!draw) {
+
+        draws_.push_back({ quad, 0, textures_.size(), 0, stencil });
+        draw = &draws_.back();
+        slot = textures_.end();
+    }
+
+    if (slot == textures_.end()) {
+
+        textures_.push_back(texture);
+        slot = textures_.end() - 1;
+        ++draw->texture_count_;
+    }
+
+    float texture_id = static_cast<float>(slot - (textures_.begin() + draw->textures_begin_));
+
+    for (int i = 0; i < 4; ++i) {
+
+        vertices_.push_back({ position[i], tex_vtx[i], texture_id });
+    }
+
+    ++draw->count_;
+    return true;
+}
+
+bool UIBatch::End() {
+
+    bool changed = invalid_ || vertices_.size() != previous_.size() ||
+                   std::memcmp(vertices_.data(), previous_.data(), vertices_.size() * sizeof(Vertex)) != 0;
+
+    invalid_ = false;
+    return changed;
+}
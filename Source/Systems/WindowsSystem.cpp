@@ -15,6 +15,7 @@
 #include "Systems/GraphicsSystem.h"
 #include "Systems/InputSystem.h"
 #include "Systems/Debug.h"
+#include "Manager/FileManager.h"
 #include <memory>
 
 FILE* file;
@@ -82,9 +83,8 @@ void WindowsSystem::DeSerialize() {
 
 	M_DEBUG->WriteDebugMessage("Initializing Windows System\n");
 
-	// Parse the stringstream into document (DOM) format
-	rapidjson::Document doc;
-	DeSerializeJSON("Resources/EntityConfig/window.json", doc);
+	// Parse the file into document (DOM) format
+	const rapidjson::Document& doc = DeSerializeJSON("Resources/EntityConfig/window.json");
 
 	// Treats entire filestream at index as array and ensure that it is an array
 	const rapidjson::Value& value_arr = doc["Window"];
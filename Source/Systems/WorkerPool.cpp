@@ -0,0 +1,98 @@
+/**********************************************************************************
+*\file         WorkerPool.cpp
+*\brief        Contains definition of functions and variables used for
+*			   the Worker Pool
+*
+*\author	   agent, 100% Code Contribution
+*
+*\copyright    Copyright (c) 2020 DigiPen Institute of Technology. Reproduction
+			   or disclosure of this file or its contents without the prior
+			   written consent of DigiPen Institute of Technology is prohibited.
+**********************************************************************************/
+
+
+#include "Systems/WorkerPool.h"
+
+WorkerPool::WorkerPool() :
+	job_{ nullptr },
+	jobs_{ 0 },
+	pending_{ 0 },
+	generation_{ 0 },
+	stop_{ false }
+{  }
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> guard{ lock_ };
+		stop_ = true;
+	}
+
+	start_.notify_all();
+
+	for (std::thread& thread : threads_)
+		thread.join();
+}
+
+void WorkerPool::Init(size_t workers, const std::function<void(size_t)>& on_start)
+{
+	threads_.reserve(workers);
+
+	for (size_t worker = 0; worker < workers; ++worker) {
+
+		threads_.emplace_back([this, worker, on_start]() {
+
+			if (on_start)
+				on_start(worker);
+
+			WorkerLoop(worker);
+		});
+	}
+}
+
+void WorkerPool::WorkerLoop(size_t worker)
+{
+	uint64_t generation = 0;
+	std::unique_lock<std::mutex> guard{ lock_ };
+
+	for (;;) {
+
+		start_.wait(guard, [this, generation]() { return stop_ || generation_ != generation; });
+
+		if (stop_)
+			return;
+
+		generation = generation_;
+
+		if (worker + 1 < jobs_) {
+
+			guard.unlock();
+			(*job_)(worker + 1);
+			guard.lock();
+		}
+
+		if (--pending_ == 0)
+			done_.notify_one();
+	}
+}
+
+void WorkerPool::Run(size_t jobs, const std::function<void(size_t)>& job)
+{
+	if (jobs == 0)
+		return;
+
+	{
+		std::lock_guard<std::mutex> guard{ lock_ };
+		job_ = &job;
+		jobs_ = jobs;
+		pending_ = threads_.size();
+		++generation_;
+	}
+
+	start_.notify_all();
+
+	job(0);
+
+	std::unique_lock<std::mutex> guard{ lock_ };
+	done_.wait(guard, [this]() { return pending_ == 0; });
+}